@@ -0,0 +1,72 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "../src/include.hpp"
+
+// Plays random games from the start position for the benchmarks. The same seed gives the same games
+// on every machine, as long as the move generator keeps its move order. Moves are drawn with
+// xorshift64 from the legal moves, with capture_bias (0-100) the percentage of moves drawn from the
+// captures only, if there are any. A game ends at mate, stalemate, the 50 move rule, insufficient
+// material or after max_plies.
+class GameGenerator {
+   public:
+    static constexpr std::uint64_t DEFAULT_SEED = 0x9E3779B97F4A7C15ull;
+
+    explicit GameGenerator(std::uint64_t seed = DEFAULT_SEED, int max_plies = 200, int capture_bias = 0)
+        : seed_(seed ? seed : DEFAULT_SEED), max_plies_(max_plies), capture_bias_(capture_bias) {}
+
+    std::vector<chess::Move> next() {
+        chess::Board board;
+        chess::Movelist moves, captures;
+        std::vector<chess::Move> game;
+
+        while (static_cast<int>(game.size()) < max_plies_) {
+            chess::movegen::legalmoves(moves, board);
+            if (moves.empty() || board.isHalfMoveDraw() || board.isInsufficientMaterial()) break;
+
+            const auto* from = &moves;
+
+            if (capture_bias_ > 0 && static_cast<int>(random() % 100) < capture_bias_) {
+                chess::movegen::legalmoves<chess::movegen::MoveGenType::CAPTURE>(captures, board);
+                if (!captures.empty()) from = &captures;
+            }
+
+            const auto move = (*from)[random() % from->size()];
+
+            game.push_back(move);
+            board.makeMove<true>(move);
+        }
+
+        return game;
+    }
+
+    // PGN result of a game returned by next(), "*" if it was stopped after max_plies
+    static const char* result(const std::vector<chess::Move>& game) {
+        chess::Board board;
+        for (const auto& move : game) board.makeMove<true>(move);
+
+        if (!chess::movegen::anylegalmoves(board)) {
+            if (!board.inCheck()) return "1/2-1/2";
+            return board.sideToMove() == chess::Color::WHITE ? "0-1" : "1-0";
+        }
+
+        if (board.isHalfMoveDraw() || board.isInsufficientMaterial()) return "1/2-1/2";
+
+        return "*";
+    }
+
+   private:
+    std::uint64_t random() noexcept {
+        seed_ ^= seed_ << 13;
+        seed_ ^= seed_ >> 7;
+        seed_ ^= seed_ << 17;
+        return seed_;
+    }
+
+    std::uint64_t seed_;
+    int max_plies_;
+    int capture_bias_;
+};
@@ -0,0 +1,157 @@
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "../src/include.hpp"
+#include "corpus.hpp"
+
+using namespace chess;
+
+// Writes a reproducible corpus of random games for the benchmarks, so they don't need downloads.
+//
+// corpus_generator <fen|epd|pgn|packed> <count> [--seed <n>] [--plies <n>] [--bias <percent>] [--out <file>]
+//
+// count is the number of positions, for pgn the number of games. Positions are the ones after every
+// move of the games, packed writes the 24 byte Board::Compact encoding of each. Without --out the
+// corpus goes to stdout.
+
+// movetext wrapped at 80 columns, followed by the result
+void writePgnGame(std::ostream& out, const std::vector<Move>& game, std::uint64_t round) {
+    const auto result = GameGenerator::result(game);
+
+    out << "[Event \"corpus\"]\n";
+    out << "[Site \"?\"]\n";
+    out << "[Date \"????.??.??\"]\n";
+    out << "[Round \"" << round << "\"]\n";
+    out << "[White \"?\"]\n";
+    out << "[Black \"?\"]\n";
+    out << "[Result \"" << result << "\"]\n\n";
+
+    std::string movetext;
+    uci::gameToSan(Board(), game, movetext);
+    movetext += movetext.empty() ? "" : " ";
+    movetext += result;
+
+    std::size_t column = 0;
+    std::size_t start  = 0;
+
+    while (start < movetext.size()) {
+        // a move number stays on the line of its move
+        auto end = movetext.find(' ', start);
+        if (end != std::string::npos && movetext[end - 1] == '.') end = movetext.find(' ', end + 1);
+        if (end == std::string::npos) end = movetext.size();
+
+        const auto token = std::string_view(movetext).substr(start, end - start);
+
+        if (column > 0 && column + 1 + token.size() > 80) {
+            out << '\n';
+            column = 0;
+        } else if (column > 0) {
+            out << ' ';
+            column++;
+        }
+
+        out << token;
+        column += token.size();
+        start = end + 1;
+    }
+
+    out << "\n\n";
+}
+
+int main(int argc, char const* argv[]) {
+    if (argc < 3) {
+        std::cerr << "Usage: " << argv[0]
+                  << " <fen|epd|pgn|packed> <count> [--seed <n>] [--plies <n>] [--bias <percent>] [--out <file>]\n";
+        return 1;
+    }
+
+    const auto format = std::string_view(argv[1]);
+    const auto count  = std::stoull(argv[2]);
+
+    if (format != "fen" && format != "epd" && format != "pgn" && format != "packed") {
+        std::cerr << "Error: unknown format " << format << "\n";
+        return 1;
+    }
+
+    std::uint64_t seed = GameGenerator::DEFAULT_SEED;
+    int plies          = 200;
+    int bias           = 0;
+    std::string file;
+
+    for (int i = 3; i + 1 < argc; i += 2) {
+        const auto arg = std::string_view(argv[i]);
+
+        if (arg == "--seed") {
+            seed = std::stoull(argv[i + 1]);
+        } else if (arg == "--plies") {
+            plies = std::stoi(argv[i + 1]);
+
+            // a game without moves adds no position, so the fen, epd and packed output would never end
+            if (plies < 1) {
+                std::cerr << "Error: --plies must be at least 1\n";
+                return 1;
+            }
+        } else if (arg == "--bias") {
+            bias = std::stoi(argv[i + 1]);
+        } else if (arg == "--out") {
+            file = argv[i + 1];
+        } else {
+            std::cerr << "Error: unknown option " << arg << "\n";
+            return 1;
+        }
+    }
+
+    std::ofstream file_stream;
+
+    if (!file.empty()) {
+        file_stream.open(file, std::ios::binary);
+
+        if (!file_stream.is_open()) {
+            std::cerr << "Error: Could not open file " << file << "\n";
+            return 1;
+        }
+    }
+
+    auto& out = file.empty() ? std::cout : file_stream;
+
+    GameGenerator generator(seed, plies, bias);
+    std::uint64_t written = 0;
+    std::uint64_t games   = 0;
+
+    while (written < count) {
+        const auto game = generator.next();
+        games++;
+
+        if (format == "pgn") {
+            writePgnGame(out, game, games);
+            written++;
+            continue;
+        }
+
+        Board board;
+
+        for (const auto& move : game) {
+            if (written == count) break;
+
+            board.makeMove<true>(move);
+            written++;
+
+            if (format == "fen") {
+                out << board.getFen() << '\n';
+            } else if (format == "epd") {
+                out << board.getEpd() << '\n';
+            } else {
+                const auto packed = Board::Compact::encode(board);
+                out.write(reinterpret_cast<const char*>(packed.data()), packed.size());
+            }
+        }
+    }
+
+    std::cerr << "wrote " << written << (format == "pgn" ? " games" : " positions") << " from " << games
+              << " games\n";
+
+    return 0;
+}
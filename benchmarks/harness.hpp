@@ -0,0 +1,226 @@
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "perf_counters.hpp"
+
+// Shared by suite_benchmark and micro_benchmark. Every case is warmed up, repeated and reported as the
+// median and the median absolute deviation of the time per operation, as JSON. With a baseline file
+// every case whose median got slower than the tolerance allows is reported and the exit code is 1.
+// With --counters 1 the hardware counters per operation are added, as far as the kernel allows it.
+//
+// [--filter <name>] [--repetitions <n>] [--warmup <n>] [--counters 1]
+// [--baseline <file>] [--tolerance <fraction>] [--write-baseline <file>]
+
+// keeps the compiler from dropping a computation whose result is otherwise unused
+template <typename T>
+inline void doNotOptimize(const T& value) {
+#if defined(__GNUC__) || defined(__clang__)
+    asm volatile("" : : "r,m"(value) : "memory");
+#else
+    static volatile const T* sink;
+    sink = &value;
+#endif
+}
+
+// a case runs its whole workload once and returns the number of operations it did
+struct Case {
+    std::string name;
+    std::function<std::uint64_t()> run;
+};
+
+struct Result {
+    std::string name;
+    std::uint64_t ops = 0;
+    double median     = 0;
+    double mad        = 0;
+    bool has_counters = false;
+    PerfCounters::Sample counters;
+};
+
+inline double median(std::vector<double> values) {
+    std::sort(values.begin(), values.end());
+    const auto n = values.size();
+    return n % 2 ? values[n / 2] : (values[n / 2 - 1] + values[n / 2]) / 2;
+}
+
+// counters may be null, otherwise they are summed over all repetitions and reported per operation
+inline Result measure(const Case& c, int warmup, int repetitions, PerfCounters* counters) {
+    Result result;
+    result.name = c.name;
+
+    for (int i = 0; i < warmup; ++i) c.run();
+
+    std::vector<double> samples;
+    std::uint64_t total_ops = 0;
+
+    for (int i = 0; i < repetitions; ++i) {
+        if (counters) counters->start();
+
+        const auto t0  = std::chrono::high_resolution_clock::now();
+        const auto ops = c.run();
+        const auto t1  = std::chrono::high_resolution_clock::now();
+        const auto ns  = std::chrono::duration_cast<std::chrono::nanoseconds>(t1 - t0).count();
+
+        if (counters) result.counters += counters->stop();
+
+        result.ops = ops;
+        total_ops += ops;
+        samples.push_back(ns / static_cast<double>(std::max<std::uint64_t>(ops, 1)));
+    }
+
+    result.median = median(samples);
+
+    if (counters) {
+        result.has_counters = true;
+        result.counters     = result.counters / static_cast<double>(std::max<std::uint64_t>(total_ops, 1));
+    }
+
+    for (auto& sample : samples) sample = std::abs(sample - result.median);
+    result.mad = median(samples);
+
+    return result;
+}
+
+// reads the "name" and "median" pairs back from a file written by --write-baseline
+inline std::map<std::string, double> readBaseline(const std::string& file) {
+    std::ifstream stream(file);
+    std::map<std::string, double> baseline;
+    std::string line, name;
+
+    while (std::getline(stream, line)) {
+        const auto name_pos   = line.find("\"name\": \"");
+        const auto median_pos = line.find("\"median\": ");
+
+        if (name_pos != std::string::npos) {
+            const auto start = name_pos + std::string_view("\"name\": \"").size();
+            name             = line.substr(start, line.find('"', start) - start);
+        }
+
+        if (median_pos != std::string::npos && !name.empty()) {
+            baseline[name] = std::stod(line.substr(median_pos + std::string_view("\"median\": ").size()));
+            name.clear();
+        }
+    }
+
+    return baseline;
+}
+
+inline void writeJson(std::ostream& out, const std::vector<Result>& results,
+                      const std::map<std::string, double>& baseline, double tolerance) {
+    out << "{\n  \"unit\": \"ns/op\",\n  \"benchmarks\": [\n";
+
+    for (std::size_t i = 0; i < results.size(); ++i) {
+        const auto& r = results[i];
+
+        out << "    {\n";
+        out << "      \"name\": \"" << r.name << "\",\n";
+        out << "      \"ops\": " << r.ops << ",\n";
+        out << "      \"mad\": " << r.mad << ",\n";
+
+        const auto it = baseline.find(r.name);
+        if (it != baseline.end()) {
+            const auto slower = r.median > it->second * (1 + tolerance);
+            out << "      \"baseline\": " << it->second << ",\n";
+            out << "      \"status\": \"" << (slower ? "regression" : "ok") << "\",\n";
+        }
+
+        if (r.has_counters) {
+            out << "      \"counters\": ";
+            r.counters.writeJson(out);
+            out << ",\n";
+        }
+
+        // last, readBaseline expects the name before the median
+        out << "      \"median\": " << r.median << "\n";
+        out << "    }" << (i + 1 < results.size() ? "," : "") << "\n";
+    }
+
+    out << "  ]\n}\n";
+}
+
+// parses the options, runs the matching cases, prints the JSON and checks the baseline
+// returns the exit code of the benchmark
+inline int runCases(int argc, char const* argv[], const std::vector<Case>& cases) {
+    std::string filter, baseline_file, write_baseline;
+    int repetitions  = 15;
+    int warmup       = 3;
+    double tolerance = 0.15;
+    bool counters    = false;
+
+    for (int i = 1; i + 1 < argc; i += 2) {
+        const auto arg = std::string_view(argv[i]);
+
+        if (arg == "--filter") {
+            filter = argv[i + 1];
+        } else if (arg == "--repetitions") {
+            repetitions = std::max(1, std::stoi(argv[i + 1]));
+        } else if (arg == "--warmup") {
+            warmup = std::stoi(argv[i + 1]);
+        } else if (arg == "--baseline") {
+            baseline_file = argv[i + 1];
+        } else if (arg == "--tolerance") {
+            tolerance = std::stod(argv[i + 1]);
+        } else if (arg == "--counters") {
+            counters = std::string_view(argv[i + 1]) != "0";
+        } else if (arg == "--write-baseline") {
+            write_baseline = argv[i + 1];
+        } else {
+            std::cerr << "Error: unknown option " << arg << "\n";
+            return 1;
+        }
+    }
+
+    std::unique_ptr<PerfCounters> perf;
+
+    if (counters) {
+        perf = std::make_unique<PerfCounters>();
+        if (!perf->available()) std::cerr << "Warning: no hardware counters available, they are reported as null\n";
+    }
+
+    std::vector<Result> results;
+
+    for (const auto& c : cases) {
+        if (!filter.empty() && c.name.find(filter) == std::string::npos) continue;
+        results.push_back(measure(c, warmup, repetitions, perf.get()));
+    }
+
+    if (results.empty()) {
+        std::cerr << "Error: no benchmark matches " << filter << "\n";
+        return 1;
+    }
+
+    const auto baseline = baseline_file.empty() ? std::map<std::string, double>() : readBaseline(baseline_file);
+
+    writeJson(std::cout, results, baseline, tolerance);
+
+    if (!write_baseline.empty()) {
+        std::ofstream out(write_baseline);
+        writeJson(out, results, {}, tolerance);
+    }
+
+    bool regression = false;
+
+    for (const auto& r : results) {
+        const auto it = baseline.find(r.name);
+
+        if (it != baseline.end() && r.median > it->second * (1 + tolerance)) {
+            std::cerr << "Regression: " << r.name << " takes " << r.median << " ns/op, baseline " << it->second
+                      << " ns/op\n";
+            regression = true;
+        }
+    }
+
+    return regression ? 1 : 0;
+}
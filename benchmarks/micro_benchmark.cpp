@@ -0,0 +1,244 @@
+#include <algorithm>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "../src/include.hpp"
+#include "harness.hpp"
+
+using namespace chess;
+
+// Times single Board, attacks and uci primitives on real positions, so that a regression in one of
+// them is not hidden by the others. The positions are the perft FENs of the tests and every position
+// of the games in tests/pgns, or of the files given with --pgn <file> instead.
+// Run it from the repository root, see harness.hpp for the other options.
+
+struct Position {
+    // without the history of the game, a copy of it per position would take quadratic memory
+    Board board;
+    Movelist legal;
+    // the move played in the game, the first legal move for the FENs
+    Move played;
+    std::string san;
+};
+
+// isRepetition needs the history, so is_repetition replays the games from their start
+struct Game {
+    Board start;
+    std::vector<Move> moves;
+};
+
+struct Corpus {
+    std::vector<Position> positions;
+    std::vector<Game> games;
+};
+
+const char* const FENS[] = {
+    "rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1",
+    "r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 1",
+    "8/2p5/3p4/KP5r/1R3p1k/8/4P1P1/8 w - - 0 1",
+    "r3k2r/Pppp1ppp/1b3nbN/nP6/BBP1P3/q4N2/Pp1P2PP/R2Q1RK1 w kq - 0 1",
+    "rnbq1k1r/pp1Pbppp/2p5/8/2B5/8/PPP1NnPP/RNBQK2R w KQ - 1 8",
+    "r4rk1/1pp1qppp/p1np1n2/2b1p1B1/2B1P1b1/P1NP1N2/1PP1QPPP/R4RK1 w - - 0 1",
+};
+
+void addPosition(Corpus& corpus, const Board& board, Move played) {
+    Position position;
+    position.board  = Board(board.getFen());
+    position.played = played;
+    position.san    = uci::moveToSan(board, played);
+    movegen::legalmoves(position.legal, board);
+
+    corpus.positions.push_back(std::move(position));
+    corpus.games.back().moves.push_back(played);
+}
+
+// games with a move that doesn't parse stop there, the positions before it are kept
+void addGames(Corpus& corpus, const std::string& file) {
+    std::ifstream stream(file, std::ios::binary);
+
+    for (const auto& game : pgn::games(stream)) {
+        Board board(game.header("FEN").value_or(constants::STARTPOS));
+        Movelist moves;
+
+        corpus.games.push_back({board, {}});
+
+        for (const auto& entry : game.moves()) {
+            Move move;
+            if (uci::tryParseSan(board, entry.move, move, moves) != uci::SanError::NONE) break;
+
+            addPosition(corpus, board, move);
+            board.makeMove<true>(move);
+        }
+    }
+}
+
+Corpus makeCorpus(const std::vector<std::string>& files) {
+    Corpus corpus;
+
+    for (const auto fen : FENS) {
+        const auto board = Board(fen);
+
+        Movelist moves;
+        movegen::legalmoves(moves, board);
+
+        corpus.games.push_back({board, {}});
+        addPosition(corpus, board, moves[0]);
+    }
+
+    for (const auto& file : files) addGames(corpus, file);
+
+    return corpus;
+}
+
+std::vector<std::string> defaultFiles() {
+    std::vector<std::string> files;
+
+    for (const auto& entry : std::filesystem::directory_iterator("tests/pgns")) {
+        if (entry.path().extension() == ".pgn") files.push_back(entry.path().string());
+    }
+
+    // the directory order differs between systems, the corpus should not
+    std::sort(files.begin(), files.end());
+
+    return files;
+}
+
+// each case goes over the positions this often, so that a repetition takes more than a few microseconds
+constexpr int PASSES = 100;
+
+// runs f for every position and returns the number of operations it counted
+template <typename F>
+std::uint64_t forPositions(std::vector<Position>& positions, F f) {
+    std::uint64_t ops = 0;
+
+    for (int pass = 0; pass < PASSES; ++pass) {
+        for (auto& position : positions) ops += f(position);
+    }
+
+    return ops;
+}
+
+std::vector<Case> makeCases(Corpus& c) {
+    auto& p = c.positions;
+
+    return {
+        {"make_unmake",
+         [&p]() {
+             return forPositions(p, [](Position& position) {
+                 for (const auto& move : position.legal) {
+                     position.board.makeMove<true>(move);
+                     doNotOptimize(position.board);
+                     position.board.unmakeMove(move);
+                 }
+
+                 return position.legal.size();
+             });
+         }},
+        {"gives_check",
+         [&p]() {
+             return forPositions(p, [](Position& position) {
+                 for (const auto& move : position.legal) doNotOptimize(position.board.givesCheck(move));
+                 return position.legal.size();
+             });
+         }},
+        {"is_attacked",
+         [&p]() {
+             return forPositions(p, [](Position& position) {
+                 const auto them = ~position.board.sideToMove();
+                 for (int sq = 0; sq < 64; ++sq) doNotOptimize(position.board.isAttacked(Square(sq), them));
+                 return 64;
+             });
+         }},
+        {"in_check",
+         [&p]() {
+             return forPositions(p, [](Position& position) {
+                 doNotOptimize(position.board.inCheck());
+                 return 1;
+             });
+         }},
+        {"zobrist_after",
+         [&p]() {
+             return forPositions(p, [](Position& position) {
+                 for (const auto& move : position.legal) doNotOptimize(position.board.zobristAfter(move));
+                 return position.legal.size();
+             });
+         }},
+        {"is_repetition",
+         // includes the makeMove<true> that gets to the next position
+         [&c]() {
+             std::uint64_t ops = 0;
+
+             for (int pass = 0; pass < PASSES; ++pass) {
+                 for (const auto& game : c.games) {
+                     auto board = game.start;
+
+                     for (const auto& move : game.moves) {
+                         doNotOptimize(board.isRepetition());
+                         board.makeMove<true>(move);
+                     }
+
+                     ops += game.moves.size();
+                 }
+             }
+
+             return ops;
+         }},
+        {"insufficient_material",
+         [&p]() {
+             return forPositions(p, [](Position& position) {
+                 doNotOptimize(position.board.isInsufficientMaterial());
+                 return 1;
+             });
+         }},
+        {"attackers",
+         [&p]() {
+             return forPositions(p, [](Position& position) {
+                 const auto them = ~position.board.sideToMove();
+                 for (int sq = 0; sq < 64; ++sq) doNotOptimize(attacks::attackers(position.board, them, Square(sq)));
+                 return 64;
+             });
+         }},
+        {"move_to_san",
+         [&p]() {
+             return forPositions(p, [](Position& position) {
+                 char san[uci::MAX_SAN_LENGTH];
+                 doNotOptimize(uci::moveToSan(position.board, position.played, san));
+                 doNotOptimize(san);
+                 return 1;
+             });
+         }},
+        {"parse_san",
+         [&p]() {
+             return forPositions(p, [](Position& position) {
+                 doNotOptimize(uci::parseSan(position.board, position.san));
+                 return 1;
+             });
+         }},
+    };
+}
+
+int main(int argc, char const* argv[]) {
+    // --pgn <file> replaces the default corpus, everything else is passed on to the harness
+    std::vector<std::string> files;
+    std::vector<const char*> args = {argv[0]};
+
+    for (int i = 1; i < argc; ++i) {
+        if (std::string_view(argv[i]) == "--pgn" && i + 1 < argc) {
+            files.push_back(argv[++i]);
+        } else {
+            args.push_back(argv[i]);
+        }
+    }
+
+    if (files.empty()) files = defaultFiles();
+
+    auto corpus = makeCorpus(files);
+
+    std::cerr << "positions: " << corpus.positions.size() << "\n";
+
+    return runCases(static_cast<int>(args.size()), args.data(), makeCases(corpus));
+}
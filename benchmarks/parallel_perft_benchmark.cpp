@@ -0,0 +1,246 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <deque>
+#include <iomanip>
+#include <iostream>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../src/include.hpp"
+
+using namespace chess;
+using namespace std::chrono;
+
+// Shared node counts, the depth is mixed into the key so that each (position, depth) has its own entry.
+using PerftTable = TranspositionTable<std::uint64_t>;
+
+std::uint64_t perftKey(std::uint64_t hash, int depth) noexcept {
+    return hash ^ (static_cast<std::uint64_t>(depth) * 0x9E3779B97F4A7C15ull);
+}
+
+std::uint64_t perft(Board& board, int depth, PerftTable& table) {
+    Movelist moves;
+    movegen::legalmoves(moves, board);
+
+    if (depth == 1) return moves.size();
+
+    const auto key      = perftKey(board.hash(), depth);
+    std::uint64_t nodes = 0;
+
+    if (table.probe(key, nodes)) return nodes;
+
+    for (const auto& move : moves) {
+        if (depth > 2) table.prefetch(perftKey(board.zobristAfter(move), depth - 1));
+
+        board.makeMove(move);
+        nodes += perft(board, depth - 1, table);
+        board.unmakeMove(move);
+    }
+
+    table.store(key, depth, nodes);
+
+    return nodes;
+}
+
+// A root move and one reply, searched to depth - 2. Shallow searches only split the root.
+struct Task {
+    std::size_t root;
+    Move reply;
+};
+
+// Each worker owns a deque of tasks, takes from its back and steals from the front of the others
+// once it runs dry. No tasks are added after the start, so a worker can stop when all are empty.
+class TaskQueues {
+   public:
+    explicit TaskQueues(std::size_t workers) : queues_(workers) {}
+
+    void push(std::size_t worker, const Task& task) { queues_[worker].tasks.push_back(task); }
+
+    bool pop(std::size_t worker, Task& task) {
+        {
+            auto& own = queues_[worker];
+            std::lock_guard<std::mutex> lock(own.mutex);
+
+            if (!own.tasks.empty()) {
+                task = own.tasks.back();
+                own.tasks.pop_back();
+                return true;
+            }
+        }
+
+        for (std::size_t i = 1; i < queues_.size(); ++i) {
+            auto& victim = queues_[(worker + i) % queues_.size()];
+            std::lock_guard<std::mutex> lock(victim.mutex);
+
+            if (!victim.tasks.empty()) {
+                task = victim.tasks.front();
+                victim.tasks.pop_front();
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+   private:
+    struct Queue {
+        std::mutex mutex;
+        std::deque<Task> tasks;
+    };
+
+    std::vector<Queue> queues_;
+};
+
+struct DivideResult {
+    Movelist moves;
+    std::vector<std::uint64_t> nodes;
+    std::uint64_t total = 0;
+};
+
+DivideResult parallelDivide(const Board& board, int depth, std::size_t threads, PerftTable& table) {
+    DivideResult result;
+    movegen::legalmoves(result.moves, board);
+    result.nodes.assign(result.moves.size(), 0);
+
+    if (depth <= 1) {
+        for (auto& nodes : result.nodes) nodes = 1;
+        result.total = result.moves.size();
+        return result;
+    }
+
+    TaskQueues queues(threads);
+    std::size_t count = 0;
+
+    for (std::size_t root = 0; root < static_cast<std::size_t>(result.moves.size()); ++root) {
+        if (depth == 2) {
+            queues.push(count++ % threads, {root, Move::NO_MOVE});
+            continue;
+        }
+
+        auto child = board;
+        child.makeMove(result.moves[root]);
+
+        Movelist replies;
+        movegen::legalmoves(replies, child);
+
+        for (const auto& reply : replies) queues.push(count++ % threads, {root, reply});
+    }
+
+    std::vector<std::vector<std::uint64_t>> counts(threads, std::vector<std::uint64_t>(result.moves.size(), 0));
+    std::vector<std::thread> workers;
+
+    for (std::size_t worker = 0; worker < threads; ++worker) {
+        workers.emplace_back([&, worker]() {
+            auto local = board;
+            Task task;
+
+            while (queues.pop(worker, task)) {
+                const auto root = result.moves[task.root];
+                local.makeMove(root);
+
+                if (task.reply == Move::NO_MOVE) {
+                    counts[worker][task.root] += perft(local, depth - 1, table);
+                } else {
+                    local.makeMove(task.reply);
+                    counts[worker][task.root] += perft(local, depth - 2, table);
+                    local.unmakeMove(task.reply);
+                }
+
+                local.unmakeMove(root);
+            }
+        });
+    }
+
+    for (auto& worker : workers) worker.join();
+
+    for (const auto& worker : counts) {
+        for (std::size_t i = 0; i < worker.size(); ++i) result.nodes[i] += worker[i];
+    }
+
+    for (const auto nodes : result.nodes) result.total += nodes;
+
+    return result;
+}
+
+struct Test {
+    std::string fen;
+    std::uint64_t expected_node_count;
+    int depth;
+};
+
+void benchThreads(const Test& test, std::size_t max_threads, std::size_t hash_mb) {
+    const auto board = Board(test.fen);
+
+    PerftTable table(hash_mb);
+
+    std::cout << "fen " << test.fen << " depth " << test.depth << " hash " << hash_mb << " MB\n";
+
+    // 1, 2, 4, ... threads and the maximum if it isn't a power of two
+    for (std::size_t threads = 1;; threads = std::min(threads * 2, max_threads)) {
+        table.clear();
+
+        const auto t0     = high_resolution_clock::now();
+        const auto result = parallelDivide(board, test.depth, threads, table);
+        const auto t1     = high_resolution_clock::now();
+        const auto ms     = duration_cast<milliseconds>(t1 - t0).count();
+
+        std::stringstream ss;
+
+        // clang-format off
+        ss << "  threads " << std::left << std::setw(3) << threads
+           << " time " << std::setw(6) << ms
+           << " nodes " << std::setw(12) << result.total
+           << " nps " << std::setw(11) << (result.total * 1000) / (ms + 1)
+           << (result.total == test.expected_node_count ? "" : " MISMATCH");
+        // clang-format on
+        std::cout << ss.str() << std::endl;
+
+        if (threads == max_threads) break;
+    }
+}
+
+int main(int argc, char const* argv[]) {
+    const auto hardware = static_cast<std::size_t>(std::max(1u, std::thread::hardware_concurrency()));
+
+    // divide a single position: <depth> [threads] [hash_mb] [fen]
+    if (argc > 1) {
+        const auto depth   = std::stoi(argv[1]);
+        const auto threads = argc > 2 ? static_cast<std::size_t>(std::stoul(argv[2])) : hardware;
+        const auto hash_mb = argc > 3 ? static_cast<std::size_t>(std::stoul(argv[3])) : 256;
+        const auto board   = Board(argc > 4 ? argv[4] : constants::STARTPOS);
+
+        PerftTable table(hash_mb);
+
+        const auto t0     = high_resolution_clock::now();
+        const auto result = parallelDivide(board, depth, threads, table);
+        const auto t1     = high_resolution_clock::now();
+        const auto ms     = duration_cast<milliseconds>(t1 - t0).count();
+
+        for (int i = 0; i < result.moves.size(); ++i) {
+            std::cout << uci::moveToUci(result.moves[i], board.chess960()) << ": " << result.nodes[i] << "\n";
+        }
+
+        std::cout << "\nnodes " << result.total << " time " << ms << " nps " << (result.total * 1000) / (ms + 1)
+                  << "\n";
+
+        return 0;
+    }
+
+    // otherwise report nodes/sec for 1, 2, 4, ... threads, with and without the shared table
+    const Test test_positions[] = {
+        {"rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1", 119060324, 6},
+        {"r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - ", 193690690, 5},
+        {"8/2p5/3p4/KP5r/1R3p1k/8/4P1P1/8 w - - ", 178633661, 7},
+        {"r3k2r/Pppp1ppp/1b3nbN/nP6/BBP1P3/q4N2/Pp1P2PP/R2Q1RK1 w kq - 0 1", 706045033, 6}};
+
+    for (const auto& test : test_positions) {
+        benchThreads(test, hardware, 0);
+        benchThreads(test, hardware, 256);
+    }
+
+    return 0;
+}
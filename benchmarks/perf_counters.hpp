@@ -0,0 +1,164 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <ostream>
+
+#ifdef __linux__
+#    include <linux/perf_event.h>
+#    include <sys/ioctl.h>
+#    include <sys/syscall.h>
+#    include <unistd.h>
+#endif
+
+// Hardware counters for the benchmarks, read through perf_event_open. Each event is opened on its
+// own, so if the kernel refuses some of them (no PMU in a VM, perf_event_paranoid, not Linux)
+// the others still count and the missing ones are reported as unavailable.
+class PerfCounters {
+   public:
+    enum Event { CYCLES, INSTRUCTIONS, BRANCH_MISSES, L1D_MISSES, LLC_MISSES, COUNT };
+
+    static constexpr const char* NAMES[COUNT] = {"cycles", "instructions", "branch_misses", "l1d_misses",
+                                                 "llc_misses"};
+
+    struct Sample {
+        std::array<double, COUNT> values = {};
+        std::array<bool, COUNT> available = {};
+
+        bool has(Event event) const noexcept { return available[event]; }
+
+        // instructions per cycle, 0 if either counter is missing
+        double ipc() const noexcept {
+            if (!has(CYCLES) || !has(INSTRUCTIONS) || values[CYCLES] == 0) return 0;
+            return values[INSTRUCTIONS] / values[CYCLES];
+        }
+
+        Sample& operator+=(const Sample& other) noexcept {
+            for (int i = 0; i < COUNT; ++i) {
+                values[i] += other.values[i];
+                available[i] = other.available[i];
+            }
+
+            return *this;
+        }
+
+        Sample operator/(double divisor) const noexcept {
+            auto sample = *this;
+            for (auto& value : sample.values) value /= divisor;
+            return sample;
+        }
+
+        // {"cycles": 1.5, ..., "ipc": 2.1}, unavailable counters are null
+        void writeJson(std::ostream& out) const {
+            out << "{";
+
+            for (int i = 0; i < COUNT; ++i) {
+                out << "\"" << NAMES[i] << "\": ";
+                if (available[i]) {
+                    out << values[i];
+                } else {
+                    out << "null";
+                }
+                out << ", ";
+            }
+
+            out << "\"ipc\": ";
+            if (ipc() > 0) {
+                out << ipc();
+            } else {
+                out << "null";
+            }
+            out << "}";
+        }
+    };
+
+    PerfCounters() {
+        fds_.fill(-1);
+
+#ifdef __linux__
+        open(CYCLES, PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES);
+        open(INSTRUCTIONS, PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS);
+        open(BRANCH_MISSES, PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES);
+        open(L1D_MISSES, PERF_TYPE_HW_CACHE, cacheEvent(PERF_COUNT_HW_CACHE_L1D));
+        open(LLC_MISSES, PERF_TYPE_HW_CACHE, cacheEvent(PERF_COUNT_HW_CACHE_LL));
+#endif
+    }
+
+    ~PerfCounters() {
+#ifdef __linux__
+        for (const auto fd : fds_) {
+            if (fd >= 0) close(fd);
+        }
+#endif
+    }
+
+    PerfCounters(const PerfCounters&)            = delete;
+    PerfCounters& operator=(const PerfCounters&) = delete;
+
+    // false if not a single counter could be opened
+    bool available() const noexcept {
+        for (const auto fd : fds_) {
+            if (fd >= 0) return true;
+        }
+
+        return false;
+    }
+
+    void start() noexcept {
+#ifdef __linux__
+        for (const auto fd : fds_) {
+            if (fd < 0) continue;
+            ioctl(fd, PERF_EVENT_IOC_RESET, 0);
+            ioctl(fd, PERF_EVENT_IOC_ENABLE, 0);
+        }
+#endif
+    }
+
+    Sample stop() noexcept {
+        Sample sample;
+
+#ifdef __linux__
+        for (int i = 0; i < COUNT; ++i) {
+            if (fds_[i] < 0) continue;
+
+            ioctl(fds_[i], PERF_EVENT_IOC_DISABLE, 0);
+
+            // value, time enabled, time running
+            std::uint64_t data[3] = {};
+            if (read(fds_[i], data, sizeof(data)) != sizeof(data)) continue;
+
+            // the kernel multiplexes when there are more events than hardware counters, scale up
+            sample.values[i]    = data[2] ? static_cast<double>(data[0]) * data[1] / data[2] : 0;
+            sample.available[i] = data[2] != 0;
+        }
+#endif
+
+        return sample;
+    }
+
+   private:
+#ifdef __linux__
+    static std::uint64_t cacheEvent(std::uint64_t cache) noexcept {
+        return cache | (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+    }
+
+    void open(Event event, std::uint32_t type, std::uint64_t config) noexcept {
+        perf_event_attr attr;
+        std::memset(&attr, 0, sizeof(attr));
+
+        attr.size           = sizeof(attr);
+        attr.type           = type;
+        attr.config         = config;
+        attr.disabled       = 1;
+        attr.inherit        = 1;
+        attr.exclude_kernel = 1;
+        attr.exclude_hv     = 1;
+        attr.read_format    = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+
+        fds_[event] = static_cast<int>(syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0));
+    }
+#endif
+
+    std::array<int, COUNT> fds_;
+};
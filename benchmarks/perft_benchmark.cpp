@@ -1,9 +1,11 @@
 #include <chrono>
 #include <iomanip>
+#include <memory>
 #include <sstream>
 #include <tuple>
 
 #include "../src/include.hpp"
+#include "perf_counters.hpp"
 
 using namespace chess;
 using namespace std::chrono;
@@ -35,13 +37,18 @@ uint64_t perft(int depth) {
     return nodes;
 }
 
-void benchPerft(Board& board, int depth, uint64_t expected_node_count) {
+// returns false on a wrong node count, benchmarks build with NDEBUG so this can't be an assert
+bool benchPerft(Board& board, int depth, uint64_t expected_node_count, PerfCounters* counters) {
     board_ = board;
 
+    if (counters) counters->start();
+
     const auto t1    = high_resolution_clock::now();
     const auto nodes = perft(depth);
     const auto t2    = high_resolution_clock::now();
-    const auto ms    = duration_cast<milliseconds>(t2 - t1).count();
+
+    const auto sample = counters ? counters->stop() : PerfCounters::Sample();
+    const auto ms     = duration_cast<milliseconds>(t2 - t1).count();
 
     std::stringstream ss;
 
@@ -54,7 +61,18 @@ void benchPerft(Board& board, int depth, uint64_t expected_node_count) {
     // clang-format on
     std::cout << ss.str() << std::endl;
 
-    assert(nodes == expected_node_count);
+    if (counters) {
+        std::cout << "  per node ";
+        (sample / static_cast<double>(nodes)).writeJson(std::cout);
+        std::cout << std::endl;
+    }
+
+    if (nodes != expected_node_count) {
+        std::cerr << "Error: expected " << expected_node_count << " nodes, got " << nodes << "\n";
+        return false;
+    }
+
+    return true;
 }
 
 struct Test {
@@ -63,7 +81,17 @@ struct Test {
     int depth;
 };
 
-int main() {
+// perft_benchmark [--counters] also prints the hardware counters per node of every position
+int main(int argc, char const* argv[]) {
+    bool ok = true;
+
+    std::unique_ptr<PerfCounters> counters;
+
+    if (argc > 1 && std::string(argv[1]) == "--counters") {
+        counters = std::make_unique<PerfCounters>();
+        if (!counters->available()) std::cerr << "Warning: no hardware counters available, they are reported as null\n";
+    }
+
     {
         const Test test_positions[] = {
             {"rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1", 3195901860, 7},
@@ -75,7 +103,7 @@ int main() {
 
         for (const auto& test : test_positions) {
             Board board(test.fen);
-            benchPerft(board, test.depth, test.expected_node_count);
+            ok &= benchPerft(board, test.depth, test.expected_node_count, counters.get());
         }
     }
 
@@ -99,7 +127,23 @@ int main() {
             Board board(test.fen);
             board.set960(true);
 
-            benchPerft(board, test.depth, test.expected_node_count);
+            ok &= benchPerft(board, test.depth, test.expected_node_count, counters.get());
         }
     }
+
+#ifdef CHESS_STATS
+    const auto stats = MovegenStats::collect();
+
+    std::cout << "generations: " << stats.generations << "\n";
+    std::cout << "double check exits: " << stats.double_check_exits << "\n";
+    std::cout << "seenSquares: " << stats.seen_squares << ", skipped: " << stats.seen_squares_skipped << "\n";
+    std::cout << "isLegal: " << stats.is_legal << ", rejected: " << stats.is_legal_false << "\n";
+    std::cout << "movelist sizes:\n";
+
+    for (std::size_t size = 0; size < stats.movelist_sizes.size(); ++size) {
+        if (stats.movelist_sizes[size]) std::cout << "  " << size << ": " << stats.movelist_sizes[size] << "\n";
+    }
+#endif
+
+    return ok ? 0 : 1;
 }
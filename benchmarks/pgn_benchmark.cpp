@@ -1,6 +1,7 @@
 #include <chrono>
 #include <filesystem>
 #include <fstream>
+#include <memory>
 
 #include "../src/include.hpp"
 
@@ -31,13 +32,37 @@ int main(int argc, char const* argv[]) {
     }
 
     const auto file  = argv[1];
-    auto file_stream = std::ifstream(file);
+    auto file_stream = std::ifstream(file, std::ios::binary);
+
+    const auto extension = std::filesystem::path(file).extension();
+
+    // compressed files are decompressed on a second thread while parsing
+    std::unique_ptr<pgn::InputSource> source;
+
+    if (extension == ".gz") {
+#ifdef CHESS_HAS_ZLIB
+        source = std::make_unique<pgn::GzipSource>(file_stream);
+#else
+        std::cerr << "Error: built without zlib support\n";
+        return 1;
+#endif
+    } else if (extension == ".zst") {
+#ifdef CHESS_HAS_ZSTD
+        source = std::make_unique<pgn::ZstdSource>(file_stream);
+#else
+        std::cerr << "Error: built without zstd support\n";
+        return 1;
+#endif
+    } else {
+        source = std::make_unique<pgn::IStreamSource>(file_stream);
+    }
 
     auto vis = std::make_unique<MyVisitor>();
 
     const auto t0 = std::chrono::high_resolution_clock::now();
 
-    pgn::StreamParser parser(file_stream);
+    auto threaded = pgn::ThreadedSource(*source);
+    pgn::StreamParser parser(threaded);
     auto error = parser.readGames(*vis);
 
     if (error) {
@@ -55,5 +80,20 @@ int main(int argc, char const* argv[]) {
 
     std::cout << (std::chrono::duration_cast<std::chrono::milliseconds>(t1 - t0).count() / 1000.0) << "\n";
 
+#ifdef CHESS_PGN_STATS
+    const auto stats = parser.stats();
+    const auto ms    = [](std::chrono::nanoseconds ns) { return ns.count() / 1000.0 / 1000.0; };
+
+    std::cout << "bytes:         " << stats.bytes << "\n";
+    std::cout << "games:         " << stats.games << "\n";
+    std::cout << "skipped games: " << stats.skipped_games << "\n";
+    std::cout << "headers:       " << stats.headers << "\n";
+    std::cout << "moves:         " << stats.moves << "\n";
+    std::cout << "comments:      " << stats.comments << "\n";
+    std::cout << "read ms:       " << ms(stats.read_time) << "\n";
+    std::cout << "visitor ms:    " << ms(stats.visitor_time) << "\n";
+    std::cout << "parse ms:      " << ms(t1 - t0 - stats.read_time - stats.visitor_time) << "\n";
+#endif
+
     return 0;
 }
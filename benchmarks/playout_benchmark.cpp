@@ -0,0 +1,99 @@
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <string>
+#include <thread>
+
+#include "../src/include.hpp"
+
+using namespace chess;
+using namespace std::chrono;
+
+// Random playouts from the start position.
+//
+// playout_benchmark [games] [threads]
+//
+// First plays the games on one thread with Board::isGameOver after every move and again with
+// playout::gameOver, then reports games and plies per second of playout::run for 1, 2, 4, ...
+// threads, or only for the given number of threads.
+
+struct Totals {
+    std::uint64_t plies = 0;
+    std::uint64_t ms    = 0;
+};
+
+// the playout loop of playout::play, but with isGameOver
+Totals playIsGameOver(std::uint64_t games) {
+    Totals totals;
+    PlayoutRng rng;
+    RandomSelector select;
+
+    const auto t0 = high_resolution_clock::now();
+
+    for (std::uint64_t i = 0; i < games; ++i) {
+        Board board;
+        Movelist moves;
+        rng.seed(1 + i);
+
+        while (board.isGameOver().first == GameResultReason::NONE) {
+            movegen::legalmoves(moves, board);
+            board.makeMove<true>(select(board, moves, rng));
+            totals.plies++;
+        }
+    }
+
+    totals.ms = duration_cast<milliseconds>(high_resolution_clock::now() - t0).count();
+
+    return totals;
+}
+
+Totals playRun(std::uint64_t games, int threads) {
+    Totals totals;
+
+    PlayoutOptions options;
+    options.games   = games;
+    options.threads = threads;
+
+    const auto t0 = high_resolution_clock::now();
+
+    playout::run(options, [&totals](PlayoutGame& game) { totals.plies += game.moves.size(); });
+
+    totals.ms = duration_cast<milliseconds>(high_resolution_clock::now() - t0).count();
+
+    return totals;
+}
+
+void print(const std::string& name, std::uint64_t games, const Totals& totals) {
+    std::cout << name << ": " << games << " games " << totals.plies << " plies " << totals.ms << " ms "
+              << (games * 1000) / (totals.ms + 1) << " games/s " << (totals.plies * 1000) / (totals.ms + 1)
+              << " plies/s\n";
+}
+
+int main(int argc, char const* argv[]) {
+    const auto games    = argc > 1 ? std::stoull(argv[1]) : 20000ull;
+    const auto hardware = static_cast<int>(std::max(1u, std::thread::hardware_concurrency()));
+
+    const auto slow = playIsGameOver(games);
+    const auto fast = playRun(games, 1);
+
+    print("isGameOver", games, slow);
+    print("playout::run 1 thread", games, fast);
+
+    // same seeds, so both must have played the same games
+    if (slow.plies != fast.plies) {
+        std::cerr << "Error: plies differ\n";
+        return 1;
+    }
+
+    if (argc > 2) {
+        const auto threads = std::stoi(argv[2]);
+        print("playout::run " + std::to_string(threads) + " threads", games, playRun(games, threads));
+        return 0;
+    }
+
+    for (int threads = 2; threads <= hardware; threads *= 2) {
+        print("playout::run " + std::to_string(threads) + " threads", games, playRun(games, threads));
+    }
+
+    return 0;
+}
@@ -0,0 +1,91 @@
+#include <chrono>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "../src/include.hpp"
+
+using namespace chess;
+
+struct ReplayGame {
+    std::string fen;
+    std::vector<std::string> moves;
+};
+
+template <typename Parse>
+void benchReplay(const char* name, const std::vector<ReplayGame>& games, Parse parse) {
+    std::uint64_t count  = 0;
+    std::uint64_t errors = 0;
+
+    Board board;
+    Movelist moves;
+
+    const auto t0 = std::chrono::high_resolution_clock::now();
+
+    for (const auto& game : games) {
+        board.setFen(game.fen);
+
+        for (const auto& san : game.moves) {
+            Move move;
+
+            if (parse(board, san, move, moves) != uci::SanError::NONE) {
+                errors++;
+                break;
+            }
+
+            board.makeMove<true>(move);
+            count++;
+        }
+    }
+
+    const auto t1 = std::chrono::high_resolution_clock::now();
+
+    const auto seconds = std::chrono::duration_cast<std::chrono::microseconds>(t1 - t0).count() / 1000.0 / 1000.0;
+
+    std::cout << name << "\n";
+    std::cout << "  games: " << games.size() << "\n";
+    std::cout << "  moves: " << count << "\n";
+    std::cout << "  errors: " << errors << "\n";
+    std::cout << "  time: " << seconds << "s\n";
+    std::cout << "  moves/s: " << (count / seconds) << "\n";
+}
+
+int main(int argc, char const* argv[]) {
+    if (argc < 2) {
+        std::cerr << "Usage: " << argv[0] << " <pgn_file>\n";
+        return 1;
+    }
+
+    const auto file = argv[1];
+
+    auto file_stream = std::ifstream(file, std::ios::binary);
+    if (!file_stream.is_open()) {
+        std::cerr << "Error: Could not open file " << file << "\n";
+        return 1;
+    }
+
+    // load the games first, so that only the san parsing is timed
+    std::vector<ReplayGame> games;
+
+    for (const auto& game : pgn::games(file_stream)) {
+        ReplayGame replay;
+        replay.fen = std::string(game.header("FEN").value_or(constants::STARTPOS));
+
+        for (const auto& entry : game.moves()) replay.moves.emplace_back(entry.move);
+
+        games.push_back(std::move(replay));
+    }
+
+    benchReplay("tryParseSan", games, [](const Board& board, std::string_view san, Move& move, Movelist& moves) {
+        return uci::tryParseSan(board, san, move, moves);
+    });
+
+    uci::SanCache cache;
+
+    benchReplay("tryParseSan with SanCache", games,
+                [&cache](const Board& board, std::string_view san, Move& move, Movelist& moves) {
+                    return uci::tryParseSan(board, san, move, moves, cache);
+                });
+
+    return 0;
+}
@@ -0,0 +1,235 @@
+#include <cstdint>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "../src/include.hpp"
+#include "corpus.hpp"
+#include "harness.hpp"
+
+using namespace chess;
+
+// Runs the library's hot paths on a fixed, generated workload, see harness.hpp for the options.
+
+struct Workload {
+    std::vector<std::vector<Move>> games;
+    std::vector<std::string> fens;
+    std::vector<Board> positions;
+    std::vector<Movelist> legal;
+    std::vector<std::vector<std::string>> sans;
+    std::vector<PackedBoard> packed;
+    std::vector<std::vector<std::uint8_t>> move_index;
+    std::string pgn;
+};
+
+// random games from the start position, the same on every run and machine
+Workload makeWorkload(int count, int plies) {
+    Workload workload;
+    GameGenerator generator(GameGenerator::DEFAULT_SEED, plies);
+
+    for (int i = 0; i < count; ++i) {
+        const auto game = generator.next();
+
+        Board board;
+        std::vector<std::string> sans;
+
+        for (const auto& move : game) {
+            workload.fens.push_back(board.getFen());
+            workload.positions.push_back(board);
+            workload.legal.emplace_back();
+            movegen::legalmoves(workload.legal.back(), board);
+
+            sans.push_back(uci::moveToSan(board, move));
+            board.makeMove<true>(move);
+        }
+
+        std::string movetext;
+        uci::gameToSan(Board(), game, movetext);
+        workload.pgn += "[Event \"suite\"]\n[Result \"*\"]\n\n" + movetext + " *\n\n";
+
+        workload.move_index.emplace_back();
+        MoveIndexCodec::encode(Board(), game, workload.move_index.back());
+
+        workload.games.push_back(game);
+        workload.sans.push_back(std::move(sans));
+    }
+
+    // every position keeps its history otherwise, the cases only need the position itself
+    for (auto& position : workload.positions) {
+        position.setFen(position.getFen());
+        workload.packed.push_back(Board::Compact::encode(position));
+    }
+
+    return workload;
+}
+
+class SinkVisitor : public pgn::Visitor {
+   public:
+    void startPgn() override {}
+    void header(std::string_view, std::string_view) override {}
+    void startMoves() override {}
+    void move(std::string_view move, std::string_view) override { doNotOptimize(move); }
+    void endPgn() override {}
+};
+
+std::uint64_t perft(Board& board, int depth) {
+    Movelist moves;
+    movegen::legalmoves(moves, board);
+
+    if (depth == 1) return moves.size();
+
+    std::uint64_t nodes = 0;
+
+    for (const auto& move : moves) {
+        board.makeMove(move);
+        nodes += perft(board, depth - 1);
+        board.unmakeMove(move);
+    }
+
+    return nodes;
+}
+
+std::vector<Case> makeCases(Workload& w) {
+    return {
+        {"perft",
+         []() {
+             Board board;
+             return perft(board, 4);
+         }},
+        {"fen_roundtrip",
+         [&w]() {
+             Board board;
+             for (const auto& fen : w.fens) {
+                 board.setFen(fen);
+                 doNotOptimize(board.getFen());
+             }
+             return std::uint64_t(w.fens.size());
+         }},
+        {"pgn_parse",
+         [&w]() {
+             std::istringstream stream(w.pgn);
+             SinkVisitor visitor;
+             pgn::StreamParser parser(stream);
+             parser.readGames(visitor);
+             return std::uint64_t(w.games.size());
+         }},
+        {"san_parse",
+         [&w]() {
+             std::uint64_t count = 0;
+             Board board;
+             Movelist moves;
+
+             for (const auto& game : w.sans) {
+                 board.setFen(constants::STARTPOS);
+
+                 for (const auto& san : game) {
+                     Move move;
+                     uci::tryParseSan(board, san, move, moves);
+                     board.makeMove<true>(move);
+                     count++;
+                 }
+             }
+
+             return count;
+         }},
+        {"san_format",
+         [&w]() {
+             std::uint64_t count = 0;
+             char san[uci::MAX_SAN_LENGTH];
+
+             for (const auto& game : w.games) {
+                 Board board;
+
+                 for (const auto& move : game) {
+                     doNotOptimize(uci::moveToSan(board, move, san));
+                     board.makeMove<true>(move);
+                     count++;
+                 }
+             }
+
+             return count;
+         }},
+        {"gives_check",
+         [&w]() {
+             std::uint64_t count = 0;
+
+             for (std::size_t i = 0; i < w.positions.size(); ++i) {
+                 for (const auto& move : w.legal[i]) doNotOptimize(w.positions[i].givesCheck(move));
+                 count += w.legal[i].size();
+             }
+
+             return count;
+         }},
+        {"is_attacked",
+         [&w]() {
+             for (const auto& position : w.positions) {
+                 const auto them = ~position.sideToMove();
+                 for (int sq = 0; sq < 64; ++sq) doNotOptimize(position.isAttacked(Square(sq), them));
+             }
+
+             return std::uint64_t(w.positions.size() * 64);
+         }},
+        {"make_unmake",
+         [&w]() {
+             std::uint64_t count = 0;
+
+             for (std::size_t i = 0; i < w.positions.size(); ++i) {
+                 auto& position = w.positions[i];
+
+                 for (const auto& move : w.legal[i]) {
+                     position.makeMove(move);
+                     doNotOptimize(position.hash());
+                     position.unmakeMove(move);
+                 }
+
+                 count += w.legal[i].size();
+             }
+
+             return count;
+         }},
+        {"compact_encode",
+         [&w]() {
+             for (const auto& position : w.positions) doNotOptimize(Board::Compact::encode(position));
+             return std::uint64_t(w.positions.size());
+         }},
+        {"compact_decode",
+         [&w]() {
+             for (const auto& packed : w.packed) doNotOptimize(Board::Compact::decode(packed).hash());
+             return std::uint64_t(w.packed.size());
+         }},
+        {"move_index_encode",
+         [&w]() {
+             std::uint64_t count = 0;
+             std::vector<std::uint8_t> out;
+
+             for (const auto& game : w.games) {
+                 out.clear();
+                 MoveIndexCodec::encode(Board(), game, out);
+                 doNotOptimize(out.data());
+                 count += game.size();
+             }
+
+             return count;
+         }},
+        {"move_index_decode",
+         [&w]() {
+             std::uint64_t count = 0;
+             std::vector<Move> out;
+
+             for (const auto& data : w.move_index) {
+                 out.clear();
+                 MoveIndexCodec::decode(Board(), data, out);
+                 count += out.size();
+             }
+
+             return count;
+         }},
+    };
+}
+
+int main(int argc, char const* argv[]) {
+    auto workload = makeWorkload(200, 200);
+
+    return runCases(argc, argv, makeCases(workload));
+}
@@ -0,0 +1,213 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "../src/include.hpp"
+#include "corpus.hpp"
+
+using namespace chess;
+
+// random games from the start position, written as "position startpos moves ..." commands
+std::vector<std::string> makeCommands(int count, int plies) {
+    std::vector<std::string> commands;
+    GameGenerator generator(GameGenerator::DEFAULT_SEED, plies);
+
+    while (static_cast<int>(commands.size()) < count) {
+        const auto game = generator.next();
+
+        // only keep the long games, short ones don't stress the replay
+        if (static_cast<int>(game.size()) < plies / 2) continue;
+
+        std::string command = "position startpos moves";
+
+        for (const auto& move : game) {
+            command += ' ';
+            command += uci::moveToUci(move);
+        }
+
+        commands.push_back(std::move(command));
+    }
+
+    return commands;
+}
+
+template <typename Parse>
+void benchReplay(const char* name, const std::vector<std::string>& commands, Parse parse) {
+    std::uint64_t count  = 0;
+    std::uint64_t errors = 0;
+
+    Board board;
+
+    const auto t0 = std::chrono::high_resolution_clock::now();
+
+    for (const auto& command : commands) {
+        board.setFen(constants::STARTPOS);
+
+        auto rest = std::string_view(command).substr(std::string_view("position startpos moves ").size());
+
+        while (!rest.empty()) {
+            const auto space = rest.find(' ');
+            const auto token = rest.substr(0, space);
+            rest             = space == std::string_view::npos ? std::string_view() : rest.substr(space + 1);
+
+            const auto move = parse(board, token);
+
+            if (move == Move::NO_MOVE) {
+                errors++;
+                break;
+            }
+
+            board.makeMove<true>(move);
+            count++;
+        }
+    }
+
+    const auto t1 = std::chrono::high_resolution_clock::now();
+
+    const auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(t1 - t0).count();
+
+    std::cout << name << "\n";
+    std::cout << "  moves: " << count << "\n";
+    std::cout << "  errors: " << errors << "\n";
+    std::cout << "  time: " << (ns / 1e9) << "s\n";
+    std::cout << "  ns/move: " << (ns / static_cast<double>(count)) << "\n";
+}
+
+// a GUI sends the whole game again after every move, replay the growing commands of a few games
+void benchGrowingCommands(const std::vector<std::string>& commands, std::size_t games) {
+    std::vector<std::string_view> sent;
+
+    for (std::size_t i = 0; i < std::min(games, commands.size()); i++) {
+        const auto command = std::string_view(commands[i]);
+
+        for (auto pos = command.find(' ', std::string_view("position startpos moves ").size());
+             pos != std::string_view::npos; pos = command.find(' ', pos + 1)) {
+            sent.push_back(command.substr(0, pos));
+        }
+
+        sent.push_back(command);
+    }
+
+    {
+        std::uint64_t moves = 0;
+        Board board;
+
+        const auto t0 = std::chrono::high_resolution_clock::now();
+
+        for (const auto& command : sent) {
+            board.setFen(constants::STARTPOS);
+
+            auto rest = command.substr(std::string_view("position startpos moves ").size());
+
+            while (!rest.empty()) {
+                const auto space = rest.find(' ');
+                board.makeMove<true>(uci::uciToMoveChecked(board, rest.substr(0, space)));
+                rest = space == std::string_view::npos ? std::string_view() : rest.substr(space + 1);
+                moves++;
+            }
+        }
+
+        const auto t1 = std::chrono::high_resolution_clock::now();
+        const auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(t1 - t0).count();
+
+        std::cout << "full replay per command\n";
+        std::cout << "  commands: " << sent.size() << "\n";
+        std::cout << "  moves made: " << moves << "\n";
+        std::cout << "  ns/command: " << (ns / static_cast<double>(sent.size())) << "\n";
+    }
+
+    {
+        UciPosition position;
+        std::uint64_t errors = 0;
+
+        const auto t0 = std::chrono::high_resolution_clock::now();
+
+        for (const auto& command : sent) errors += !position.set(command);
+
+        const auto t1 = std::chrono::high_resolution_clock::now();
+        const auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(t1 - t0).count();
+
+        std::cout << "UciPosition\n";
+        std::cout << "  commands: " << sent.size() << "\n";
+        std::cout << "  errors: " << errors << "\n";
+        std::cout << "  ns/command: " << (ns / static_cast<double>(sent.size())) << "\n";
+    }
+}
+
+// formats the moves of all games, once into std::string and once into a buffer
+void benchFormat(const std::vector<std::string>& commands) {
+    std::vector<Move> moves;
+    Board board;
+
+    for (const auto& command : commands) {
+        board.setFen(constants::STARTPOS);
+
+        auto rest = std::string_view(command).substr(std::string_view("position startpos moves ").size());
+
+        while (!rest.empty()) {
+            const auto space = rest.find(' ');
+            const auto move  = uci::uciToMoveChecked(board, rest.substr(0, space));
+            rest             = space == std::string_view::npos ? std::string_view() : rest.substr(space + 1);
+
+            board.makeMove<true>(move);
+            moves.push_back(move);
+        }
+    }
+
+    // both loops feed the checksum so the formatting is not optimized away, it ends up as zero
+    std::uint64_t checksum = 0;
+
+    const auto t0 = std::chrono::high_resolution_clock::now();
+
+    for (const auto& move : moves) {
+        const auto str = uci::moveToUci(move);
+        checksum += str.size() + static_cast<unsigned char>(str[3]);
+    }
+
+    const auto t1 = std::chrono::high_resolution_clock::now();
+
+    char buffer[uci::MAX_UCI_LENGTH];
+
+    for (const auto& move : moves) {
+        const auto length = uci::moveToUci(move, buffer);
+        checksum -= length + static_cast<unsigned char>(buffer[3]);
+    }
+
+    const auto t2 = std::chrono::high_resolution_clock::now();
+
+    const auto ns_string = std::chrono::duration_cast<std::chrono::nanoseconds>(t1 - t0).count();
+    const auto ns_buffer = std::chrono::duration_cast<std::chrono::nanoseconds>(t2 - t1).count();
+
+    std::cout << "moveToUci\n";
+    std::cout << "  moves: " << moves.size() << "\n";
+    std::cout << "  checksum: " << checksum << "\n";
+    std::cout << "  std::string ns/move: " << (ns_string / static_cast<double>(moves.size())) << "\n";
+    std::cout << "  char* ns/move: " << (ns_buffer / static_cast<double>(moves.size())) << "\n";
+}
+
+int main(int argc, char const* argv[]) {
+    const auto count = argc > 1 ? std::stoi(argv[1]) : 20000;
+    const auto plies = argc > 2 ? std::stoi(argv[2]) : 500;
+
+    const auto commands = makeCommands(count, plies);
+
+    // no legality check at all, the lower bound for the two below
+    benchReplay("uciToMove", commands,
+                [](const Board& board, std::string_view token) { return uci::uciToMove(board, token); });
+
+    benchReplay("uciToMove + isLegal", commands, [](const Board& board, std::string_view token) {
+        const auto move = uci::uciToMove(board, token);
+        return movegen::isLegal(board, move) ? move : Move(Move::NO_MOVE);
+    });
+
+    benchReplay("uciToMoveChecked", commands,
+                [](const Board& board, std::string_view token) { return uci::uciToMoveChecked(board, token); });
+
+    benchGrowingCommands(commands, 200);
+    benchFormat(commands);
+
+    return 0;
+}
@@ -37,12 +37,18 @@ export default defineConfig({
           { text: "Bitboard", link: "/pages/bitboard" },
           { text: "Board", link: "/pages/board" },
           { text: "Constants", link: "/pages/constants" },
+          { text: "KPK Bitbase", link: "/pages/kpk" },
           { text: "Move", link: "/pages/move" },
           { text: "Move Generation", link: "/pages/move-generation" },
+          { text: "Move Index Codec", link: "/pages/move-index-codec" },
           { text: "Movelist", link: "/pages/movelist" },
           { text: "PGN Utilities", link: "/pages/pgn-utilities" },
           { text: "Piece", link: "/pages/piece" },
           { text: "Piece Type", link: "/pages/piece-type" },
+          { text: "Playouts", link: "/pages/playout" },
+          { text: "Policy Index", link: "/pages/policy" },
+          { text: "Tablebase", link: "/pages/tablebase" },
+          { text: "Transposition Table", link: "/pages/transposition-table" },
           { text: "File", link: "/pages/file" },
           { text: "Rank", link: "/pages/rank" },
           { text: "Square", link: "/pages/square" },
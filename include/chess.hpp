@@ -155,6 +155,33 @@ namespace utils {
 
 constexpr char tolower(char c) { return (c >= 'A' && c <= 'Z') ? (c - 'A' + 'a') : c; }
 
+// LEB128 varint, 7 bits per byte starting with the lowest, put(std::uint8_t) is called for every byte
+template <typename Put>
+void writeVarint(std::uint64_t value, Put&& put) {
+    while (value >= 0x80) {
+        put(static_cast<std::uint8_t>((value & 0x7F) | 0x80));
+        value >>= 7;
+    }
+
+    put(static_cast<std::uint8_t>(value));
+}
+
+// get(std::uint8_t&) returns false at the end of the data, false if the varint is cut off or too long
+template <typename Get>
+[[nodiscard]] bool readVarint(std::uint64_t& value, Get&& get) {
+    value = 0;
+
+    for (int shift = 0; shift < 64; shift += 7) {
+        std::uint8_t byte;
+        if (!get(byte)) return false;
+
+        value |= static_cast<std::uint64_t>(byte & 0x7F) << shift;
+        if (!(byte & 0x80)) return true;
+    }
+
+    return false;
+}
+
 }  // namespace utils
 
 }  // namespace chess
@@ -3057,6 +3084,25 @@ class Board {
     std::array<std::array<Bitboard, 2>, 2> castling_path = {};
 
    private:
+    friend class uci;
+
+    // Copies the position of other, but not its move history. Used by uci for temporary boards.
+    void copyPosition(const Board& other) {
+        prev_states_.clear();
+
+        pieces_bb_    = other.pieces_bb_;
+        occ_bb_       = other.occ_bb_;
+        board_        = other.board_;
+        key_          = other.key_;
+        cr_           = other.cr_;
+        plies_        = other.plies_;
+        stm_          = other.stm_;
+        ep_sq_        = other.ep_sq_;
+        hfm_          = other.hfm_;
+        chess960_     = other.chess960_;
+        castling_path = other.castling_path;
+    }
+
     void appendFenPiecePlacement(std::string& ss) const {
         for (int rank = 7; rank >= 0; rank--) {
             std::uint32_t free_space = 0;
@@ -3716,6 +3762,1049 @@ inline void attacks::initAttacks() {
 
 
 
+namespace chess {
+
+/**
+ * @brief Bitbase of king and pawn versus king, one bit per position for a win of the side with the
+ * pawn. It covers the pawn on files a-d, the others are mirrored, which takes 24 KB of constant data.
+ */
+class kpk {
+   public:
+    /**
+     * @brief Result for the side to move, like Board::isGameOver. The 50 move rule is ignored.
+     * @param board
+     * @return std::nullopt if the board has other material than two kings and a pawn, a pawn on
+     * the first or last rank or the side not to move in check
+     */
+    [[nodiscard]] static std::optional<GameResult> probe(const Board& board) {
+        const auto pawns = board.pieces(PieceType::PAWN);
+        if (board.occ().count() != 3 || pawns.count() != 1) return std::nullopt;
+
+        // isWin needs a legal position
+        if (pawns & (Bitboard(Rank::RANK_1) | Bitboard(Rank::RANK_8))) return std::nullopt;
+        if (board.isAttacked(board.kingSq(~board.sideToMove()), board.sideToMove())) return std::nullopt;
+
+        const auto strong = board.at(Square(pawns.lsb())).color();
+
+        // seen from the side with the pawn as white
+        const auto relative = [strong](Square sq) { return strong == Color::WHITE ? sq : sq.flip(); };
+
+        const auto stm = board.sideToMove() == strong ? Color::WHITE : Color::BLACK;
+        const auto win = isWin(relative(board.kingSq(strong)), relative(Square(pawns.lsb())),
+                               relative(board.kingSq(~strong)), stm);
+
+        if (!win) return GameResult::DRAW;
+        return board.sideToMove() == strong ? GameResult::WIN : GameResult::LOSE;
+    }
+
+    /**
+     * @brief If white wins with the king on wksq and the pawn on wpsq against the black king on bksq.
+     * The position must be legal.
+     * @param wksq
+     * @param wpsq
+     * @param bksq
+     * @param stm
+     * @return
+     */
+    [[nodiscard]] static bool isWin(Square wksq, Square wpsq, Square bksq, Color stm) {
+        int wk = wksq.index(), wp = wpsq.index(), bk = bksq.index();
+
+        // mirror the pawn onto files a-d
+        if ((wp & 7) > 3) {
+            wk ^= 7;
+            wp ^= 7;
+            bk ^= 7;
+        }
+
+        const auto idx = index(stm, bk, wk, wp);
+        return (BITS[idx / 64] >> (idx % 64)) & 1;
+    }
+
+   private:
+    // 2 sides to move * 24 pawn squares * 64 * 64 king squares
+    static constexpr std::size_t SIZE = 2 * 24 * 64 * 64;
+
+    static std::size_t index(Color stm, int bk, int wk, int wp) noexcept {
+        return wk | (bk << 6) | (static_cast<int>(stm) << 12) | ((wp & 7) << 13) | ((6 - (wp >> 3)) << 15);
+    }
+
+    // generated by retrograde analysis, tests/kpk.cpp checks it against the same generation
+    static constexpr std::array<std::uint64_t, SIZE / 64> BITS = {
+        0xFFFEFFFFFFFFFCFC, 0xFFFEFFFFFFFFF8F8, 0xFFFEFFFFFFFFF1F1, 0xFFFEFFFFFFFFE3E3, 0xFFFEFFFFFFFFC7C7,
+        0xFFFEFFFFFFFF8F8F, 0xFFFEFFFFFFFF1F1F, 0xFFFEFFFFFFFF3F3F, 0xFFFEFFFFFFFCFCFC, 0xFFFEFFFFFFF8F8F8,
+        0xFFFEFFFFFFF1F1F1, 0xFFFEFFFFFFE3E3E3, 0xFFFEFFFFFFC7C7C7, 0xFFFEFFFFFF8F8F8F, 0xFFFEFFFFFF1F1F1F,
+        0xFFFEFFFFFF3F3F3F, 0xFFFEFFFFFCFCFCFF, 0xFFFEFFFFF8F8F8FF, 0xFFFEFFFFF1F1F1FF, 0xFFFEFFFFE3E3E3FF,
+        0xFFFEFFFFC7C7C7FF, 0xFFFEFFFF8F8F8FFF, 0xFFFEFFFF1F1F1FFF, 0xFFFEFFFF3F3F3FFF, 0xFFFEFFFCFCFCFFFF,
+        0xFFFEFFF8F8F8FFFF, 0xFFFEFFF1F1F1FFFF, 0xFFFEFFE3E3E3FFFF, 0xFFFEFFC7C7C7FFFF, 0xFFFEFF8F8F8FFFFF,
+        0xFFFEFF1F1F1FFFFF, 0xFFFEFF3F3F3FFFFF, 0xFFFEFCFCFCFFFFFF, 0xFFFEF8F8F8FFFFFF, 0xFFFEF1F1F1FFFFFF,
+        0xFFFEE3E3E3FFFFFF, 0xFFFEC7C7C7FFFFFF, 0xFFFE8F8F8FFFFFFF, 0xFFFE1F1F1FFFFFFF, 0xFFFE3F3F3FFFFFFF,
+        0xFFFCFCFCFFFFFFFF, 0xFFF8F8F8FFFFFFFF, 0xFFF0F1F1FFFFFFFF, 0xFFE2E3E3FFFFFFFF, 0xFFC6C7C7FFFFFFFF,
+        0xFF8E8F8FFFFFFFFF, 0xFF1E1F1FFFFFFFFF, 0xFF3E3F3FFFFFFFFF, 0x0000000000000000, 0x0000000000000000,
+        0xF0F0F1FFFFFFFFFF, 0xE3E2E3FFFFFFFFFF, 0xC7C6C7FFFFFFFFFF, 0x8F8E8FFFFFFFFFFF, 0x1F1E1FFFFFFFFFFF,
+        0x3F3E3FFFFFFFFFFF, 0x0000000000000000, 0x0000000000000000, 0xF0F0FFFFFFFFFFFF, 0xE3E2FFFFFFFFFFFF,
+        0xC7C6FFFFFFFFFFFF, 0x8F8EFFFFFFFFFFFF, 0x1F1EFFFFFFFFFFFF, 0x3F3EFFFFFFFFFFFF, 0xFFFEFFFFFFFFFCFC,
+        0xFFFEFFFFFFFFF8F8, 0xFFFEFFFFFFFFF1F1, 0xFFFEFFFFFFFFE3E3, 0xFFFEFFFFFFFFC7C7, 0xFFFEFFFFFFFF8F8F,
+        0xFFFEFFFFFFFF1F1F, 0xFFFEFFFFFFFF3F3F, 0xFFFEFFFFFFFCFCFC, 0xFFFEFFFFFFF8F8F8, 0xFFFEFFFFFFF1F1F1,
+        0xFFFEFFFFFFE3E3E3, 0xFFFEFFFFFFC7C7C7, 0xFFFEFFFFFF8F8F8F, 0xFFFEFFFFFF1F1F1F, 0xFFFEFFFFFF3F3F3F,
+        0xFFFEFFFFFCFCFCFF, 0xFFFEFFFFF8F8F8FF, 0xFFFEFFFFF1F1F1FF, 0xFFFEFFFFE3E3E3FF, 0xFFFEFFFFC7C7C7FF,
+        0xFFFEFFFF8F8F8FFF, 0xFFFEFFFF1F1F1FFF, 0xFFFEFFFF3F3F3FFF, 0xFFFEFFFCFCFCFFFF, 0xFFFEFFF8F8F8FFFF,
+        0xFFFEFFF1F1F1FFFF, 0xFFFEFFE3E3E3FFFF, 0xFFFEFFC7C7C7FFFF, 0xFFFEFF8F8F8FFFFF, 0xFFFEFF1F1F1FFFFF,
+        0xFFFEFF3F3F3FFFFF, 0xFFFEFCFCFCFFFFFF, 0xFFFEF8F8F8FFFFFF, 0xFFFEF1F1F1FFFFFF, 0xFFFEE3E3E3FFFFFF,
+        0xFFFEC7C7C7FFFFFF, 0xFFFE8F8F8FFFFFFF, 0xFFFE1F1F1FFFFFFF, 0xFFFE3F3F3FFFFFFF, 0x0300000000000000,
+        0x0200000000000000, 0x0600010000000000, 0xFEE2E3E3FFFFFFFF, 0xFFC6C7C7FFFFFFFF, 0xFF8E8F8FFFFFFFFF,
+        0xFF1E1F1FFFFFFFFF, 0xFF3E3F3FFFFFFFFF, 0x0000000000000000, 0x0000000000000000, 0x0000010000000000,
+        0xE2E2E3FFFFFFFFFF, 0xC7C6C7FFFFFFFFFF, 0x8F8E8FFFFFFFFFFF, 0x1F1E1FFFFFFFFFFF, 0x3F3E3FFFFFFFFFFF,
+        0x0000000000000000, 0x0000000000000000, 0x0000070000000000, 0xE2E2FFFFFFFFFFFF, 0xC7C6FFFFFFFFFFFF,
+        0x8F8EFFFFFFFFFFFF, 0x1F1EFFFFFFFFFFFF, 0x3F3EFFFFFFFFFFFF, 0xFFFDFFFFFFFFFCFC, 0xFFFDFFFFFFFFF8F8,
+        0xFFFDFFFFFFFFF1F1, 0xFFFDFFFFFFFFE3E3, 0xFFFDFFFFFFFFC7C7, 0xFFFDFFFFFFFF8F8F, 0xFFFDFFFFFFFF1F1F,
+        0xFFFDFFFFFFFF3F3F, 0xFFFDFFFFFFFCFCFC, 0xFFFDFFFFFFF8F8F8, 0xFFFDFFFFFFF1F1F1, 0xFFFDFFFFFFE3E3E3,
+        0xFFFDFFFFFFC7C7C7, 0xFFFDFFFFFF8F8F8F, 0xFFFDFFFFFF1F1F1F, 0xFFFDFFFFFF3F3F3F, 0xFFFDFFFFFCFCFCFF,
+        0xFFFDFFFFF8F8F8FF, 0xFFFDFFFFF1F1F1FF, 0xFFFDFFFFE3E3E3FF, 0xFFFDFFFFC7C7C7FF, 0xFFFDFFFF8F8F8FFF,
+        0xFFFDFFFF1F1F1FFF, 0xFFFDFFFF3F3F3FFF, 0xFFFDFFFCFCFCFFFF, 0xFFFDFFF8F8F8FFFF, 0xFFFDFFF1F1F1FFFF,
+        0xFFFDFFE3E3E3FFFF, 0xFFFDFFC7C7C7FFFF, 0xFFFDFF8F8F8FFFFF, 0xFFFDFF1F1F1FFFFF, 0xFFFDFF3F3F3FFFFF,
+        0xFFFDFCFCFCFFFFFF, 0xFFFDF8F8F8FFFFFF, 0xFFFDF1F1F1FFFFFF, 0xFFFDE3E3E3FFFFFF, 0xFFFDC7C7C7FFFFFF,
+        0xFFFD8F8F8FFFFFFF, 0xFFFD1F1F1FFFFFFF, 0xFFFD3F3F3FFFFFFF, 0xFFFCFCFCFFFFFFFF, 0xFFF8F8F8FFFFFFFF,
+        0xFFF1F1F1FFFFFFFF, 0xFFE1E3E3FFFFFFFF, 0xFFC5C7C7FFFFFFFF, 0xFF8D8F8FFFFFFFFF, 0xFF1D1F1FFFFFFFFF,
+        0xFF3D3F3FFFFFFFFF, 0x0C0C0C0000000000, 0x0000000000000000, 0x0101010000000000, 0xE3E1E3FFFFFFFFFF,
+        0xC7C5C7FFFFFFFFFF, 0x8F8D8FFFFFFFFFFF, 0x1F1D1FFFFFFFFFFF, 0x3F3D3FFFFFFFFFFF, 0x0000000000000000,
+        0x00080A0F00000000, 0x0000000000000000, 0xE3E1FFFFFFFFFFFF, 0xC7C5FFFFFFFFFFFF, 0x8F8DFFFFFFFFFFFF,
+        0x1F1DFFFFFFFFFFFF, 0x3F3DFFFFFFFFFFFF, 0xFFFDFFFFFFFFFCFC, 0xFFFDFFFFFFFFF8F8, 0xFFFDFFFFFFFFF1F1,
+        0xFFFDFFFFFFFFE3E3, 0xFFFDFFFFFFFFC7C7, 0xFFFDFFFFFFFF8F8F, 0xFFFDFFFFFFFF1F1F, 0xFFFDFFFFFFFF3F3F,
+        0xFFFDFFFFFFFCFCFC, 0xFFFDFFFFFFF8F8F8, 0xFFFDFFFFFFF1F1F1, 0xFFFDFFFFFFE3E3E3, 0xFFFDFFFFFFC7C7C7,
+        0xFFFDFFFFFF8F8F8F, 0xFFFDFFFFFF1F1F1F, 0xFFFDFFFFFF3F3F3F, 0xFFFDFFFFFCFCFCFF, 0xFFFDFFFFF8F8F8FF,
+        0xFFFDFFFFF1F1F1FF, 0xFFFDFFFFE3E3E3FF, 0xFFFDFFFFC7C7C7FF, 0xFFFDFFFF8F8F8FFF, 0xFFFDFFFF1F1F1FFF,
+        0xFFFDFFFF3F3F3FFF, 0xFFFDFFFCFCFCFFFF, 0xFFFDFFF8F8F8FFFF, 0xFFFDFFF1F1F1FFFF, 0xFFFDFFE3E3E3FFFF,
+        0xFFFDFFC7C7C7FFFF, 0xFFFDFF8F8F8FFFFF, 0xFFFDFF1F1F1FFFFF, 0xFFFDFF3F3F3FFFFF, 0xFFFDFCFCFCFFFFFF,
+        0xFFFDF8F8F8FFFFFF, 0xFFFDF1F1F1FFFFFF, 0xFFFDE3E3E3FFFFFF, 0xFFFDC7C7C7FFFFFF, 0xFFFD8F8F8FFFFFFF,
+        0xFFFD1F1F1FFFFFFF, 0xFFFD3F3F3FFFFFFF, 0x0704040000000000, 0x0700000000000000, 0x0701010000000000,
+        0x0F01030000000000, 0xFFC5C7C7FFFFFFFF, 0xFF8D8F8FFFFFFFFF, 0xFF1D1F1FFFFFFFFF, 0xFF3D3F3FFFFFFFFF,
+        0x0404000000000000, 0x0000000000000000, 0x0101000000000000, 0x0301030000000000, 0xC7C5C7FFFFFFFFFF,
+        0x8F8D8FFFFFFFFFFF, 0x1F1D1FFFFFFFFFFF, 0x3F3D3FFFFFFFFFFF, 0x0404020000000000, 0x0000050000000000,
+        0x0101020000000000, 0x03010F0000000000, 0xC7C5FFFFFFFFFFFF, 0x8F8DFFFFFFFFFFFF, 0x1F1DFFFFFFFFFFFF,
+        0x3F3DFFFFFFFFFFFF, 0xFFFBFFFFFFFFFCFC, 0xFFFBFFFFFFFFF8F8, 0xFFFBFFFFFFFFF1F1, 0xFFFBFFFFFFFFE3E3,
+        0xFFFBFFFFFFFFC7C7, 0xFFFBFFFFFFFF8F8F, 0xFFFBFFFFFFFF1F1F, 0xFFFBFFFFFFFF3F3F, 0xFFFBFFFFFFFCFCFC,
+        0xFFFBFFFFFFF8F8F8, 0xFFFBFFFFFFF1F1F1, 0xFFFBFFFFFFE3E3E3, 0xFFFBFFFFFFC7C7C7, 0xFFFBFFFFFF8F8F8F,
+        0xFFFBFFFFFF1F1F1F, 0xFFFBFFFFFF3F3F3F, 0xFFFBFFFFFCFCFCFF, 0xFFFBFFFFF8F8F8FF, 0xFFFBFFFFF1F1F1FF,
+        0xFFFBFFFFE3E3E3FF, 0xFFFBFFFFC7C7C7FF, 0xFFFBFFFF8F8F8FFF, 0xFFFBFFFF1F1F1FFF, 0xFFFBFFFF3F3F3FFF,
+        0xFFFBFFFCFCFCFFFF, 0xFFFBFFF8F8F8FFFF, 0xFFFBFFF1F1F1FFFF, 0xFFFBFFE3E3E3FFFF, 0xFFFBFFC7C7C7FFFF,
+        0xFFFBFF8F8F8FFFFF, 0xFFFBFF1F1F1FFFFF, 0xFFFBFF3F3F3FFFFF, 0xFFFBFCFCFCFFFFFF, 0xFFFBF8F8F8FFFFFF,
+        0xFFFBF1F1F1FFFFFF, 0xFFFBE3E3E3FFFFFF, 0xFFFBC7C7C7FFFFFF, 0xFFFB8F8F8FFFFFFF, 0xFFFB1F1F1FFFFFFF,
+        0xFFFB3F3F3FFFFFFF, 0xFFF8FCFCFFFFFFFF, 0xFFF8F8F8FFFFFFFF, 0xFFF1F1F1FFFFFFFF, 0xFFE3E3E3FFFFFFFF,
+        0xFFC3C7C7FFFFFFFF, 0xFF8B8F8FFFFFFFFF, 0xFF1B1F1FFFFFFFFF, 0xFF3B3F3FFFFFFFFF, 0xFCF8FCFFFFFFFFFF,
+        0x1818180000000000, 0x0000000000000000, 0x0303030000000000, 0xC7C3C7FFFFFFFFFF, 0x8F8B8FFFFFFFFFFF,
+        0x1F1B1FFFFFFFFFFF, 0x3F3B3FFFFFFFFFFF, 0xFCF8FFFFFFFFFFFF, 0x0000000000000000, 0x0011151F00000000,
+        0x0000000000000000, 0xC7C3FFFFFFFFFFFF, 0x8F8BFFFFFFFFFFFF, 0x1F1BFFFFFFFFFFFF, 0x3F3BFFFFFFFFFFFF,
+        0xFFFBFFFFFFFFFCFC, 0xFFFBFFFFFFFFF8F8, 0xFFFBFFFFFFFFF1F1, 0xFFFBFFFFFFFFE3E3, 0xFFFBFFFFFFFFC7C7,
+        0xFFFBFFFFFFFF8F8F, 0xFFFBFFFFFFFF1F1F, 0xFFFBFFFFFFFF3F3F, 0xFFFBFFFFFFFCFCFC, 0xFFFBFFFFFFF8F8F8,
+        0xFFFBFFFFFFF1F1F1, 0xFFFBFFFFFFE3E3E3, 0xFFFBFFFFFFC7C7C7, 0xFFFBFFFFFF8F8F8F, 0xFFFBFFFFFF1F1F1F,
+        0xFFFBFFFFFF3F3F3F, 0xFFFBFFFFFCFCFCFF, 0xFFFBFFFFF8F8F8FF, 0xFFFBFFFFF1F1F1FF, 0xFFFBFFFFE3E3E3FF,
+        0xFFFBFFFFC7C7C7FF, 0xFFFBFFFF8F8F8FFF, 0xFFFBFFFF1F1F1FFF, 0xFFFBFFFF3F3F3FFF, 0xFFFBFFFCFCFCFFFF,
+        0xFFFBFFF8F8F8FFFF, 0xFFFBFFF1F1F1FFFF, 0xFFFBFFE3E3E3FFFF, 0xFFFBFFC7C7C7FFFF, 0xFFFBFF8F8F8FFFFF,
+        0xFFFBFF1F1F1FFFFF, 0xFFFBFF3F3F3FFFFF, 0xFFFBFCFCFCFFFFFF, 0xFFFBF8F8F8FFFFFF, 0xFFFBF1F1F1FFFFFF,
+        0xFFFBE3E3E3FFFFFF, 0xFFFBC7C7C7FFFFFF, 0xFFFB8F8F8FFFFFFF, 0xFFFB1F1F1FFFFFFF, 0xFFFB3F3F3FFFFFFF,
+        0x1F181C0000000000, 0x0E08080000000000, 0x0E00000000000000, 0x0E02020000000000, 0x1F03070000000000,
+        0xFF8B8F8FFFFFFFFF, 0xFF1B1F1FFFFFFFFF, 0xFF3B3F3FFFFFFFFF, 0x1C181C0000000000, 0x0808000000000000,
+        0x0000000000000000, 0x0202000000000000, 0x0703070000000000, 0x8F8B8FFFFFFFFFFF, 0x1F1B1FFFFFFFFFFF,
+        0x3F3B3FFFFFFFFFFF, 0x1C181C0000000000, 0x0808040000000000, 0x00000A0000000000, 0x0202040000000000,
+        0x07031F0000000000, 0x8F8BFFFFFFFFFFFF, 0x1F1BFFFFFFFFFFFF, 0x3F3BFFFFFFFFFFFF, 0xFFF7FFFFFFFFFCFC,
+        0xFFF7FFFFFFFFF8F8, 0xFFF7FFFFFFFFF1F1, 0xFFF7FFFFFFFFE3E3, 0xFFF7FFFFFFFFC7C7, 0xFFF7FFFFFFFF8F8F,
+        0xFFF7FFFFFFFF1F1F, 0xFFF7FFFFFFFF3F3F, 0xFFF7FFFFFFFCFCFC, 0xFFF7FFFFFFF8F8F8, 0xFFF7FFFFFFF1F1F1,
+        0xFFF7FFFFFFE3E3E3, 0xFFF7FFFFFFC7C7C7, 0xFFF7FFFFFF8F8F8F, 0xFFF7FFFFFF1F1F1F, 0xFFF7FFFFFF3F3F3F,
+        0xFFF7FFFFFCFCFCFF, 0xFFF7FFFFF8F8F8FF, 0xFFF7FFFFF1F1F1FF, 0xFFF7FFFFE3E3E3FF, 0xFFF7FFFFC7C7C7FF,
+        0xFFF7FFFF8F8F8FFF, 0xFFF7FFFF1F1F1FFF, 0xFFF7FFFF3F3F3FFF, 0xFFF7FFFCFCFCFFFF, 0xFFF7FFF8F8F8FFFF,
+        0xFFF7FFF1F1F1FFFF, 0xFFF7FFE3E3E3FFFF, 0xFFF7FFC7C7C7FFFF, 0xFFF7FF8F8F8FFFFF, 0xFFF7FF1F1F1FFFFF,
+        0xFFF7FF3F3F3FFFFF, 0xFFF7FCFCFCFFFFFF, 0xFFF7F8F8F8FFFFFF, 0xFFF7F1F1F1FFFFFF, 0xFFF7E3E3E3FFFFFF,
+        0xFFF7C7C7C7FFFFFF, 0xFFF78F8F8FFFFFFF, 0xFFF71F1F1FFFFFFF, 0xFFF73F3F3FFFFFFF, 0xFFF4FCFCFFFFFFFF,
+        0xFFF0F8F8FFFFFFFF, 0xFFF1F1F1FFFFFFFF, 0xFFE3E3E3FFFFFFFF, 0xFFC7C7C7FFFFFFFF, 0xFF878F8FFFFFFFFF,
+        0xFF171F1FFFFFFFFF, 0xFF373F3FFFFFFFFF, 0xFCF4FCFFFFFFFFFF, 0xF8F0F8FFFFFFFFFF, 0x3030300000000000,
+        0x0000000000000000, 0x0606060000000000, 0x8F878FFFFFFFFFFF, 0x1F171FFFFFFFFFFF, 0x3F373FFFFFFFFFFF,
+        0xFCF4FFFFFFFFFFFF, 0xF8F0FFFFFFFFFFFF, 0x0000000000000000, 0x00222A3E00000000, 0x0000000000000000,
+        0x8F87FFFFFFFFFFFF, 0x1F17FFFFFFFFFFFF, 0x3F37FFFFFFFFFFFF, 0xFFF7FFFFFFFFFCFC, 0xFFF7FFFFFFFFF8F8,
+        0xFFF7FFFFFFFFF1F1, 0xFFF7FFFFFFFFE3E3, 0xFFF7FFFFFFFFC7C7, 0xFFF7FFFFFFFF8F8F, 0xFFF7FFFFFFFF1F1F,
+        0xFFF7FFFFFFFF3F3F, 0xFFF7FFFFFFFCFCFC, 0xFFF7FFFFFFF8F8F8, 0xFFF7FFFFFFF1F1F1, 0xFFF7FFFFFFE3E3E3,
+        0xFFF7FFFFFFC7C7C7, 0xFFF7FFFFFF8F8F8F, 0xFFF7FFFFFF1F1F1F, 0xFFF7FFFFFF3F3F3F, 0xFFF7FFFFFCFCFCFF,
+        0xFFF7FFFFF8F8F8FF, 0xFFF7FFFFF1F1F1FF, 0xFFF7FFFFE3E3E3FF, 0xFFF7FFFFC7C7C7FF, 0xFFF7FFFF8F8F8FFF,
+        0xFFF7FFFF1F1F1FFF, 0xFFF7FFFF3F3F3FFF, 0xFFF7FFFCFCFCFFFF, 0xFFF7FFF8F8F8FFFF, 0xFFF7FFF1F1F1FFFF,
+        0xFFF7FFE3E3E3FFFF, 0xFFF7FFC7C7C7FFFF, 0xFFF7FF8F8F8FFFFF, 0xFFF7FF1F1F1FFFFF, 0xFFF7FF3F3F3FFFFF,
+        0xFFF7FCFCFCFFFFFF, 0xFFF7F8F8F8FFFFFF, 0xFFF7F1F1F1FFFFFF, 0xFFF7E3E3E3FFFFFF, 0xFFF7C7C7C7FFFFFF,
+        0xFFF78F8F8FFFFFFF, 0xFFF71F1F1FFFFFFF, 0xFFF73F3F3FFFFFFF, 0xFFF4FCFCFFFFFFFF, 0x3E30380000000000,
+        0x1C10100000000000, 0x1C00000000000000, 0x1C04040000000000, 0x3E060E0000000000, 0xFF171F1FFFFFFFFF,
+        0xFF373F3FFFFFFFFF, 0xFCF4FCFFFFFFFFFF, 0x3830380000000000, 0x1010000000000000, 0x0000000000000000,
+        0x0404000000000000, 0x0E060E0000000000, 0x1F171FFFFFFFFFFF, 0x3F373FFFFFFFFFFF, 0xFCF4FFFFFFFFFFFF,
+        0x38303E0000000000, 0x1010080000000000, 0x0000140000000000, 0x0404080000000000, 0x0E063E0000000000,
+        0x1F17FFFFFFFFFFFF, 0x3F37FFFFFFFFFFFF, 0xFFFFFEFFFFFFFCFC, 0xFFFFFEFFFFFFF8F8, 0xFFFFFEFFFFFFF1F1,
+        0xFFFFFEFFFFFFE3E3, 0xFFFFFEFFFFFFC7C7, 0xFFFFFEFFFFFF8F8F, 0xFFFFFEFFFFFF1F1F, 0xFFFFFEFFFFFF3F3F,
+        0xFFFFFEFFFFFCFCFC, 0xFFFFFEFFFFF8F8F8, 0xFFFFFEFFFFF1F1F1, 0xFFFFFEFFFFE3E3E3, 0xFFFFFEFFFFC7C7C7,
+        0xFFFFFEFFFF8F8F8F, 0xFFFFFEFFFF1F1F1F, 0xFFFFFEFFFF3F3F3F, 0xFFFFFEFFFCFCFCFF, 0xFFFFFEFFF8F8F8FF,
+        0xFFFFFEFFF1F1F1FF, 0xFFFFFEFFE3E3E3FF, 0xFFFFFEFFC7C7C7FF, 0xFFFFFEFF8F8F8FFF, 0xFFFFFEFF1F1F1FFF,
+        0xFFFFFEFF3F3F3FFF, 0xFFFFFEFCFCFCFFFF, 0xFFFFFEF8F8F8FFFF, 0xFFFFFEF1F1F1FFFF, 0xFFFFFEE3E3E3FFFF,
+        0xFFFFFEC7C7C7FFFF, 0xFFFFFE8F8F8FFFFF, 0xFFFFFE1F1F1FFFFF, 0xFFFFFE3F3F3FFFFF, 0xFFFFFCFCFCFFFFFF,
+        0xFFFFF8F8F8FFFFFF, 0xFFFFF0F1F1FFFFFF, 0xFFFFE2E3E3FFFFFF, 0xFFFFC6C7C7FFFFFF, 0xFFFF8E8F8FFFFFFF,
+        0xFFFF1E1F1FFFFFFF, 0xFFFF3E3F3FFFFFFF, 0x0000000000000000, 0x0200000000000000, 0x0701000000000000,
+        0xFFE3E2E3FFFFFFFF, 0xFFC7C6C7FFFFFFFF, 0xFF8F8E8FFFFFFFFF, 0xFF1F1E1FFFFFFFFF, 0xFF3F3E3FFFFFFFFF,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0xE3E3E2FFFFFFFFFF, 0xC7C7C6FFFFFFFFFF,
+        0x8F8F8EFFFFFFFFFF, 0x1F1F1EFFFFFFFFFF, 0x3F3F3EFFFFFFFFFF, 0x0000000000000000, 0x0000000000000000,
+        0x0000060000000000, 0xE3E3FEFFFFFFFFFF, 0xC7C7FEFFFFFFFFFF, 0x8F8FFEFFFFFFFFFF, 0x1F1FFEFFFFFFFFFF,
+        0x3F3FFEFFFFFFFFFF, 0xFFFFFEFFFFFFFCFC, 0xFFFFFEFFFFFFF8F8, 0xFFFFFEFFFFFFF1F1, 0xFFFFFEFFFFFFE3E3,
+        0xFFFFFEFFFFFFC7C7, 0xFFFFFEFFFFFF8F8F, 0xFFFFFEFFFFFF1F1F, 0xFFFFFEFFFFFF3F3F, 0xFFFFFEFFFFFCFCFC,
+        0xFFFFFEFFFFF8F8F8, 0xFFFFFEFFFFF1F1F1, 0xFFFFFEFFFFE3E3E3, 0xFFFFFEFFFFC7C7C7, 0xFFFFFEFFFF8F8F8F,
+        0xFFFFFEFFFF1F1F1F, 0xFFFFFEFFFF3F3F3F, 0xFFFFFEFFFCFCFCFF, 0xFFFFFEFFF8F8F8FF, 0xFFFFFEFFF1F1F1FF,
+        0xFFFFFEFFE3E3E3FF, 0xFFFFFEFFC7C7C7FF, 0xFFFFFEFF8F8F8FFF, 0xFFFFFEFF1F1F1FFF, 0xFFFFFEFF3F3F3FFF,
+        0xFFFFFEFCFCFCFFFF, 0xFFFFFEF8F8F8FFFF, 0xFFFFFEF1F1F1FFFF, 0xFFFFFEE3E3E3FFFF, 0xFFFFFEC7C7C7FFFF,
+        0xFFFFFE8F8F8FFFFF, 0xFFFFFE1F1F1FFFFF, 0xFFFFFE3F3F3FFFFF, 0x0003000000000000, 0x0003000000000000,
+        0x0207000000000000, 0x070F020200000000, 0xFFFFC6C7C7FFFFFF, 0xFFFF8E8F8FFFFFFF, 0xFFFF1E1F1FFFFFFF,
+        0xFFFF3E3F3FFFFFFF, 0x0000000000000000, 0x0000000000000000, 0x0200000000000000, 0x0602020000000000,
+        0xFFC7C6C7FFFFFFFF, 0xFF8F8E8FFFFFFFFF, 0xFF1F1E1FFFFFFFFF, 0xFF3F3E3FFFFFFFFF, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0202020000000000, 0xC7C7C6FFFFFFFFFF, 0x8F8F8EFFFFFFFFFF,
+        0x1F1F1EFFFFFFFFFF, 0x3F3F3EFFFFFFFFFF, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0202060000000000, 0xC7C7FEFFFFFFFFFF, 0x8F8FFEFFFFFFFFFF, 0x1F1FFEFFFFFFFFFF, 0x3F3FFEFFFFFFFFFF,
+        0xFFFFFDFFFFFFFCFC, 0xFFFFFDFFFFFFF8F8, 0xFFFFFDFFFFFFF1F1, 0xFFFFFDFFFFFFE3E3, 0xFFFFFDFFFFFFC7C7,
+        0xFFFFFDFFFFFF8F8F, 0xFFFFFDFFFFFF1F1F, 0xFFFFFDFFFFFF3F3F, 0xFFFFFDFFFFFCFCFC, 0xFFFFFDFFFFF8F8F8,
+        0xFFFFFDFFFFF1F1F1, 0xFFFFFDFFFFE3E3E3, 0xFFFFFDFFFFC7C7C7, 0xFFFFFDFFFF8F8F8F, 0xFFFFFDFFFF1F1F1F,
+        0xFFFFFDFFFF3F3F3F, 0xFFFFFDFFFCFCFCFF, 0xFFFFFDFFF8F8F8FF, 0xFFFFFDFFF1F1F1FF, 0xFFFFFDFFE3E3E3FF,
+        0xFFFFFDFFC7C7C7FF, 0xFFFFFDFF8F8F8FFF, 0xFFFFFDFF1F1F1FFF, 0xFFFFFDFF3F3F3FFF, 0xFFFFFDFCFCFCFFFF,
+        0xFFFFFDF8F8F8FFFF, 0xFFFFFDF1F1F1FFFF, 0xFFFFFDE3E3E3FFFF, 0xFFFFFDC7C7C7FFFF, 0xFFFFFD8F8F8FFFFF,
+        0xFFFFFD1F1F1FFFFF, 0xFFFFFD3F3F3FFFFF, 0xFFFFFCFCFCFFFFFF, 0xFFFFF8F8F8FFFFFF, 0xFFFFF1F1F1FFFFFF,
+        0xFFFFE1E3E3FFFFFF, 0xFFFFC5C7C7FFFFFF, 0xFFFF8D8F8FFFFFFF, 0xFFFF1D1F1FFFFFFF, 0xFFFF3D3F3FFFFFFF,
+        0x0F0C0C0C00000000, 0x0000000000000000, 0x0701010100000000, 0x0F03010307000000, 0xFFC7C5C7FFFFFFFF,
+        0xFF8F8D8FFFFFFFFF, 0xFF1F1D1FFFFFFFFF, 0xFF3F3D3FFFFFFFFF, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0303011F1F000000, 0xC7C7C5FFFFFFFFFF, 0x8F8F8DFFFFFFFFFF, 0x1F1F1DFFFFFFFFFF,
+        0x3F3F3DFFFFFFFFFF, 0x040C080F00000000, 0x0000050000000000, 0x0101090F00000000, 0x03031D1F1F000000,
+        0xC7C7FDFFFFFFFFFF, 0x8F8FFDFFFFFFFFFF, 0x1F1FFDFFFFFFFFFF, 0x3F3FFDFFFFFFFFFF, 0xFFFFFDFFFFFFFCFC,
+        0xFFFFFDFFFFFFF8F8, 0xFFFFFDFFFFFFF1F1, 0xFFFFFDFFFFFFE3E3, 0xFFFFFDFFFFFFC7C7, 0xFFFFFDFFFFFF8F8F,
+        0xFFFFFDFFFFFF1F1F, 0xFFFFFDFFFFFF3F3F, 0xFFFFFDFFFFFCFCFC, 0xFFFFFDFFFFF8F8F8, 0xFFFFFDFFFFF1F1F1,
+        0xFFFFFDFFFFE3E3E3, 0xFFFFFDFFFFC7C7C7, 0xFFFFFDFFFF8F8F8F, 0xFFFFFDFFFF1F1F1F, 0xFFFFFDFFFF3F3F3F,
+        0xFFFFFDFFFCFCFCFF, 0xFFFFFDFFF8F8F8FF, 0xFFFFFDFFF1F1F1FF, 0xFFFFFDFFE3E3E3FF, 0xFFFFFDFFC7C7C7FF,
+        0xFFFFFDFF8F8F8FFF, 0xFFFFFDFF1F1F1FFF, 0xFFFFFDFF3F3F3FFF, 0xFFFFFDFCFCFCFFFF, 0xFFFFFDF8F8F8FFFF,
+        0xFFFFFDF1F1F1FFFF, 0xFFFFFDE3E3E3FFFF, 0xFFFFFDC7C7C7FFFF, 0xFFFFFD8F8F8FFFFF, 0xFFFFFD1F1F1FFFFF,
+        0xFFFFFD3F3F3FFFFF, 0x0007040400000000, 0x0007000000000000, 0x0007010100000000, 0x070F010300000000,
+        0x0F1F050707000000, 0xFFFF8D8F8FFFFFFF, 0xFFFF1D1F1FFFFFFF, 0xFFFF3D3F3FFFFFFF, 0x0004040000000000,
+        0x0000000000000000, 0x0001010000000000, 0x0703010300000000, 0x0F07050707000000, 0xFF8F8D8FFFFFFFFF,
+        0xFF1F1D1FFFFFFFFF, 0xFF3F3D3FFFFFFFFF, 0x0004000000000000, 0x0000000000000000, 0x0001010000000000,
+        0x0303010F00000000, 0x0707051F07000000, 0x8F8F8DFFFFFFFFFF, 0x1F1F1DFFFFFFFFFF, 0x3F3F3DFFFFFFFFFF,
+        0x0000050000000000, 0x0000000000000000, 0x0101050000000000, 0x0303090F00000000, 0x07071D1F1F000000,
+        0x8F8FFDFFFFFFFFFF, 0x1F1FFDFFFFFFFFFF, 0x3F3FFDFFFFFFFFFF, 0xFFFFFBFFFFFFFCFC, 0xFFFFFBFFFFFFF8F8,
+        0xFFFFFBFFFFFFF1F1, 0xFFFFFBFFFFFFE3E3, 0xFFFFFBFFFFFFC7C7, 0xFFFFFBFFFFFF8F8F, 0xFFFFFBFFFFFF1F1F,
+        0xFFFFFBFFFFFF3F3F, 0xFFFFFBFFFFFCFCFC, 0xFFFFFBFFFFF8F8F8, 0xFFFFFBFFFFF1F1F1, 0xFFFFFBFFFFE3E3E3,
+        0xFFFFFBFFFFC7C7C7, 0xFFFFFBFFFF8F8F8F, 0xFFFFFBFFFF1F1F1F, 0xFFFFFBFFFF3F3F3F, 0xFFFFFBFFFCFCFCFF,
+        0xFFFFFBFFF8F8F8FF, 0xFFFFFBFFF1F1F1FF, 0xFFFFFBFFE3E3E3FF, 0xFFFFFBFFC7C7C7FF, 0xFFFFFBFF8F8F8FFF,
+        0xFFFFFBFF1F1F1FFF, 0xFFFFFBFF3F3F3FFF, 0xFFFFFBFCFCFCFFFF, 0xFFFFFBF8F8F8FFFF, 0xFFFFFBF1F1F1FFFF,
+        0xFFFFFBE3E3E3FFFF, 0xFFFFFBC7C7C7FFFF, 0xFFFFFB8F8F8FFFFF, 0xFFFFFB1F1F1FFFFF, 0xFFFFFB3F3F3FFFFF,
+        0xFFFFF8FCFCFFFFFF, 0xFFFFF8F8F8FFFFFF, 0xFFFFF1F1F1FFFFFF, 0xFFFFE3E3E3FFFFFF, 0xFFFFC3C7C7FFFFFF,
+        0xFFFF8B8F8FFFFFFF, 0xFFFF1B1F1FFFFFFF, 0xFFFF3B3F3FFFFFFF, 0x3F3C383C3E000000, 0x1E18181800000000,
+        0x0000000000000000, 0x0F03030300000000, 0x1F0703070F000000, 0xFF8F8B8FFFFFFFFF, 0xFF1F1B1FFFFFFFFF,
+        0xFF3F3B3FFFFFFFFF, 0x3C3C383F3F000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0707033F3F000000, 0x8F8F8BFFFFFFFFFF, 0x1F1F1BFFFFFFFFFF, 0x3F3F3BFFFFFFFFFF, 0x3C3C3B3F3F000000,
+        0x1818191F00000000, 0x00000A0000000000, 0x0303131F00000000, 0x07073B3F3F000000, 0x8F8FFBFFFFFFFFFF,
+        0x1F1FFBFFFFFFFFFF, 0x3F3FFBFFFFFFFFFF, 0xFFFFFBFFFFFFFCFC, 0xFFFFFBFFFFFFF8F8, 0xFFFFFBFFFFFFF1F1,
+        0xFFFFFBFFFFFFE3E3, 0xFFFFFBFFFFFFC7C7, 0xFFFFFBFFFFFF8F8F, 0xFFFFFBFFFFFF1F1F, 0xFFFFFBFFFFFF3F3F,
+        0xFFFFFBFFFFFCFCFC, 0xFFFFFBFFFFF8F8F8, 0xFFFFFBFFFFF1F1F1, 0xFFFFFBFFFFE3E3E3, 0xFFFFFBFFFFC7C7C7,
+        0xFFFFFBFFFF8F8F8F, 0xFFFFFBFFFF1F1F1F, 0xFFFFFBFFFF3F3F3F, 0xFFFFFBFFFCFCFCFF, 0xFFFFFBFFF8F8F8FF,
+        0xFFFFFBFFF1F1F1FF, 0xFFFFFBFFE3E3E3FF, 0xFFFFFBFFC7C7C7FF, 0xFFFFFBFF8F8F8FFF, 0xFFFFFBFF1F1F1FFF,
+        0xFFFFFBFF3F3F3FFF, 0xFFFFFBFCFCFCFFFF, 0xFFFFFBF8F8F8FFFF, 0xFFFFFBF1F1F1FFFF, 0xFFFFFBE3E3E3FFFF,
+        0xFFFFFBC7C7C7FFFF, 0xFFFFFB8F8F8FFFFF, 0xFFFFFB1F1F1FFFFF, 0xFFFFFB3F3F3FFFFF, 0x1E1F181C00000000,
+        0x000E080800000000, 0x000E000000000000, 0x000E020200000000, 0x0F1F030700000000, 0x1F3F0B0F0F000000,
+        0xFFFF1B1F1FFFFFFF, 0xFFFF3B3F3FFFFFFF, 0x1E1C181C00000000, 0x0008080000000000, 0x0000000000000000,
+        0x0002020000000000, 0x0F07030700000000, 0x1F0F0B0F0F000000, 0xFF1F1B1FFFFFFFFF, 0xFF3F3B3FFFFFFFFF,
+        0x1C1C181F00000000, 0x0008080000000000, 0x0000000000000000, 0x0002020000000000, 0x0707031F00000000,
+        0x0F0F0B3F0F000000, 0x1F1F1BFFFFFFFFFF, 0x3F3F3BFFFFFFFFFF, 0x1C1C191F00000000, 0x08080A0000000000,
+        0x0000000000000000, 0x02020A0000000000, 0x0707131F00000000, 0x0F0F3B3F3F000000, 0x1F1FFBFFFFFFFFFF,
+        0x3F3FFBFFFFFFFFFF, 0xFFFFF7FFFFFFFCFC, 0xFFFFF7FFFFFFF8F8, 0xFFFFF7FFFFFFF1F1, 0xFFFFF7FFFFFFE3E3,
+        0xFFFFF7FFFFFFC7C7, 0xFFFFF7FFFFFF8F8F, 0xFFFFF7FFFFFF1F1F, 0xFFFFF7FFFFFF3F3F, 0xFFFFF7FFFFFCFCFC,
+        0xFFFFF7FFFFF8F8F8, 0xFFFFF7FFFFF1F1F1, 0xFFFFF7FFFFE3E3E3, 0xFFFFF7FFFFC7C7C7, 0xFFFFF7FFFF8F8F8F,
+        0xFFFFF7FFFF1F1F1F, 0xFFFFF7FFFF3F3F3F, 0xFFFFF7FFFCFCFCFF, 0xFFFFF7FFF8F8F8FF, 0xFFFFF7FFF1F1F1FF,
+        0xFFFFF7FFE3E3E3FF, 0xFFFFF7FFC7C7C7FF, 0xFFFFF7FF8F8F8FFF, 0xFFFFF7FF1F1F1FFF, 0xFFFFF7FF3F3F3FFF,
+        0xFFFFF7FCFCFCFFFF, 0xFFFFF7F8F8F8FFFF, 0xFFFFF7F1F1F1FFFF, 0xFFFFF7E3E3E3FFFF, 0xFFFFF7C7C7C7FFFF,
+        0xFFFFF78F8F8FFFFF, 0xFFFFF71F1F1FFFFF, 0xFFFFF73F3F3FFFFF, 0xFFFFF4FCFCFFFFFF, 0xFFFFF0F8F8FFFFFF,
+        0xFFFFF1F1F1FFFFFF, 0xFFFFE3E3E3FFFFFF, 0xFFFFC7C7C7FFFFFF, 0xFFFF878F8FFFFFFF, 0xFFFF171F1FFFFFFF,
+        0xFFFF373F3FFFFFFF, 0xFFFCF4FCFFFFFFFF, 0x7E7870787C000000, 0x3C30303000000000, 0x0000000000000000,
+        0x1E06060600000000, 0x3F0F070F1F000000, 0xFF1F171FFFFFFFFF, 0xFF3F373FFFFFFFFF, 0xFCFCF4FFFFFFFFFF,
+        0x7878707F7F000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0F0F077F7F000000,
+        0x1F1F17FFFFFFFFFF, 0x3F3F37FFFFFFFFFF, 0xFCFCF7FFFFFFFFFF, 0x7878777F7F000000, 0x3030323E00000000,
+        0x0000140000000000, 0x0606263E00000000, 0x0F0F777F7F000000, 0x1F1FF7FFFFFFFFFF, 0x3F3FF7FFFFFFFFFF,
+        0xFFFFF7FFFFFFFCFC, 0xFFFFF7FFFFFFF8F8, 0xFFFFF7FFFFFFF1F1, 0xFFFFF7FFFFFFE3E3, 0xFFFFF7FFFFFFC7C7,
+        0xFFFFF7FFFFFF8F8F, 0xFFFFF7FFFFFF1F1F, 0xFFFFF7FFFFFF3F3F, 0xFFFFF7FFFFFCFCFC, 0xFFFFF7FFFFF8F8F8,
+        0xFFFFF7FFFFF1F1F1, 0xFFFFF7FFFFE3E3E3, 0xFFFFF7FFFFC7C7C7, 0xFFFFF7FFFF8F8F8F, 0xFFFFF7FFFF1F1F1F,
+        0xFFFFF7FFFF3F3F3F, 0xFFFFF7FFFCFCFCFF, 0xFFFFF7FFF8F8F8FF, 0xFFFFF7FFF1F1F1FF, 0xFFFFF7FFE3E3E3FF,
+        0xFFFFF7FFC7C7C7FF, 0xFFFFF7FF8F8F8FFF, 0xFFFFF7FF1F1F1FFF, 0xFFFFF7FF3F3F3FFF, 0xFFFFF7FCFCFCFFFF,
+        0xFFFFF7F8F8F8FFFF, 0xFFFFF7F1F1F1FFFF, 0xFFFFF7E3E3E3FFFF, 0xFFFFF7C7C7C7FFFF, 0xFFFFF78F8F8FFFFF,
+        0xFFFFF71F1F1FFFFF, 0xFFFFF73F3F3FFFFF, 0x7E7F747C7C000000, 0x3C3E303800000000, 0x001C101000000000,
+        0x001C000000000000, 0x001C040400000000, 0x1E3E060E00000000, 0x3F7F171F1F000000, 0xFFFF373F3FFFFFFF,
+        0x7E7C747C7C000000, 0x3C38303800000000, 0x0010100000000000, 0x0000000000000000, 0x0004040000000000,
+        0x1E0E060E00000000, 0x3F1F171F1F000000, 0xFF3F373FFFFFFFFF, 0x7C7C747F7C000000, 0x3838303E00000000,
+        0x0010100000000000, 0x0000000000000000, 0x0004040000000000, 0x0E0E063E00000000, 0x1F1F177F1F000000,
+        0x3F3F37FFFFFFFFFF, 0x7C7C777F7F000000, 0x3838323E00000000, 0x1010140000000000, 0x0000000000000000,
+        0x0404140000000000, 0x0E0E263E00000000, 0x1F1F777F7F000000, 0x3F3FF7FFFFFFFFFF, 0xFFFFFFFEFFFFFCFC,
+        0xFFFFFFFEFFFFF8F8, 0xFFFFFFFEFFFFF1F1, 0xFFFFFFFEFFFFE3E3, 0xFFFFFFFEFFFFC7C7, 0xFFFFFFFEFFFF8F8F,
+        0xFFFFFFFEFFFF1F1F, 0xFFFFFFFEFFFF3F3F, 0xFFFFFFFEFFFCFCFC, 0xFFFFFFFEFFF8F8F8, 0xFFFFFFFEFFF1F1F1,
+        0xFFFFFFFEFFE3E3E3, 0xFFFFFFFEFFC7C7C7, 0xFFFFFFFEFF8F8F8F, 0xFFFFFFFEFF1F1F1F, 0xFFFFFFFEFF3F3F3F,
+        0xFFFFFFFEFCFCFCFF, 0xFFFFFFFEF8F8F8FF, 0xFFFFFFFEF1F1F1FF, 0xFFFFFFFEE3E3E3FF, 0xFFFFFFFEC7C7C7FF,
+        0xFFFFFFFE8F8F8FFF, 0xFFFFFFFE1F1F1FFF, 0xFFFFFFFE3F3F3FFF, 0xFFFFFFFCFCFCFFFF, 0xFFFFFFF8F8F8FFFF,
+        0xFFFFFFF0F1F1FFFF, 0xFFFFFFE2E3E3FFFF, 0xFFFFFFC6C7C7FFFF, 0xFFFFFF8E8F8FFFFF, 0xFFFFFF1E1F1FFFFF,
+        0xFFFFFF3E3F3FFFFF, 0x0000000000000000, 0x0003000000000000, 0x0707010000000000, 0x0F0F030203000000,
+        0xFFFFC7C6C7FFFFFF, 0xFFFF8F8E8FFFFFFF, 0xFFFF1F1E1FFFFFFF, 0xFFFF3F3E3FFFFFFF, 0x0000000000000000,
+        0x0000000000000000, 0x0200000000000000, 0x0703030200000000, 0xFFC7C7C6FFFFFFFF, 0xFF8F8F8EFFFFFFFF,
+        0xFF1F1F1EFFFFFFFF, 0xFF3F3F3EFFFFFFFF, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0303030000000000, 0xC7C7C7FEFFFFFFFF, 0x8F8F8FFEFFFFFFFF, 0x1F1F1FFEFFFFFFFF, 0x3F3F3FFEFFFFFFFF,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0303070000000000, 0xC7C7FFFEFFFFFFFF,
+        0x8F8FFFFEFFFFFFFF, 0x1F1FFFFEFFFFFFFF, 0x3F3FFFFEFFFFFFFF, 0xFFFFFFFEFFFFFCFC, 0xFFFFFFFEFFFFF8F8,
+        0xFFFFFFFEFFFFF1F1, 0xFFFFFFFEFFFFE3E3, 0xFFFFFFFEFFFFC7C7, 0xFFFFFFFEFFFF8F8F, 0xFFFFFFFEFFFF1F1F,
+        0xFFFFFFFEFFFF3F3F, 0xFFFFFFFEFFFCFCFC, 0xFFFFFFFEFFF8F8F8, 0xFFFFFFFEFFF1F1F1, 0xFFFFFFFEFFE3E3E3,
+        0xFFFFFFFEFFC7C7C7, 0xFFFFFFFEFF8F8F8F, 0xFFFFFFFEFF1F1F1F, 0xFFFFFFFEFF3F3F3F, 0xFFFFFFFEFCFCFCFF,
+        0xFFFFFFFEF8F8F8FF, 0xFFFFFFFEF1F1F1FF, 0xFFFFFFFEE3E3E3FF, 0xFFFFFFFEC7C7C7FF, 0xFFFFFFFE8F8F8FFF,
+        0xFFFFFFFE1F1F1FFF, 0xFFFFFFFE3F3F3FFF, 0x0000030000000000, 0x0000030000000000, 0x0003070000000000,
+        0x07070F0202000000, 0x0F0F1F0607000000, 0xFFFFFF8E8F8FFFFF, 0xFFFFFF1E1F1FFFFF, 0xFFFFFF3E3F3FFFFF,
+        0x0000000000000000, 0x0000000000000000, 0x0002000000000000, 0x0206020200000000, 0x070F070600000000,
+        0xFFFF8F8E8FFFFFFF, 0xFFFF1F1E1FFFFFFF, 0xFFFF3F3E3FFFFFFF, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0202020000000000, 0x0707070000000000, 0xFF8F8F8EFFFFFFFF, 0xFF1F1F1EFFFFFFFF,
+        0xFF3F3F3EFFFFFFFF, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0202000000000000,
+        0x0707070000000000, 0x8F8F8FFEFFFFFFFF, 0x1F1F1FFEFFFFFFFF, 0x3F3F3FFEFFFFFFFF, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0202000000000000, 0x0707070000000000, 0x8F8FFFFEFFFFFFFF,
+        0x1F1FFFFEFFFFFFFF, 0x3F3FFFFEFFFFFFFF, 0xFFFFFFFDFFFFFCFC, 0xFFFFFFFDFFFFF8F8, 0xFFFFFFFDFFFFF1F1,
+        0xFFFFFFFDFFFFE3E3, 0xFFFFFFFDFFFFC7C7, 0xFFFFFFFDFFFF8F8F, 0xFFFFFFFDFFFF1F1F, 0xFFFFFFFDFFFF3F3F,
+        0xFFFFFFFDFFFCFCFC, 0xFFFFFFFDFFF8F8F8, 0xFFFFFFFDFFF1F1F1, 0xFFFFFFFDFFE3E3E3, 0xFFFFFFFDFFC7C7C7,
+        0xFFFFFFFDFF8F8F8F, 0xFFFFFFFDFF1F1F1F, 0xFFFFFFFDFF3F3F3F, 0xFFFFFFFDFCFCFCFF, 0xFFFFFFFDF8F8F8FF,
+        0xFFFFFFFDF1F1F1FF, 0xFFFFFFFDE3E3E3FF, 0xFFFFFFFDC7C7C7FF, 0xFFFFFFFD8F8F8FFF, 0xFFFFFFFD1F1F1FFF,
+        0xFFFFFFFD3F3F3FFF, 0xFFFFFFFCFCFCFFFF, 0xFFFFFFF8F8F8FFFF, 0xFFFFFFF1F1F1FFFF, 0xFFFFFFE1E3E3FFFF,
+        0xFFFFFFC5C7C7FFFF, 0xFFFFFF8D8F8FFFFF, 0xFFFFFF1D1F1FFFFF, 0xFFFFFF3D3F3FFFFF, 0x000F0C0C0C000000,
+        0x0000000000000000, 0x0007010101000000, 0x0F0F030103070000, 0x1F1F070507070000, 0xFFFF8F8D8FFFFFFF,
+        0xFFFF1F1D1FFFFFFF, 0xFFFF3F3D3FFFFFFF, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0703030103000000, 0x0F0707050F070000, 0xFF8F8F8DFFFFFFFF, 0xFF1F1F1DFFFFFFFF, 0xFF3F3F3DFFFFFFFF,
+        0x0C0C0C0C00000000, 0x0000000000000000, 0x0101010100000000, 0x0303030D03000000, 0x0707071D1F070000,
+        0x8F8F8FFDFFFFFFFF, 0x1F1F1FFDFFFFFFFF, 0x3F3F3FFDFFFFFFFF, 0x0C0C0F0D00000000, 0x00080F0D00000000,
+        0x01010F0D00000000, 0x03031F1D03000000, 0x07073F3D1F070000, 0x8F8FFFFDFFFFFFFF, 0x1F1FFFFDFFFFFFFF,
+        0x3F3FFFFDFFFFFFFF, 0xFFFFFFFDFFFFFCFC, 0xFFFFFFFDFFFFF8F8, 0xFFFFFFFDFFFFF1F1, 0xFFFFFFFDFFFFE3E3,
+        0xFFFFFFFDFFFFC7C7, 0xFFFFFFFDFFFF8F8F, 0xFFFFFFFDFFFF1F1F, 0xFFFFFFFDFFFF3F3F, 0xFFFFFFFDFFFCFCFC,
+        0xFFFFFFFDFFF8F8F8, 0xFFFFFFFDFFF1F1F1, 0xFFFFFFFDFFE3E3E3, 0xFFFFFFFDFFC7C7C7, 0xFFFFFFFDFF8F8F8F,
+        0xFFFFFFFDFF1F1F1F, 0xFFFFFFFDFF3F3F3F, 0xFFFFFFFDFCFCFCFF, 0xFFFFFFFDF8F8F8FF, 0xFFFFFFFDF1F1F1FF,
+        0xFFFFFFFDE3E3E3FF, 0xFFFFFFFDC7C7C7FF, 0xFFFFFFFD8F8F8FFF, 0xFFFFFFFD1F1F1FFF, 0xFFFFFFFD3F3F3FFF,
+        0x0000070404000000, 0x0000070000000000, 0x0000070101000000, 0x00070F0103000000, 0x0F0F1F0507070000,
+        0x1F1F3F0D0F070000, 0xFFFFFF1D1F1FFFFF, 0xFFFFFF3D3F3FFFFF, 0x0000040400000000, 0x0000000000000000,
+        0x0000010100000000, 0x0007030103000000, 0x070F070503000000, 0x0F1F0F0D0F070000, 0xFFFF1F1D1FFFFFFF,
+        0xFFFF3F3D3FFFFFFF, 0x0000040000000000, 0x0000000000000000, 0x0000010000000000, 0x0003030100000000,
+        0x0707070503000000, 0x0F0F0F0D0F070000, 0xFF1F1F1DFFFFFFFF, 0xFF3F3F3DFFFFFFFF, 0x0004040000000000,
+        0x0000000000000000, 0x0001010000000000, 0x0303030100000000, 0x0707070D03000000, 0x0F0F0F1D0F070000,
+        0x1F1F1FFDFFFFFFFF, 0x3F3F3FFDFFFFFFFF, 0x0404070000000000, 0x0000070000000000, 0x0101070000000000,
+        0x03030F0100000000, 0x07071F0D03000000, 0x0F0F3F1D1F070000, 0x1F1FFFFDFFFFFFFF, 0x3F3FFFFDFFFFFFFF,
+        0xFFFFFFFBFFFFFCFC, 0xFFFFFFFBFFFFF8F8, 0xFFFFFFFBFFFFF1F1, 0xFFFFFFFBFFFFE3E3, 0xFFFFFFFBFFFFC7C7,
+        0xFFFFFFFBFFFF8F8F, 0xFFFFFFFBFFFF1F1F, 0xFFFFFFFBFFFF3F3F, 0xFFFFFFFBFFFCFCFC, 0xFFFFFFFBFFF8F8F8,
+        0xFFFFFFFBFFF1F1F1, 0xFFFFFFFBFFE3E3E3, 0xFFFFFFFBFFC7C7C7, 0xFFFFFFFBFF8F8F8F, 0xFFFFFFFBFF1F1F1F,
+        0xFFFFFFFBFF3F3F3F, 0xFFFFFFFBFCFCFCFF, 0xFFFFFFFBF8F8F8FF, 0xFFFFFFFBF1F1F1FF, 0xFFFFFFFBE3E3E3FF,
+        0xFFFFFFFBC7C7C7FF, 0xFFFFFFFB8F8F8FFF, 0xFFFFFFFB1F1F1FFF, 0xFFFFFFFB3F3F3FFF, 0xFFFFFFF8FCFCFFFF,
+        0xFFFFFFF8F8F8FFFF, 0xFFFFFFF1F1F1FFFF, 0xFFFFFFE3E3E3FFFF, 0xFFFFFFC3C7C7FFFF, 0xFFFFFF8B8F8FFFFF,
+        0xFFFFFF1B1F1FFFFF, 0xFFFFFF3B3F3FFFFF, 0x3F3F3C383C3E0000, 0x001E181818000000, 0x0000000000000000,
+        0x000F030303000000, 0x1F1F0703070F0000, 0x3F3F0F0B0F0F0000, 0xFFFF1F1B1FFFFFFF, 0xFFFF3F3B3FFFFFFF,
+        0x3E3C3C383C000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0F07070307000000,
+        0x1F0F0F0B1F0F0000, 0xFF1F1F1BFFFFFFFF, 0xFF3F3F3BFFFFFFFF, 0x3C3C3C3B3C000000, 0x1818181800000000,
+        0x0000000000000000, 0x0303030300000000, 0x0707071B07000000, 0x0F0F0F3B3F0F0000, 0x1F1F1FFBFFFFFFFF,
+        0x3F3F3FFBFFFFFFFF, 0x3C3C3F3B3C000000, 0x18181F1B00000000, 0x00111F1B00000000, 0x03031F1B00000000,
+        0x07073F3B07000000, 0x0F0F7F7B3F0F0000, 0x1F1FFFFBFFFFFFFF, 0x3F3FFFFBFFFFFFFF, 0xFFFFFFFBFFFFFCFC,
+        0xFFFFFFFBFFFFF8F8, 0xFFFFFFFBFFFFF1F1, 0xFFFFFFFBFFFFE3E3, 0xFFFFFFFBFFFFC7C7, 0xFFFFFFFBFFFF8F8F,
+        0xFFFFFFFBFFFF1F1F, 0xFFFFFFFBFFFF3F3F, 0xFFFFFFFBFFFCFCFC, 0xFFFFFFFBFFF8F8F8, 0xFFFFFFFBFFF1F1F1,
+        0xFFFFFFFBFFE3E3E3, 0xFFFFFFFBFFC7C7C7, 0xFFFFFFFBFF8F8F8F, 0xFFFFFFFBFF1F1F1F, 0xFFFFFFFBFF3F3F3F,
+        0xFFFFFFFBFCFCFCFF, 0xFFFFFFFBF8F8F8FF, 0xFFFFFFFBF1F1F1FF, 0xFFFFFFFBE3E3E3FF, 0xFFFFFFFBC7C7C7FF,
+        0xFFFFFFFB8F8F8FFF, 0xFFFFFFFB1F1F1FFF, 0xFFFFFFFB3F3F3FFF, 0x001E1F181C000000, 0x00000E0808000000,
+        0x00000E0000000000, 0x00000E0202000000, 0x000F1F0307000000, 0x1F1F3F0B0F0F0000, 0x3F3F7F1B1F0F0000,
+        0xFFFFFF3B3F3FFFFF, 0x001E1C181C000000, 0x0000080800000000, 0x0000000000000000, 0x0000020200000000,
+        0x000F070307000000, 0x0F1F0F0B07000000, 0x1F3F1F1B1F0F0000, 0xFFFF3F3B3FFFFFFF, 0x001C1C1800000000,
+        0x0000080000000000, 0x0000000000000000, 0x0000020000000000, 0x0007070300000000, 0x0F0F0F0B07000000,
+        0x1F1F1F1B1F0F0000, 0xFF3F3F3BFFFFFFFF, 0x1C1C1C1800000000, 0x0008080000000000, 0x0000000000000000,
+        0x0002020000000000, 0x0707070300000000, 0x0F0F0F1B07000000, 0x1F1F1F3B1F0F0000, 0x3F3F3FFBFFFFFFFF,
+        0x1C1C1F1800000000, 0x08080E0000000000, 0x00000E0000000000, 0x02020E0000000000, 0x07071F0300000000,
+        0x0F0F3F1B07000000, 0x1F1F7F3B3F0F0000, 0x3F3FFFFBFFFFFFFF, 0xFFFFFFF7FFFFFCFC, 0xFFFFFFF7FFFFF8F8,
+        0xFFFFFFF7FFFFF1F1, 0xFFFFFFF7FFFFE3E3, 0xFFFFFFF7FFFFC7C7, 0xFFFFFFF7FFFF8F8F, 0xFFFFFFF7FFFF1F1F,
+        0xFFFFFFF7FFFF3F3F, 0xFFFFFFF7FFFCFCFC, 0xFFFFFFF7FFF8F8F8, 0xFFFFFFF7FFF1F1F1, 0xFFFFFFF7FFE3E3E3,
+        0xFFFFFFF7FFC7C7C7, 0xFFFFFFF7FF8F8F8F, 0xFFFFFFF7FF1F1F1F, 0xFFFFFFF7FF3F3F3F, 0xFFFFFFF7FCFCFCFF,
+        0xFFFFFFF7F8F8F8FF, 0xFFFFFFF7F1F1F1FF, 0xFFFFFFF7E3E3E3FF, 0xFFFFFFF7C7C7C7FF, 0xFFFFFFF78F8F8FFF,
+        0xFFFFFFF71F1F1FFF, 0xFFFFFFF73F3F3FFF, 0xFFFFFFF4FCFCFFFF, 0xFFFFFFF0F8F8FFFF, 0xFFFFFFF1F1F1FFFF,
+        0xFFFFFFE3E3E3FFFF, 0xFFFFFFC7C7C7FFFF, 0xFFFFFF878F8FFFFF, 0xFFFFFF171F1FFFFF, 0xFFFFFF373F3FFFFF,
+        0xFFFFFCF4FCFC0000, 0x7E7E7870787C0000, 0x003C303030000000, 0x0000000000000000, 0x001E060606000000,
+        0x3F3F0F070F1F0000, 0x7F7F1F171F1F0000, 0xFFFF3F373FFFFFFF, 0xFEFCFCF4FEFC0000, 0x7C78787078000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x1F0F0F070F000000, 0x3F1F1F173F1F0000,
+        0xFF3F3F37FFFFFFFF, 0xFCFCFCF7FFFC0000, 0x7878787678000000, 0x3030303000000000, 0x0000000000000000,
+        0x0606060600000000, 0x0F0F0F370F000000, 0x1F1F1F777F1F0000, 0x3F3F3FF7FFFFFFFF, 0xFCFCFFF7FFFC0000,
+        0x78787F7778000000, 0x30303E3600000000, 0x00223E3600000000, 0x06063E3600000000, 0x0F0F7F770F000000,
+        0x1F1FFFF77F1F0000, 0x3F3FFFF7FFFFFFFF, 0xFFFFFFF7FFFFFCFC, 0xFFFFFFF7FFFFF8F8, 0xFFFFFFF7FFFFF1F1,
+        0xFFFFFFF7FFFFE3E3, 0xFFFFFFF7FFFFC7C7, 0xFFFFFFF7FFFF8F8F, 0xFFFFFFF7FFFF1F1F, 0xFFFFFFF7FFFF3F3F,
+        0xFFFFFFF7FFFCFCFC, 0xFFFFFFF7FFF8F8F8, 0xFFFFFFF7FFF1F1F1, 0xFFFFFFF7FFE3E3E3, 0xFFFFFFF7FFC7C7C7,
+        0xFFFFFFF7FF8F8F8F, 0xFFFFFFF7FF1F1F1F, 0xFFFFFFF7FF3F3F3F, 0xFFFFFFF7FCFCFCFF, 0xFFFFFFF7F8F8F8FF,
+        0xFFFFFFF7F1F1F1FF, 0xFFFFFFF7E3E3E3FF, 0xFFFFFFF7C7C7C7FF, 0xFFFFFFF78F8F8FFF, 0xFFFFFFF71F1F1FFF,
+        0xFFFFFFF73F3F3FFF, 0x7E7E7F747C7C0000, 0x003C3E3038000000, 0x00001C1010000000, 0x00001C0000000000,
+        0x00001C0404000000, 0x001E3E060E000000, 0x3F3F7F171F1F0000, 0x7F7FFF373F1F0000, 0x7C7E7C7478000000,
+        0x003C383038000000, 0x0000101000000000, 0x0000000000000000, 0x0000040400000000, 0x001E0E060E000000,
+        0x1F3F1F170F000000, 0x3F7F3F373F1F0000, 0x7C7C7C7478000000, 0x0038383000000000, 0x0000100000000000,
+        0x0000000000000000, 0x0000040000000000, 0x000E0E0600000000, 0x1F1F1F170F000000, 0x3F3F3F373F1F0000,
+        0x7C7C7C7678000000, 0x3838383000000000, 0x0010100000000000, 0x0000000000000000, 0x0004040000000000,
+        0x0E0E0E0600000000, 0x1F1F1F370F000000, 0x3F3F3F773F1F0000, 0x7C7C7F7678000000, 0x38383E3000000000,
+        0x10101C0000000000, 0x00001C0000000000, 0x04041C0000000000, 0x0E0E3E0600000000, 0x1F1F7F370F000000,
+        0x3F3FFF777F1F0000, 0xFFFFFFFFFEFFFCFC, 0xFFFFFFFFFEFFF8F8, 0xFFFFFFFFFEFFF1F1, 0xFFFFFFFFFEFFE3E3,
+        0xFFFFFFFFFEFFC7C7, 0xFFFFFFFFFEFF8F8F, 0xFFFFFFFFFEFF1F1F, 0xFFFFFFFFFEFF3F3F, 0xFFFFFFFFFEFCFCFC,
+        0xFFFFFFFFFEF8F8F8, 0xFFFFFFFFFEF1F1F1, 0xFFFFFFFFFEE3E3E3, 0xFFFFFFFFFEC7C7C7, 0xFFFFFFFFFE8F8F8F,
+        0xFFFFFFFFFE1F1F1F, 0xFFFFFFFFFE3F3F3F, 0xFFFFFFFFFCFCFCFF, 0xFFFFFFFFF8F8F8FF, 0xFFFFFFFFF0F1F1FF,
+        0xFFFFFFFFE2E3E3FF, 0xFFFFFFFFC6C7C7FF, 0xFFFFFFFF8E8F8FFF, 0xFFFFFFFF1E1F1FFF, 0xFFFFFFFF3E3F3FFF,
+        0x0000000000000000, 0x0000030000000000, 0x0007070100000000, 0x070F0F0302030000, 0x0F1F1F0706070000,
+        0xFFFFFF8F8E8FFFFF, 0xFFFFFF1F1E1FFFFF, 0xFFFFFF3F3E3FFFFF, 0x0000000000000000, 0x0000000000000000,
+        0x0002000000000000, 0x0707030302000000, 0x0F0F070706000000, 0xFFFF8F8F8EFFFFFF, 0xFFFF1F1F1EFFFFFF,
+        0xFFFF3F3F3EFFFFFF, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0703030300000000,
+        0x0F07070700000000, 0xFF8F8F8FFEFFFFFF, 0xFF1F1F1FFEFFFFFF, 0xFF3F3F3FFEFFFFFF, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0303030000000000, 0x0707070F00000000, 0x8F8F8FFFFEFFFFFF,
+        0x1F1F1FFFFEFFFFFF, 0x3F3F3FFFFEFFFFFF, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0303070000000000, 0x07070F0F00000000, 0x8F8FFFFFFEFFFFFF, 0x1F1FFFFFFEFFFFFF, 0x3F3FFFFFFEFFFFFF,
+        0xFFFFFFFFFEFFFCFC, 0xFFFFFFFFFEFFF8F8, 0xFFFFFFFFFEFFF1F1, 0xFFFFFFFFFEFFE3E3, 0xFFFFFFFFFEFFC7C7,
+        0xFFFFFFFFFEFF8F8F, 0xFFFFFFFFFEFF1F1F, 0xFFFFFFFFFEFF3F3F, 0xFFFFFFFFFEFCFCFC, 0xFFFFFFFFFEF8F8F8,
+        0xFFFFFFFFFEF1F1F1, 0xFFFFFFFFFEE3E3E3, 0xFFFFFFFFFEC7C7C7, 0xFFFFFFFFFE8F8F8F, 0xFFFFFFFFFE1F1F1F,
+        0xFFFFFFFFFE3F3F3F, 0x0000000300000000, 0x0000000300000000, 0x0000030700000000, 0x0007070F02020000,
+        0x070F0F1F06070000, 0x0F1F1F3F0E0F0000, 0xFFFFFFFF1E1F1FFF, 0xFFFFFFFF3E3F3FFF, 0x0000000000000000,
+        0x0000000000000000, 0x0000020000000000, 0x0002060202000000, 0x07070F0706000000, 0x0F0F1F0F0E000000,
+        0xFFFFFF1F1E1FFFFF, 0xFFFFFF3F3E3FFFFF, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0002020200000000, 0x0707070700000000, 0x0F0F0F0F00000000, 0xFFFF1F1F1EFFFFFF, 0xFFFF3F3F3EFFFFFF,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0002020000000000, 0x0707070000000000,
+        0x0F0F0F0F00000000, 0xFF1F1F1FFEFFFFFF, 0xFF3F3F3FFEFFFFFF, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0002000000000000, 0x0707070000000000, 0x0F0F0F0F00000000, 0x1F1F1FFFFEFFFFFF,
+        0x3F3F3FFFFEFFFFFF, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0202000000000000,
+        0x0707070000000000, 0x0F0F0F0F00000000, 0x1F1FFFFFFEFFFFFF, 0x3F3FFFFFFEFFFFFF, 0xFFFFFFFFFDFFFCFC,
+        0xFFFFFFFFFDFFF8F8, 0xFFFFFFFFFDFFF1F1, 0xFFFFFFFFFDFFE3E3, 0xFFFFFFFFFDFFC7C7, 0xFFFFFFFFFDFF8F8F,
+        0xFFFFFFFFFDFF1F1F, 0xFFFFFFFFFDFF3F3F, 0xFFFFFFFFFDFCFCFC, 0xFFFFFFFFFDF8F8F8, 0xFFFFFFFFFDF1F1F1,
+        0xFFFFFFFFFDE3E3E3, 0xFFFFFFFFFDC7C7C7, 0xFFFFFFFFFD8F8F8F, 0xFFFFFFFFFD1F1F1F, 0xFFFFFFFFFD3F3F3F,
+        0xFFFFFFFFFCFCFCFF, 0xFFFFFFFFF8F8F8FF, 0xFFFFFFFFF1F1F1FF, 0xFFFFFFFFE1E3E3FF, 0xFFFFFFFFC5C7C7FF,
+        0xFFFFFFFF8D8F8FFF, 0xFFFFFFFF1D1F1FFF, 0xFFFFFFFF3D3F3FFF, 0x00000F0C0C0C0000, 0x0000000000000000,
+        0x0000070101010000, 0x000F0F0301030700, 0x0F1F1F0705070700, 0x1F3F3F0F0D0F1F0F, 0xFFFFFF1F1D1FFFFF,
+        0xFFFFFF3F3D3FFFFF, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0007030301030000,
+        0x0F0F0707050F0700, 0x1F1F0F0F0D1F1F0F, 0xFFFF1F1F1DFFFFFF, 0xFFFF3F3F3DFFFFFF, 0x000C0C0C0C000000,
+        0x0000000000000000, 0x0001010101000000, 0x0703030305030000, 0x0F0707070D0F0700, 0x1F0F0F0F1D1F1F0F,
+        0xFF1F1F1FFDFFFFFF, 0xFF3F3F3FFDFFFFFF, 0x0C0C0C0E0D000000, 0x0000000505000000, 0x0101010B0D000000,
+        0x030303171D030000, 0x0707072F3D0F0700, 0x0F0F0F5F7D1F1F0F, 0x1F1F1FFFFDFFFFFF, 0x3F3F3FFFFDFFFFFF,
+        0x0C0C0F0F0C000000, 0x00080F0F00000000, 0x01010F0F01000000, 0x03031F1F05030000, 0x07073F3F0D0F0700,
+        0x0F0F7F7F1D1F1F0F, 0x1F1FFFFFFDFFFFFF, 0x3F3FFFFFFDFFFFFF, 0xFFFFFFFFFDFFFCFC, 0xFFFFFFFFFDFFF8F8,
+        0xFFFFFFFFFDFFF1F1, 0xFFFFFFFFFDFFE3E3, 0xFFFFFFFFFDFFC7C7, 0xFFFFFFFFFDFF8F8F, 0xFFFFFFFFFDFF1F1F,
+        0xFFFFFFFFFDFF3F3F, 0xFFFFFFFFFDFCFCFC, 0xFFFFFFFFFDF8F8F8, 0xFFFFFFFFFDF1F1F1, 0xFFFFFFFFFDE3E3E3,
+        0xFFFFFFFFFDC7C7C7, 0xFFFFFFFFFD8F8F8F, 0xFFFFFFFFFD1F1F1F, 0xFFFFFFFFFD3F3F3F, 0x0000000704040000,
+        0x0000000700000000, 0x0000000701010000, 0x0000070F01030000, 0x000F0F1F05070700, 0x0F1F1F3F0D0F0700,
+        0x1F3F3F7F1D1F1F0F, 0xFFFFFFFF3D3F3FFF, 0x0000000404000000, 0x0000000000000000, 0x0000000101000000,
+        0x0000070301030000, 0x00070F0705030000, 0x0F0F1F0F0D0F0700, 0x1F1F3F1F1D1F1F0F, 0xFFFFFF3F3D3FFFFF,
+        0x0000000400000000, 0x0000000000000000, 0x0000000100000000, 0x0000030301000000, 0x0007070705030000,
+        0x0F0F0F0F0D0F0700, 0x1F1F1F1F1D1F1F0F, 0xFFFF3F3F3DFFFFFF, 0x0000040400000000, 0x0000000000000000,
+        0x0000010100000000, 0x0003030301000000, 0x0007070705030000, 0x0F0F0F0F0D0F0700, 0x1F1F1F1F1D1F1F0F,
+        0xFF3F3F3FFDFFFFFF, 0x0004040500000000, 0x0000000200000000, 0x0001010500000000, 0x0003030B01000000,
+        0x0707071705030000, 0x0F0F0F2F0D0F0700, 0x1F1F1F5F1D1F1F0F, 0x3F3F3FFFFDFFFFFF, 0x0404070400000000,
+        0x0000070000000000, 0x0101070100000000, 0x03030F0301000000, 0x07071F0705030000, 0x0F0F3F0F0D0F0700,
+        0x1F1F7F5F1D1F1F0F, 0x3F3FFFFFFDFFFFFF, 0xFFFFFFFFFBFFFCFC, 0xFFFFFFFFFBFFF8F8, 0xFFFFFFFFFBFFF1F1,
+        0xFFFFFFFFFBFFE3E3, 0xFFFFFFFFFBFFC7C7, 0xFFFFFFFFFBFF8F8F, 0xFFFFFFFFFBFF1F1F, 0xFFFFFFFFFBFF3F3F,
+        0xFFFFFFFFFBFCFCFC, 0xFFFFFFFFFBF8F8F8, 0xFFFFFFFFFBF1F1F1, 0xFFFFFFFFFBE3E3E3, 0xFFFFFFFFFBC7C7C7,
+        0xFFFFFFFFFB8F8F8F, 0xFFFFFFFFFB1F1F1F, 0xFFFFFFFFFB3F3F3F, 0xFFFFFFFFF8FCFCFF, 0xFFFFFFFFF8F8F8FF,
+        0xFFFFFFFFF1F1F1FF, 0xFFFFFFFFE3E3E3FF, 0xFFFFFFFFC3C7C7FF, 0xFFFFFFFF8B8F8FFF, 0xFFFFFFFF1B1F1FFF,
+        0xFFFFFFFF3B3F3FFF, 0x003F3F3C383C3E00, 0x00001E1818180000, 0x0000000000000000, 0x00000F0303030000,
+        0x001F1F0703070F00, 0x1F3F3F0F0B0F0F00, 0x3F7F7F1F1B1F3F1F, 0xFFFFFF3F3B3FFFFF, 0x003E3C3C383C0000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x000F070703070000, 0x1F1F0F0F0B1F0F00,
+        0x3F3F1F1F1B3F3F1F, 0xFFFF3F3F3BFFFFFF, 0x3E3C3C3C3A3C0000, 0x0018181818000000, 0x0000000000000000,
+        0x0003030303000000, 0x0F0707070B070000, 0x1F0F0F0F1B1F0F00, 0x3F1F1F1F3B3F3F1F, 0xFF3F3F3FFBFFFFFF,
+        0x3C3C3C3E3B3C0000, 0x1818181D1B000000, 0x0000000A0A000000, 0x030303171B000000, 0x0707072F3B070000,
+        0x0F0F0F5F7B1F0F00, 0x1F1F1FBFFB3F3F1F, 0x3F3F3FFFFBFFFFFF, 0x3C3C3F3F3A3C0000, 0x18181F1F18000000,
+        0x00111F1F00000000, 0x03031F1F03000000, 0x07073F3F0B070000, 0x0F0F7F7F1B1F0F00, 0x1F1FFFFF3B3F3F1F,
+        0x3F3FFFFFFBFFFFFF, 0xFFFFFFFFFBFFFCFC, 0xFFFFFFFFFBFFF8F8, 0xFFFFFFFFFBFFF1F1, 0xFFFFFFFFFBFFE3E3,
+        0xFFFFFFFFFBFFC7C7, 0xFFFFFFFFFBFF8F8F, 0xFFFFFFFFFBFF1F1F, 0xFFFFFFFFFBFF3F3F, 0xFFFFFFFFFBFCFCFC,
+        0xFFFFFFFFFBF8F8F8, 0xFFFFFFFFFBF1F1F1, 0xFFFFFFFFFBE3E3E3, 0xFFFFFFFFFBC7C7C7, 0xFFFFFFFFFB8F8F8F,
+        0xFFFFFFFFFB1F1F1F, 0xFFFFFFFFFB3F3F3F, 0x00001E1F181C0000, 0x0000000E08080000, 0x0000000E00000000,
+        0x0000000E02020000, 0x00000F1F03070000, 0x001F1F3F0B0F0F00, 0x1F3F3F7F1B1F0F00, 0x3F7F7FFF3B3F3F1F,
+        0x00001E1C181C0000, 0x0000000808000000, 0x0000000000000000, 0x0000000202000000, 0x00000F0703070000,
+        0x000F1F0F0B070000, 0x1F1F3F1F1B1F0F00, 0x3F3F7F3F3B3F3F1F, 0x00001C1C18000000, 0x0000000800000000,
+        0x0000000000000000, 0x0000000200000000, 0x0000070703000000, 0x000F0F0F0B070000, 0x1F1F1F1F1B1F0F00,
+        0x3F3F3F3F3B3F3F1F, 0x001C1C1C18000000, 0x0000080800000000, 0x0000000000000000, 0x0000020200000000,
+        0x0007070703000000, 0x000F0F0F0B070000, 0x1F1F1F1F1B1F0F00, 0x3F3F3F3F3B3F3F1F, 0x001C1C1D18000000,
+        0x0008080A00000000, 0x0000000400000000, 0x0002020A00000000, 0x0007071703000000, 0x0F0F0F2F0B070000,
+        0x1F1F1F5F1B1F0F00, 0x3F3F3FBF3B3F3F1F, 0x1C1C1F1C18000000, 0x08080E0800000000, 0x00000E0000000000,
+        0x02020E0200000000, 0x07071F0703000000, 0x0F0F3F0F0B070000, 0x1F1F7F1F1B1F0F00, 0x3F3FFFBF3B3F3F1F,
+        0xFFFFFFFFF7FFFCFC, 0xFFFFFFFFF7FFF8F8, 0xFFFFFFFFF7FFF1F1, 0xFFFFFFFFF7FFE3E3, 0xFFFFFFFFF7FFC7C7,
+        0xFFFFFFFFF7FF8F8F, 0xFFFFFFFFF7FF1F1F, 0xFFFFFFFFF7FF3F3F, 0xFFFFFFFFF7FCFCFC, 0xFFFFFFFFF7F8F8F8,
+        0xFFFFFFFFF7F1F1F1, 0xFFFFFFFFF7E3E3E3, 0xFFFFFFFFF7C7C7C7, 0xFFFFFFFFF78F8F8F, 0xFFFFFFFFF71F1F1F,
+        0xFFFFFFFFF73F3F3F, 0xFFFFFFFFF4FCFCFF, 0xFFFFFFFFF0F8F8FF, 0xFFFFFFFFF1F1F1FF, 0xFFFFFFFFE3E3E3FF,
+        0xFFFFFFFFC7C7C7FF, 0xFFFFFFFF878F8FFF, 0xFFFFFFFF171F1FFF, 0xFFFFFFFF373F3FFF, 0xFEFFFFFCF4FCFC00,
+        0x007E7E7870787C00, 0x00003C3030300000, 0x0000000000000000, 0x00001E0606060000, 0x003F3F0F070F1F00,
+        0x3F7F7F1F171F1F00, 0x7FFFFF3F373F7F3F, 0xFEFEFCFCF4FEFC00, 0x007C787870780000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x001F0F0F070F0000, 0x3F3F1F1F173F1F00, 0x7F7F3F3F377F7F3F,
+        0xFEFCFCFCF6FEFC00, 0x7C78787874780000, 0x0030303030000000, 0x0000000000000000, 0x0006060606000000,
+        0x1F0F0F0F170F0000, 0x3F1F1F1F373F1F00, 0x7F3F3F3F777F7F3F, 0xFCFCFCFEF7FEFC00, 0x7878787D77780000,
+        0x3030303A36000000, 0x0000001414000000, 0x0606062E36000000, 0x0F0F0F5F770F0000, 0x1F1F1FBFF73F1F00,
+        0x3F3F3F7FF77F7F3F, 0xFCFCFFFFF6FEFC00, 0x78787F7F74780000, 0x30303E3E30000000, 0x00223E3E00000000,
+        0x06063E3E06000000, 0x0F0F7F7F170F0000, 0x1F1FFFFF373F1F00, 0x3F3FFFFF777F7F3F, 0xFFFFFFFFF7FFFCFC,
+        0xFFFFFFFFF7FFF8F8, 0xFFFFFFFFF7FFF1F1, 0xFFFFFFFFF7FFE3E3, 0xFFFFFFFFF7FFC7C7, 0xFFFFFFFFF7FF8F8F,
+        0xFFFFFFFFF7FF1F1F, 0xFFFFFFFFF7FF3F3F, 0xFFFFFFFFF7FCFCFC, 0xFFFFFFFFF7F8F8F8, 0xFFFFFFFFF7F1F1F1,
+        0xFFFFFFFFF7E3E3E3, 0xFFFFFFFFF7C7C7C7, 0xFFFFFFFFF78F8F8F, 0xFFFFFFFFF71F1F1F, 0xFFFFFFFFF73F3F3F,
+        0x007E7E7F747C7C00, 0x00003C3E30380000, 0x0000001C10100000, 0x0000001C00000000, 0x0000001C04040000,
+        0x00001E3E060E0000, 0x003F3F7F171F1F00, 0x3F7F7FFF373F1F00, 0x007C7E7C74780000, 0x00003C3830380000,
+        0x0000001010000000, 0x0000000000000000, 0x0000000404000000, 0x00001E0E060E0000, 0x001F3F1F170F0000,
+        0x3F3F7F3F373F1F00, 0x007C7C7C74780000, 0x0000383830000000, 0x0000001000000000, 0x0000000000000000,
+        0x0000000400000000, 0x00000E0E06000000, 0x001F1F1F170F0000, 0x3F3F3F3F373F1F00, 0x007C7C7C74780000,
+        0x0038383830000000, 0x0000101000000000, 0x0000000000000000, 0x0000040400000000, 0x000E0E0E06000000,
+        0x001F1F1F170F0000, 0x3F3F3F3F373F1F00, 0x7C7C7C7D74780000, 0x0038383A30000000, 0x0010101400000000,
+        0x0000000800000000, 0x0004041400000000, 0x000E0E2E06000000, 0x1F1F1F5F170F0000, 0x3F3F3FBF373F1F00,
+        0x7C7C7F7C74780000, 0x38383E3830000000, 0x10101C1000000000, 0x00001C0000000000, 0x04041C0400000000,
+        0x0E0E3E0E06000000, 0x1F1F7F1F170F0000, 0x3F3FFF3F373F1F00, 0xFFFFFFFFFFFEFCFC, 0xFFFFFFFFFFFEF8F8,
+        0xFFFFFFFFFFFEF1F1, 0xFFFFFFFFFFFEE3E3, 0xFFFFFFFFFFFEC7C7, 0xFFFFFFFFFFFE8F8F, 0xFFFFFFFFFFFE1F1F,
+        0xFFFFFFFFFFFE3F3F, 0xFFFFFFFFFFFCFCFC, 0xFFFFFFFFFFF8F8F8, 0xFFFFFFFFFFF0F1F1, 0xFFFFFFFFFFE2E3E3,
+        0xFFFFFFFFFFC6C7C7, 0xFFFFFFFFFF8E8F8F, 0xFFFFFFFFFF1E1F1F, 0xFFFFFFFFFF3E3F3F, 0x0000000000000000,
+        0x0000000300000000, 0x0000070701000000, 0x00070F0F03020300, 0x0F0F1F1F07060700, 0x1F1F3F3F0F0E0F00,
+        0xFFFFFFFF1F1E1FFF, 0xFFFFFFFF3F3E3FFF, 0x0000000000000000, 0x0000000000000000, 0x0000020000000000,
+        0x0007070303020000, 0x0F0F0F0707060000, 0x1F1F1F0F0F0E0000, 0xFFFFFF1F1F1EFFFF, 0xFFFFFF3F3F3EFFFF,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0007030303000000, 0x0F0F070707000000,
+        0x1F1F0F0F0F000000, 0xFFFF1F1F1FFEFFFF, 0xFFFF3F3F3FFEFFFF, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0003030300000000, 0x0F07070700000000, 0x1F0F0F0F1F000000, 0xFF1F1F1FFFFEFFFF,
+        0xFF3F3F3FFFFEFFFF, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0303030000000000,
+        0x0707070F00000000, 0x0F0F0F1F1F000000, 0x1F1F1FFFFFFEFFFF, 0x3F3F3FFFFFFEFFFF, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0303070000000000, 0x07070F0F00000000, 0x0F0F1F1F1F000000,
+        0x1F1FFFFFFFFEFFFF, 0x3F3FFFFFFFFEFFFF, 0xFFFFFFFFFFFEFCFC, 0xFFFFFFFFFFFEF8F8, 0xFFFFFFFFFFFEF1F1,
+        0xFFFFFFFFFFFEE3E3, 0xFFFFFFFFFFFEC7C7, 0xFFFFFFFFFFFE8F8F, 0xFFFFFFFFFFFE1F1F, 0xFFFFFFFFFFFE3F3F,
+        0x0000000003000000, 0x0000000003000000, 0x0000000307000000, 0x000007070F020200, 0x00070F0F1F060700,
+        0x0F0F1F1F3F0E0F00, 0x1F1F3F3F7F1E1F00, 0xFFFFFFFFFF3E3F3F, 0x0000000000000000, 0x0000000000000000,
+        0x0000000200000000, 0x0000020602020000, 0x0007070F07060000, 0x0F0F0F1F0F0E0000, 0x1F1F1F3F1F1E0000,
+        0xFFFFFFFF3F3E3FFF, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000020202000000,
+        0x0007070707000000, 0x0F0F0F0F0F000000, 0x1F1F1F1F1F000000, 0xFFFFFF3F3F3EFFFF, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000020200000000, 0x0007070700000000, 0x0F0F0F0F00000000,
+        0x1F1F1F1F1F000000, 0xFFFF3F3F3FFEFFFF, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000020000000000, 0x0007070000000000, 0x0F0F0F0F00000000, 0x1F1F1F1F1F000000, 0xFF3F3F3FFFFEFFFF,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0002000000000000, 0x0007070000000000,
+        0x0F0F0F0F00000000, 0x1F1F1F1F1F000000, 0x3F3F3FFFFFFEFFFF, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0202000000000000, 0x0707070000000000, 0x0F0F0F0F00000000, 0x1F1F1F1F1F000000,
+        0x3F3FFFFFFFFEFFFF, 0xFFFFFFFFFFFDFCFC, 0xFFFFFFFFFFFDF8F8, 0xFFFFFFFFFFFDF1F1, 0xFFFFFFFFFFFDE3E3,
+        0xFFFFFFFFFFFDC7C7, 0xFFFFFFFFFFFD8F8F, 0xFFFFFFFFFFFD1F1F, 0xFFFFFFFFFFFD3F3F, 0xFFFFFFFFFFFCFCFC,
+        0xFFFFFFFFFFF8F8F8, 0xFFFFFFFFFFF1F1F1, 0xFFFFFFFFFFE1E3E3, 0xFFFFFFFFFFC5C7C7, 0xFFFFFFFFFF8D8F8F,
+        0xFFFFFFFFFF1D1F1F, 0xFFFFFFFFFF3D3F3F, 0x0000000F0C0C0C00, 0x0000000000000000, 0x0000000701010100,
+        0x00000F0F03010307, 0x000F1F1F07050707, 0x1F1F3F3F0F0D0F1F, 0x3F3F7F7F1F1D1F3F, 0xFFFFFFFF3F3D3FFF,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000070303010300, 0x000F0F0707050F07,
+        0x1F1F1F0F0F0D1F1F, 0x3F3F3F1F1F1D3F3F, 0xFFFFFF3F3F3DFFFF, 0x00000C0C0C0C0000, 0x0000000000000000,
+        0x0000010101010000, 0x0007030303050300, 0x000F0707070D0F07, 0x1F1F0F0F0F1D1F1F, 0x3F3F1F1F1F3D3F3F,
+        0xFFFF3F3F3FFDFFFF, 0x000C0C0C0E0D0000, 0x0000000005050000, 0x000101010B0D0000, 0x00030303171D0300,
+        0x0F0707072F3D0F07, 0x1F0F0F0F5F7D1F1F, 0x3F1F1F1FBFFD3F3F, 0xFF3F3F3FFFFDFFFF, 0x0C0C0C0F0F0C0000,
+        0x0000080F0F000000, 0x0101010F0F010000, 0x0303031F1F050300, 0x0707073F3F0D0F07, 0x0F0F0F7F7F1D1F1F,
+        0x1F1F1FFFFF3D3F3F, 0x3F3F3FFFFFFDFFFF, 0x0C1C1F1F1F1D0000, 0x00181F1F1F1D0000, 0x01111F1F1F1D0000,
+        0x03031F1F1F1D0300, 0x07073F3F3F3D0F07, 0x0F0F7F7F7F7D1F1F, 0x1F1FFFFFFFFD3F3F, 0x3F3FFFFFFFFDFFFF,
+        0xFFFFFFFFFFFDFCFC, 0xFFFFFFFFFFFDF8F8, 0xFFFFFFFFFFFDF1F1, 0xFFFFFFFFFFFDE3E3, 0xFFFFFFFFFFFDC7C7,
+        0xFFFFFFFFFFFD8F8F, 0xFFFFFFFFFFFD1F1F, 0xFFFFFFFFFFFD3F3F, 0x0000000007040400, 0x0000000007000000,
+        0x0000000007010100, 0x000000070F010300, 0x00000F0F1F050707, 0x000F1F1F3F0D0F07, 0x1F1F3F3F7F1D1F1F,
+        0x3F3F7F7FFF3D3F3F, 0x0000000004040000, 0x0000000000000000, 0x0000000001010000, 0x0000000703010300,
+        0x0000070F07050300, 0x000F0F1F0F0D0F07, 0x1F1F1F3F1F1D1F1F, 0x3F3F3F7F3F3D3F3F, 0x0000000004000000,
+        0x0000000000000000, 0x0000000001000000, 0x0000000303010000, 0x0000070707050300, 0x000F0F0F0F0D0F07,
+        0x1F1F1F1F1F1D1F1F, 0x3F3F3F3F3F3D3F3F, 0x0000000404000000, 0x0000000000000000, 0x0000000101000000,
+        0x0000030303010000, 0x0000070707050300, 0x000F0F0F0F0D0F07, 0x1F1F1F1F1F1D1F1F, 0x3F3F3F3F3F3D3F3F,
+        0x0000040405000000, 0x0000000002000000, 0x0000010105000000, 0x000003030B010000, 0x0007070717050300,
+        0x000F0F0F2F0D0F07, 0x1F1F1F1F5F1D1F1F, 0x3F3F3F3FBF3D3F3F, 0x0004040704000000, 0x0000000700000000,
+        0x0001010701000000, 0x0003030F03010000, 0x0007071F07050300, 0x0F0F0F3F0F0D0F07, 0x1F1F1F7F1F1D1F1F,
+        0x3F3F3FFFBF3D3F3F, 0x04040F0F0F000000, 0x00000F0F0F000000, 0x01010F0F0F000000, 0x03030F0F0F010000,
+        0x07071F1F1F050300, 0x0F0F3F3F3F0D0F07, 0x1F1F7F7F7F1D1F1F, 0x3F3FFFFFFF3D3F3F, 0xFFFFFFFFFFFBFCFC,
+        0xFFFFFFFFFFFBF8F8, 0xFFFFFFFFFFFBF1F1, 0xFFFFFFFFFFFBE3E3, 0xFFFFFFFFFFFBC7C7, 0xFFFFFFFFFFFB8F8F,
+        0xFFFFFFFFFFFB1F1F, 0xFFFFFFFFFFFB3F3F, 0xFFFFFFFFFFF8FCFC, 0xFFFFFFFFFFF8F8F8, 0xFFFFFFFFFFF1F1F1,
+        0xFFFFFFFFFFE3E3E3, 0xFFFFFFFFFFC3C7C7, 0xFFFFFFFFFF8B8F8F, 0xFFFFFFFFFF1B1F1F, 0xFFFFFFFFFF3B3F3F,
+        0x00003F3F3C383C3E, 0x0000001E18181800, 0x0000000000000000, 0x0000000F03030300, 0x00001F1F0703070F,
+        0x001F3F3F0F0B0F0F, 0x3F3F7F7F1F1B1F3F, 0x7F7FFFFF3F3B3F7F, 0x00003E3C3C383C00, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x00000F0707030700, 0x001F1F0F0F0B1F0F, 0x3F3F3F1F1F1B3F3F,
+        0x7F7F7F3F3F3B7F7F, 0x003E3C3C3C3A3C00, 0x0000181818180000, 0x0000000000000000, 0x0000030303030000,
+        0x000F0707070B0700, 0x001F0F0F0F1B1F0F, 0x3F3F1F1F1F3B3F3F, 0x7F7F3F3F3F7B7F7F, 0x003C3C3C3E3B3C00,
+        0x001818181D1B0000, 0x000000000A0A0000, 0x00030303171B0000, 0x000707072F3B0700, 0x1F0F0F0F5F7B1F0F,
+        0x3F1F1F1FBFFB3F3F, 0x7F3F3F3F7FFB7F7F, 0x3C3C3C3F3F3A3C00, 0x1818181F1F180000, 0x0000111F1F000000,
+        0x0303031F1F030000, 0x0707073F3F0B0700, 0x0F0F0F7F7F1B1F0F, 0x1F1F1FFFFF3B3F3F, 0x3F3F3FFFFF7B7F7F,
+        0x3C3C3F3F3F3B3C00, 0x18383F3F3F3B0000, 0x00313F3F3F3B0000, 0x03233F3F3F3B0000, 0x07073F3F3F3B0700,
+        0x0F0F7F7F7F7B1F0F, 0x1F1FFFFFFFFB3F3F, 0x3F3FFFFFFFFB7F7F, 0xFFFFFFFFFFFBFCFC, 0xFFFFFFFFFFFBF8F8,
+        0xFFFFFFFFFFFBF1F1, 0xFFFFFFFFFFFBE3E3, 0xFFFFFFFFFFFBC7C7, 0xFFFFFFFFFFFB8F8F, 0xFFFFFFFFFFFB1F1F,
+        0xFFFFFFFFFFFB3F3F, 0x0000001E1F181C00, 0x000000000E080800, 0x000000000E000000, 0x000000000E020200,
+        0x0000000F1F030700, 0x00001F1F3F0B0F0F, 0x001F3F3F7F1B1F0F, 0x3F3F7F7FFF3B3F3F, 0x0000001E1C181C00,
+        0x0000000008080000, 0x0000000000000000, 0x0000000002020000, 0x0000000F07030700, 0x00000F1F0F0B0700,
+        0x001F1F3F1F1B1F0F, 0x3F3F3F7F3F3B3F3F, 0x0000001C1C180000, 0x0000000008000000, 0x0000000000000000,
+        0x0000000002000000, 0x0000000707030000, 0x00000F0F0F0B0700, 0x001F1F1F1F1B1F0F, 0x3F3F3F3F3F3B3F3F,
+        0x00001C1C1C180000, 0x0000000808000000, 0x0000000000000000, 0x0000000202000000, 0x0000070707030000,
+        0x00000F0F0F0B0700, 0x001F1F1F1F1B1F0F, 0x3F3F3F3F3F3B3F3F, 0x00001C1C1D180000, 0x000008080A000000,
+        0x0000000004000000, 0x000002020A000000, 0x0000070717030000, 0x000F0F0F2F0B0700, 0x001F1F1F5F1B1F0F,
+        0x3F3F3F3FBF3B3F3F, 0x001C1C1F1C180000, 0x0008080E08000000, 0x0000000E00000000, 0x0002020E02000000,
+        0x0007071F07030000, 0x000F0F3F0F0B0700, 0x1F1F1F7F1F1B1F0F, 0x3F3F3FFF3F3B3F3F, 0x1C1C1F1F1F180000,
+        0x08081F1F1F000000, 0x00001F1F1F000000, 0x02021F1F1F000000, 0x07071F1F1F030000, 0x0F0F3F3F3F0B0700,
+        0x1F1F7F7F7F1B1F0F, 0x3F3FFFFFFF3B3F3F, 0xFFFFFFFFFFF7FCFC, 0xFFFFFFFFFFF7F8F8, 0xFFFFFFFFFFF7F1F1,
+        0xFFFFFFFFFFF7E3E3, 0xFFFFFFFFFFF7C7C7, 0xFFFFFFFFFFF78F8F, 0xFFFFFFFFFFF71F1F, 0xFFFFFFFFFFF73F3F,
+        0xFFFFFFFFFFF4FCFC, 0xFFFFFFFFFFF0F8F8, 0xFFFFFFFFFFF1F1F1, 0xFFFFFFFFFFE3E3E3, 0xFFFFFFFFFFC7C7C7,
+        0xFFFFFFFFFF878F8F, 0xFFFFFFFFFF171F1F, 0xFFFFFFFFFF373F3F, 0x00FEFFFFFCF4FCFC, 0x00007E7E7870787C,
+        0x0000003C30303000, 0x0000000000000000, 0x0000001E06060600, 0x00003F3F0F070F1F, 0x003F7F7F1F171F1F,
+        0x7F7FFFFF3F373F7F, 0x00FEFEFCFCF4FEFC, 0x00007C7878707800, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x00001F0F0F070F00, 0x003F3F1F1F173F1F, 0x7F7F7F3F3F377F7F, 0x00FEFCFCFCF6FEFC,
+        0x007C787878747800, 0x0000303030300000, 0x0000000000000000, 0x0000060606060000, 0x001F0F0F0F170F00,
+        0x003F1F1F1F373F1F, 0x7F7F3F3F3F777F7F, 0xFEFCFCFCFEF7FEFC, 0x007878787D777800, 0x003030303A360000,
+        0x0000000014140000, 0x000606062E360000, 0x000F0F0F5F770F00, 0x3F1F1F1FBFF73F1F, 0x7F3F3F3F7FF77F7F,
+        0xFCFCFCFFFFF6FEFC, 0x7878787F7F747800, 0x3030303E3E300000, 0x0000223E3E000000, 0x0606063E3E060000,
+        0x0F0F0F7F7F170F00, 0x1F1F1FFFFF373F1F, 0x3F3F3FFFFF777F7F, 0xFCFCFFFFFFF7FEFC, 0x78787F7F7F777800,
+        0x30717F7F7F770000, 0x00637F7F7F770000, 0x06477F7F7F770000, 0x0F0F7F7F7F770F00, 0x1F1FFFFFFFF73F1F,
+        0x3F3FFFFFFFF77F7F, 0xFFFFFFFFFFF7FCFC, 0xFFFFFFFFFFF7F8F8, 0xFFFFFFFFFFF7F1F1, 0xFFFFFFFFFFF7E3E3,
+        0xFFFFFFFFFFF7C7C7, 0xFFFFFFFFFFF78F8F, 0xFFFFFFFFFFF71F1F, 0xFFFFFFFFFFF73F3F, 0x00007E7E7F747C7C,
+        0x0000003C3E303800, 0x000000001C101000, 0x000000001C000000, 0x000000001C040400, 0x0000001E3E060E00,
+        0x00003F3F7F171F1F, 0x003F7F7FFF373F1F, 0x00007C7E7C747800, 0x0000003C38303800, 0x0000000010100000,
+        0x0000000000000000, 0x0000000004040000, 0x0000001E0E060E00, 0x00001F3F1F170F00, 0x003F3F7F3F373F1F,
+        0x00007C7C7C747800, 0x0000003838300000, 0x0000000010000000, 0x0000000000000000, 0x0000000004000000,
+        0x0000000E0E060000, 0x00001F1F1F170F00, 0x003F3F3F3F373F1F, 0x00007C7C7C747800, 0x0000383838300000,
+        0x0000001010000000, 0x0000000000000000, 0x0000000404000000, 0x00000E0E0E060000, 0x00001F1F1F170F00,
+        0x003F3F3F3F373F1F, 0x007C7C7C7D747800, 0x000038383A300000, 0x0000101014000000, 0x0000000008000000,
+        0x0000040414000000, 0x00000E0E2E060000, 0x001F1F1F5F170F00, 0x003F3F3FBF373F1F, 0x007C7C7F7C747800,
+        0x0038383E38300000, 0x0010101C10000000, 0x0000001C00000000, 0x0004041C04000000, 0x000E0E3E0E060000,
+        0x001F1F7F1F170F00, 0x3F3F3FFF3F373F1F, 0x7C7C7F7F7F747800, 0x38383E3E3E300000, 0x10103E3E3E000000,
+        0x00003E3E3E000000, 0x04043E3E3E000000, 0x0E0E3E3E3E060000, 0x1F1F7F7F7F170F00, 0x3F3FFFFFFF373F1F,
+        0xFFFFFFFFFFFFFCFC, 0xFFFFFFFFFFFFF8F8, 0xFFFFFFFFFFFFF0F1, 0xFFFFFFFFFFFFE2E3, 0xFFFFFFFFFFFFC6C7,
+        0xFFFFFFFFFFFF8E8F, 0xFFFFFFFFFFFF1E1F, 0xFFFFFFFFFFFF3E3F, 0x0000000000000000, 0xFFFFFFFFFFF8F8F8,
+        0xFFFFFFFFFFF1F0F1, 0xFFFFFFFFFFE3E2E3, 0xFFFFFFFFFFC7C6C7, 0xFFFFFFFFFF8F8E8F, 0xFFFFFFFFFF1F1E1F,
+        0xFFFFFFFFFF3F3E3F, 0x0000000000000000, 0x0000000000000000, 0x00000F0F01000000, 0x00071F1F03030200,
+        0x0F0F3F3F07070600, 0x1F1F7F7F0F0F0E00, 0xFFFFFFFF1F1F1EFF, 0xFFFFFFFF3F3F3EFF, 0x0000000000000000,
+        0x0000000000000000, 0x0000020000000000, 0x0007070303030000, 0x0F0F0F0707070000, 0x1F1F1F0F0F0F0000,
+        0xFFFFFF1F1F1FFEFF, 0xFFFFFF3F3F3FFEFF, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0007030303000000, 0x0F0F070707000000, 0x1F1F0F0F0F000000, 0xFFFF1F1F1FFFFEFF, 0xFFFF3F3F3FFFFEFF,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0003030300000000, 0x0F07070700000000,
+        0x1F0F0F0F1F000000, 0xFF1F1F1FFFFFFEFF, 0xFF3F3F3FFFFFFEFF, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0303030000000000, 0x0707070F00000000, 0x0F0F0F1F1F000000, 0x1F1F1FFFFFFFFEFF,
+        0x3F3F3FFFFFFFFEFF, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0303070000000000,
+        0x07070F0F00000000, 0x0F0F1F1F1F000000, 0x1F1FFFFFFFFFFEFF, 0x3F3FFFFFFFFFFEFF, 0x0000000000030000,
+        0x0000000000030000, 0xFFFFFFFFFFFFF0F1, 0xFFFFFFFFFFFFE2E3, 0xFFFFFFFFFFFFC6C7, 0xFFFFFFFFFFFF8E8F,
+        0xFFFFFFFFFFFF1E1F, 0xFFFFFFFFFFFF3E3F, 0x0000000000000000, 0x0000000000000000, 0x00000F0F0F000000,
+        0x00000F0F0F020200, 0x00071F1F1F070600, 0x0F0F3F3F3F0F0E00, 0x1F1F7F7F7F1F1E00, 0xFFFFFFFFFF3F3E3F,
+        0x0000000000000000, 0x0000000000000000, 0x0000000600000000, 0x0000020E02020000, 0x0007071F07070000,
+        0x0F0F0F3F0F0F0000, 0x1F1F1F7F1F1F0000, 0xFFFFFFFF3F3F3EFF, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000020202000000, 0x0007070707000000, 0x0F0F0F0F0F000000, 0x1F1F1F1F1F000000,
+        0xFFFFFF3F3F3FFEFF, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000020200000000,
+        0x0007070700000000, 0x0F0F0F0F00000000, 0x1F1F1F1F1F000000, 0xFFFF3F3F3FFFFEFF, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000020000000000, 0x0007070000000000, 0x0F0F0F0F00000000,
+        0x1F1F1F1F1F000000, 0xFF3F3F3FFFFFFEFF, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0002000000000000, 0x0007070000000000, 0x0F0F0F0F00000000, 0x1F1F1F1F1F000000, 0x3F3F3FFFFFFFFEFF,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0202000000000000, 0x0707070000000000,
+        0x0F0F0F0F00000000, 0x1F1F1F1F1F000000, 0x3F3FFFFFFFFFFEFF, 0xFFFFFFFFFFFFFCFC, 0xFFFFFFFFFFFFF8F8,
+        0xFFFFFFFFFFFFF1F1, 0xFFFFFFFFFFFFE1E3, 0xFFFFFFFFFFFFC5C7, 0xFFFFFFFFFFFF8D8F, 0xFFFFFFFFFFFF1D1F,
+        0xFFFFFFFFFFFF3D3F, 0xFFFFFFFFFFFCFCFC, 0x0000000000000000, 0xFFFFFFFFFFF1F1F1, 0xFFFFFFFFFFE3E1E3,
+        0xFFFFFFFFFFC7C5C7, 0xFFFFFFFFFF8F8D8F, 0xFFFFFFFFFF1F1D1F, 0xFFFFFFFFFF3F3D3F, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x00001F1F03030103, 0x000F3F3F0707050F, 0x1F1F7F7F0F0F0D1F,
+        0x3F3FFFFF1F1F1D3F, 0xFFFFFFFF3F3F3DFF, 0x0000000C0C0C0C00, 0x0000000000000000, 0x0000000101010100,
+        0x0000070303030503, 0x000F0F0707070D0F, 0x1F1F1F0F0F0F1D1F, 0x3F3F3F1F1F1F3D3F, 0xFFFFFF3F3F3FFDFF,
+        0x00000C0C0C0E0D00, 0x0000000000050500, 0x00000101010B0D00, 0x0000030303171D03, 0x000F0707072F3D0F,
+        0x1F1F0F0F0F5F7D1F, 0x3F3F1F1F1FBFFD3F, 0xFFFF3F3F3FFFFDFF, 0x000C0C0C0F0F0C00, 0x000000080F0F0000,
+        0x000101010F0F0100, 0x000303031F1F0503, 0x000707073F3F0D0F, 0x1F0F0F0F7F7F1D1F, 0x3F1F1F1FFFFF3D3F,
+        0xFF3F3F3FFFFFFDFF, 0x0C0C1C1F1F1F1D00, 0x0000181F1F1F1D00, 0x0101111F1F1F1D00, 0x0303031F1F1F1D03,
+        0x0707073F3F3F3D0F, 0x0F0F0F7F7F7F7D1F, 0x1F1F1FFFFFFFFD3F, 0x3F3F3FFFFFFFFDFF, 0x0C3C3F3F3F3F3D3F,
+        0x00383F3F3F3F3D3F, 0x01313F3F3F3F3D3F, 0x03233F3F3F3F3D3F, 0x07073F3F3F3F3D3F, 0x0F0F7F7F7F7F7D7F,
+        0x1F1FFFFFFFFFFDFF, 0x3F3FFFFFFFFFFDFF, 0x0000000000070404, 0x0000000000070000, 0x0000000000070101,
+        0xFFFFFFFFFFFFE1E3, 0xFFFFFFFFFFFFC5C7, 0xFFFFFFFFFFFF8D8F, 0xFFFFFFFFFFFF1D1F, 0xFFFFFFFFFFFF3D3F,
+        0x0000000000040400, 0x0000000000000000, 0x0000000000010100, 0x00001F1F1F030103, 0x00001F1F1F070503,
+        0x000F3F3F3F0F0D0F, 0x1F1F7F7F7F1F1D1F, 0x3F3FFFFFFF3F3D3F, 0x0000000000040000, 0x0000000000000000,
+        0x0000000000010000, 0x0000000F03030100, 0x0000071F07070503, 0x000F0F3F0F0F0D0F, 0x1F1F1F7F1F1F1D1F,
+        0x3F3F3FFF3F3F3D3F, 0x0000000004040000, 0x0000000000000000, 0x0000000001010000, 0x0000000303030100,
+        0x0000070707070503, 0x000F0F0F0F0F0D0F, 0x1F1F1F1F1F1F1D1F, 0x3F3F3F3F3F3F3D3F, 0x0000000404050000,
+        0x0000000000020000, 0x0000000101050000, 0x00000003030B0100, 0x0000070707170503, 0x000F0F0F0F2F0D0F,
+        0x1F1F1F1F1F5F1D1F, 0x3F3F3F3F3FBF3D3F, 0x0000040407040000, 0x0000000007000000, 0x0000010107010000,
+        0x000003030F030100, 0x000007071F070503, 0x000F0F0F3F0F0D0F, 0x1F1F1F1F7F1F1D1F, 0x3F3F3F3FFFBF3D3F,
+        0x0004040F0F0F0000, 0x0000000F0F0F0000, 0x0001010F0F0F0000, 0x0003030F0F0F0100, 0x0007071F1F1F0503,
+        0x000F0F3F3F3F0D0F, 0x1F1F1F7F7F7F1D1F, 0x3F3F3FFFFFFF3D3F, 0x04041F1F1F1F1D00, 0x00001F1F1F1F1D00,
+        0x01011F1F1F1F1D00, 0x03031F1F1F1F1D00, 0x07071F1F1F1F1D03, 0x0F0F3F3F3F3F3D0F, 0x1F1F7F7F7F7F7D1F,
+        0x3F3FFFFFFFFFFD3F, 0xFFFFFFFFFFFFF8FC, 0xFFFFFFFFFFFFF8F8, 0xFFFFFFFFFFFFF1F1, 0xFFFFFFFFFFFFE3E3,
+        0xFFFFFFFFFFFFC3C7, 0xFFFFFFFFFFFF8B8F, 0xFFFFFFFFFFFF1B1F, 0xFFFFFFFFFFFF3B3F, 0xFFFFFFFFFFFCF8FC,
+        0xFFFFFFFFFFF8F8F8, 0x0000000000000000, 0xFFFFFFFFFFE3E3E3, 0xFFFFFFFFFFC7C3C7, 0xFFFFFFFFFF8F8B8F,
+        0xFFFFFFFFFF1F1B1F, 0xFFFFFFFFFF3F3B3F, 0x00003F3F3C3C383C, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x00003F3F07070307, 0x001F7F7F0F0F0B1F, 0x3F3FFFFF1F1F1B3F, 0x7F7FFFFF3F3F3B7F,
+        0x00003E3C3C3C3A3C, 0x0000001818181800, 0x0000000000000000, 0x0000000303030300, 0x00000F0707070B07,
+        0x001F1F0F0F0F1B1F, 0x3F3F3F1F1F1F3B3F, 0x7F7F7F3F3F3F7B7F, 0x00003C3C3C3E3B3C, 0x00001818181D1B00,
+        0x00000000000A0A00, 0x0000030303171B00, 0x00000707072F3B07, 0x001F0F0F0F5F7B1F, 0x3F3F1F1F1FBFFB3F,
+        0x7F7F3F3F3F7FFB7F, 0x003C3C3C3F3F3A3C, 0x001818181F1F1800, 0x000000111F1F0000, 0x000303031F1F0300,
+        0x000707073F3F0B07, 0x000F0F0F7F7F1B1F, 0x3F1F1F1FFFFF3B3F, 0x7F3F3F3FFFFF7B7F, 0x3C3C3C3F3F3F3B3C,
+        0x1818383F3F3F3B00, 0x0000313F3F3F3B00, 0x0303233F3F3F3B00, 0x0707073F3F3F3B07, 0x0F0F0F7F7F7F7B1F,
+        0x1F1F1FFFFFFFFB3F, 0x3F3F3FFFFFFFFB7F, 0x3C7C7F7F7F7F7B7F, 0x18787F7F7F7F7B7F, 0x00717F7F7F7F7B7F,
+        0x03637F7F7F7F7B7F, 0x07477F7F7F7F7B7F, 0x0F0F7F7F7F7F7B7F, 0x1F1FFFFFFFFFFBFF, 0x3F3FFFFFFFFFFBFF,
+        0xFFFFFFFFFFFFF8FC, 0x00000000000E0808, 0x00000000000E0000, 0x00000000000E0202, 0xFFFFFFFFFFFFC3C7,
+        0xFFFFFFFFFFFF8B8F, 0xFFFFFFFFFFFF1B1F, 0xFFFFFFFFFFFF3B3F, 0x00003F3F3F3C383C, 0x0000000000080800,
+        0x0000000000000000, 0x0000000000020200, 0x00003F3F3F070307, 0x00003F3F3F0F0B07, 0x001F7F7F7F1F1B1F,
+        0x3F3FFFFFFF3F3B3F, 0x0000001F1C1C1800, 0x0000000000080000, 0x0000000000000000, 0x0000000000020000,
+        0x0000001F07070300, 0x00000F3F0F0F0B07, 0x001F1F7F1F1F1B1F, 0x3F3F3FFF3F3F3B3F, 0x0000001C1C1C1800,
+        0x0000000008080000, 0x0000000000000000, 0x0000000002020000, 0x0000000707070300, 0x00000F0F0F0F0B07,
+        0x001F1F1F1F1F1B1F, 0x3F3F3F3F3F3F3B3F, 0x0000001C1C1D1800, 0x00000008080A0000, 0x0000000000040000,
+        0x00000002020A0000, 0x0000000707170300, 0x00000F0F0F2F0B07, 0x001F1F1F1F5F1B1F, 0x3F3F3F3F3FBF3B3F,
+        0x00001C1C1F1C1800, 0x000008080E080000, 0x000000000E000000, 0x000002020E020000, 0x000007071F070300,
+        0x00000F0F3F0F0B07, 0x001F1F1F7F1F1B1F, 0x3F3F3F3FFF3F3B3F, 0x001C1C1F1F1F1800, 0x0008081F1F1F0000,
+        0x0000001F1F1F0000, 0x0002021F1F1F0000, 0x0007071F1F1F0300, 0x000F0F3F3F3F0B07, 0x001F1F7F7F7F1B1F,
+        0x3F3F3FFFFFFF3B3F, 0x1C1C3F3F3F3F3B00, 0x08083F3F3F3F3B00, 0x00003F3F3F3F3B00, 0x02023F3F3F3F3B00,
+        0x07073F3F3F3F3B00, 0x0F0F3F3F3F3F3B07, 0x1F1F7F7F7F7F7B1F, 0x3F3FFFFFFFFFFB3F, 0xFFFFFFFFFFFFF4FC,
+        0xFFFFFFFFFFFFF0F8, 0xFFFFFFFFFFFFF1F1, 0xFFFFFFFFFFFFE3E3, 0xFFFFFFFFFFFFC7C7, 0xFFFFFFFFFFFF878F,
+        0xFFFFFFFFFFFF171F, 0xFFFFFFFFFFFF373F, 0xFFFFFFFFFFFCF4FC, 0xFFFFFFFFFFF8F0F8, 0xFFFFFFFFFFF1F1F1,
+        0x0000000000000000, 0xFFFFFFFFFFC7C7C7, 0xFFFFFFFFFF8F878F, 0xFFFFFFFFFF1F171F, 0xFFFFFFFFFF3F373F,
+        0x00FEFFFFFCFCF4FE, 0x00007F7F78787078, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x00007F7F0F0F070F, 0x003FFFFF1F1F173F, 0x7F7FFFFF3F3F377F, 0x00FEFEFCFCFCF6FE, 0x00007C7878787478,
+        0x0000003030303000, 0x0000000000000000, 0x0000000606060600, 0x00001F0F0F0F170F, 0x003F3F1F1F1F373F,
+        0x7F7F7F3F3F3F777F, 0x00FEFCFCFCFEF7FE, 0x00007878787D7778, 0x00003030303A3600, 0x0000000000141400,
+        0x00000606062E3600, 0x00000F0F0F5F770F, 0x003F1F1F1FBFF73F, 0x7F7F3F3F3F7FF77F, 0x00FCFCFCFFFFF6FE,
+        0x007878787F7F7478, 0x003030303E3E3000, 0x000000223E3E0000, 0x000606063E3E0600, 0x000F0F0F7F7F170F,
+        0x001F1F1FFFFF373F, 0x7F3F3F3FFFFF777F, 0xFCFCFCFFFFFFF7FE, 0x7878787F7F7F7778, 0x3030717F7F7F7700,
+        0x0000637F7F7F7700, 0x0606477F7F7F7700, 0x0F0F0F7F7F7F770F, 0x1F1F1FFFFFFFF73F, 0x3F3F3FFFFFFFF77F,
+        0xFCFCFFFFFFFFF7FF, 0x78F8FFFFFFFFF7FF, 0x30F1FFFFFFFFF7FF, 0x00E3FFFFFFFFF7FF, 0x06C7FFFFFFFFF7FF,
+        0x0F8FFFFFFFFFF7FF, 0x1F1FFFFFFFFFF7FF, 0x3F3FFFFFFFFFF7FF, 0xFFFFFFFFFFFFF4FC, 0xFFFFFFFFFFFFF0F8,
+        0x00000000001C1010, 0x00000000001C0000, 0x00000000001C0404, 0xFFFFFFFFFFFF878F, 0xFFFFFFFFFFFF171F,
+        0xFFFFFFFFFFFF373F, 0x00007F7F7F7C7478, 0x00007F7F7F787078, 0x0000000000101000, 0x0000000000000000,
+        0x0000000000040400, 0x00007F7F7F0F070F, 0x00007F7F7F1F170F, 0x003FFFFFFF3F373F, 0x00007C7F7C7C7478,
+        0x0000003E38383000, 0x0000000000100000, 0x0000000000000000, 0x0000000000040000, 0x0000003E0E0E0600,
+        0x00001F7F1F1F170F, 0x003F3FFF3F3F373F, 0x00007C7C7C7C7478, 0x0000003838383000, 0x0000000010100000,
+        0x0000000000000000, 0x0000000004040000, 0x0000000E0E0E0600, 0x00001F1F1F1F170F, 0x003F3F3F3F3F373F,
+        0x00007C7C7C7D7478, 0x00000038383A3000, 0x0000001010140000, 0x0000000000080000, 0x0000000404140000,
+        0x0000000E0E2E0600, 0x00001F1F1F5F170F, 0x003F3F3F3FBF373F, 0x00007C7C7F7C7478, 0x000038383E383000,
+        0x000010101C100000, 0x000000001C000000, 0x000004041C040000, 0x00000E0E3E0E0600, 0x00001F1F7F1F170F,
+        0x003F3F3FFF3F373F, 0x007C7C7F7F7F7478, 0x0038383E3E3E3000, 0x0010103E3E3E0000, 0x0000003E3E3E0000,
+        0x0004043E3E3E0000, 0x000E0E3E3E3E0600, 0x001F1F7F7F7F170F, 0x003F3FFFFFFF373F, 0x7C7C7F7F7F7F7778,
+        0x38387F7F7F7F7700, 0x10107F7F7F7F7700, 0x00007F7F7F7F7700, 0x04047F7F7F7F7700, 0x0E0E7F7F7F7F7700,
+        0x1F1F7F7F7F7F770F, 0x3F3FFFFFFFFFF73F};
+};
+
+}  // namespace chess
+
+
+
+namespace chess {
+/**
+ * @brief Stores a game as the index of each move among the legal moves of its position.
+ * The legal moves are sorted by their 16 bit encoding, so the format does not depend on the
+ * order of the move generator. Each index takes as many bits as needed for the number of legal
+ * moves (a forced move takes none), which comes to about 5-6 bits per ply in normal games.
+ *
+ * An encoded game is the number of plies as a varint followed by the bit packed indices,
+ * games can be appended to each other and read back one after another.
+ */
+class MoveIndexCodec {
+   public:
+    /**
+     * @brief Appends the encoded moves to out.
+     * @param board starting position
+     * @param moves
+     * @param count
+     * @param out
+     * @return false if one of the moves is not legal, out is left unchanged then
+     */
+    static bool encode(Board board, const Move* moves, std::size_t count, std::vector<std::uint8_t>& out) {
+        const auto start = out.size();
+
+        utils::writeVarint(count, [&out](std::uint8_t byte) { out.push_back(byte); });
+
+        BitWriter writer{out};
+        Movelist legal;
+
+        for (std::size_t i = 0; i < count; ++i) {
+            legal.clear();
+            movegen::legalmoves(legal, board);
+
+            // the index in sorted order is the number of legal moves with a smaller encoding
+            std::uint32_t index = 0;
+            bool found          = false;
+
+            for (const auto& move : legal) {
+                index += move.move() < moves[i].move();
+                found |= move == moves[i];
+            }
+
+            if (!found) {
+                out.resize(start);
+                return false;
+            }
+
+            writer.write(index, bitWidth(legal.size()));
+            board.makeMove(moves[i]);
+        }
+
+        writer.flush();
+        return true;
+    }
+
+    static bool encode(const Board& board, const std::vector<Move>& moves, std::vector<std::uint8_t>& out) {
+        return encode(board, moves.data(), moves.size(), out);
+    }
+
+    /**
+     * @brief Decodes one game and appends its moves to out.
+     * @param board starting position, the same as given to encode
+     * @param data
+     * @param size
+     * @param out
+     * @return the number of bytes read, 0 if the data is corrupt, out is left unchanged then
+     */
+    static std::size_t decode(Board board, const std::uint8_t* data, std::size_t size, std::vector<Move>& out) {
+        const auto start = out.size();
+
+        std::size_t pos     = 0;
+        std::uint64_t count = 0;
+
+        const auto varint = utils::readVarint(count, [&](std::uint8_t& byte) {
+            if (pos == size) return false;
+            byte = data[pos++];
+            return true;
+        });
+
+        if (!varint) return 0;
+
+        BitReader reader{data + pos, size - pos};
+        Movelist legal;
+
+        for (std::uint64_t i = 0; i < count; ++i) {
+            legal.clear();
+            movegen::legalmoves(legal, board);
+
+            std::uint32_t index = 0;
+
+            if (!reader.read(bitWidth(legal.size()), index) || index >= static_cast<std::uint32_t>(legal.size())) {
+                out.resize(start);
+                return 0;
+            }
+
+            // selecting the index-th smallest move is cheaper than sorting all of them
+            std::nth_element(legal.begin(), legal.begin() + index, legal.end(),
+                             [](const Move& a, const Move& b) { return a.move() < b.move(); });
+
+            out.push_back(legal[index]);
+            board.makeMove(legal[index]);
+        }
+
+        return pos + reader.bytesRead();
+    }
+
+    static std::size_t decode(const Board& board, const std::vector<std::uint8_t>& data, std::vector<Move>& out) {
+        return decode(board, data.data(), data.size(), out);
+    }
+
+   private:
+    // bits needed to store an index below n
+    static int bitWidth(int n) noexcept {
+        int bits = 0;
+        while ((1 << bits) < n) bits++;
+        return bits;
+    }
+
+    // least significant bit first
+    struct BitWriter {
+        std::vector<std::uint8_t>& out;
+        std::uint64_t buffer = 0;
+        int bits             = 0;
+
+        void write(std::uint32_t value, int width) {
+            buffer |= std::uint64_t(value) << bits;
+            bits += width;
+
+            while (bits >= 8) {
+                out.push_back(static_cast<std::uint8_t>(buffer));
+                buffer >>= 8;
+                bits -= 8;
+            }
+        }
+
+        void flush() {
+            if (bits > 0) out.push_back(static_cast<std::uint8_t>(buffer));
+        }
+    };
+
+    struct BitReader {
+        const std::uint8_t* data;
+        std::size_t size;
+        std::size_t pos      = 0;
+        std::uint64_t buffer = 0;
+        int bits             = 0;
+
+        bool read(int width, std::uint32_t& value) {
+            while (bits < width) {
+                if (pos == size) return false;
+                buffer |= std::uint64_t(data[pos++]) << bits;
+                bits += 8;
+            }
+
+            value = static_cast<std::uint32_t>(buffer & ((std::uint64_t(1) << width) - 1));
+            buffer >>= width;
+            bits -= width;
+            return true;
+        }
+
+        // partially used bytes count as read
+        std::size_t bytesRead() const noexcept { return pos; }
+    };
+};
+}  // namespace chess
+
+
+
+
+#ifdef CHESS_STATS
+#    include <algorithm>
+#    include <atomic>
+#    include <mutex>
+#    include <vector>
+#endif
+
+
+namespace chess {
+
+/**
+ * @brief Counters of the move generation hot paths, only collected if CHESS_STATS is defined.
+ * Every thread counts into its own slot, collect() adds up the slots of all threads, including
+ * those that already exited. Without the define all values stay zero and counting compiles to nothing.
+ */
+struct MovegenStats {
+    // calls of the move generator (legalmoves and anylegalmoves)
+    std::uint64_t generations = 0;
+    // generations that stopped after the king moves because of a double check
+    std::uint64_t double_check_exits = 0;
+    // calls of seenSquares
+    std::uint64_t seen_squares = 0;
+    // seenSquares calls that returned early, the king has no square to move to
+    std::uint64_t seen_squares_skipped = 0;
+    // calls of movegen::isLegal and how many moves it rejected
+    std::uint64_t is_legal       = 0;
+    std::uint64_t is_legal_false = 0;
+    // number of movelists filled by legalmoves, indexed by their size
+    std::array<std::uint64_t, constants::MAX_MOVES + 1> movelist_sizes = {};
+
+    MovegenStats& operator+=(const MovegenStats& other) noexcept {
+        generations += other.generations;
+        double_check_exits += other.double_check_exits;
+        seen_squares += other.seen_squares;
+        seen_squares_skipped += other.seen_squares_skipped;
+        is_legal += other.is_legal;
+        is_legal_false += other.is_legal_false;
+
+        for (std::size_t i = 0; i < movelist_sizes.size(); ++i) movelist_sizes[i] += other.movelist_sizes[i];
+
+        return *this;
+    }
+
+    /**
+     * @brief Sums the counters of all threads.
+     * @return
+     */
+    [[nodiscard]] static MovegenStats collect();
+
+    /**
+     * @brief Sets all counters back to zero. Counts of threads running at the same time may get lost.
+     */
+    static void reset();
+};
+
+namespace detail {
+
+enum class StatCounter {
+    GENERATIONS,
+    DOUBLE_CHECK_EXITS,
+    SEEN_SQUARES,
+    SEEN_SQUARES_SKIPPED,
+    IS_LEGAL,
+    IS_LEGAL_FALSE,
+    COUNT
+};
+
+#ifdef CHESS_STATS
+/**
+ * @brief Private class, the counters of one thread. Only the owning thread writes them, other
+ * threads read them in collect(), hence relaxed atomics without read-modify-write.
+ */
+class StatsSlot {
+   public:
+    StatsSlot() {
+        std::lock_guard<std::mutex> lock(mutex());
+        slots().push_back(this);
+    }
+
+    // the counts of an exiting thread are kept in the retired totals
+    ~StatsSlot() {
+        std::lock_guard<std::mutex> lock(mutex());
+        retired() += read();
+        slots().erase(std::find(slots().begin(), slots().end(), this));
+    }
+
+    StatsSlot(const StatsSlot&)            = delete;
+    StatsSlot& operator=(const StatsSlot&) = delete;
+
+    static StatsSlot& local() {
+        thread_local StatsSlot slot;
+        return slot;
+    }
+
+    void count(StatCounter counter) noexcept { increment(counters_[static_cast<int>(counter)]); }
+
+    void countSize(int size) noexcept { increment(sizes_[size]); }
+
+    MovegenStats read() const noexcept {
+        MovegenStats stats;
+        stats.generations          = load(StatCounter::GENERATIONS);
+        stats.double_check_exits   = load(StatCounter::DOUBLE_CHECK_EXITS);
+        stats.seen_squares         = load(StatCounter::SEEN_SQUARES);
+        stats.seen_squares_skipped = load(StatCounter::SEEN_SQUARES_SKIPPED);
+        stats.is_legal             = load(StatCounter::IS_LEGAL);
+        stats.is_legal_false       = load(StatCounter::IS_LEGAL_FALSE);
+
+        for (std::size_t i = 0; i < sizes_.size(); ++i) {
+            stats.movelist_sizes[i] = sizes_[i].load(std::memory_order_relaxed);
+        }
+
+        return stats;
+    }
+
+    void clear() noexcept {
+        for (auto& counter : counters_) counter.store(0, std::memory_order_relaxed);
+        for (auto& size : sizes_) size.store(0, std::memory_order_relaxed);
+    }
+
+    static std::mutex& mutex() {
+        static std::mutex mutex;
+        return mutex;
+    }
+
+    static std::vector<StatsSlot*>& slots() {
+        static std::vector<StatsSlot*> slots;
+        return slots;
+    }
+
+    static MovegenStats& retired() {
+        static MovegenStats retired;
+        return retired;
+    }
+
+   private:
+    static void increment(std::atomic<std::uint64_t>& counter) noexcept {
+        counter.store(counter.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+    }
+
+    std::uint64_t load(StatCounter counter) const noexcept {
+        return counters_[static_cast<int>(counter)].load(std::memory_order_relaxed);
+    }
+
+    std::array<std::atomic<std::uint64_t>, static_cast<int>(StatCounter::COUNT)> counters_ = {};
+    std::array<std::atomic<std::uint64_t>, constants::MAX_MOVES + 1> sizes_              = {};
+};
+#endif
+
+inline void countStat([[maybe_unused]] StatCounter counter) noexcept {
+#ifdef CHESS_STATS
+    StatsSlot::local().count(counter);
+#endif
+}
+
+inline void countMovelistSize([[maybe_unused]] int size) noexcept {
+#ifdef CHESS_STATS
+    StatsSlot::local().countSize(size);
+#endif
+}
+
+}  // namespace detail
+
+inline MovegenStats MovegenStats::collect() {
+    MovegenStats stats;
+
+#ifdef CHESS_STATS
+    std::lock_guard<std::mutex> lock(detail::StatsSlot::mutex());
+
+    stats += detail::StatsSlot::retired();
+    for (const auto slot : detail::StatsSlot::slots()) stats += slot->read();
+#endif
+
+    return stats;
+}
+
+inline void MovegenStats::reset() {
+#ifdef CHESS_STATS
+    std::lock_guard<std::mutex> lock(detail::StatsSlot::mutex());
+
+    detail::StatsSlot::retired() = MovegenStats();
+    for (const auto slot : detail::StatsSlot::slots()) slot->clear();
+#endif
+}
+
+}  // namespace chess
+
 namespace chess {
 
 inline auto movegen::init_squares_between() {
@@ -3813,7 +4902,12 @@ template <Color::underlying c>
     auto king_sq          = board.kingSq(~c);
     Bitboard map_king_atk = attacks::king(king_sq) & enemy_empty;
 
-    if (map_king_atk == Bitboard(0ull) && !board.chess960()) return 0ull;
+    detail::countStat(detail::StatCounter::SEEN_SQUARES);
+
+    if (map_king_atk == Bitboard(0ull) && !board.chess960()) {
+        detail::countStat(detail::StatCounter::SEEN_SQUARES_SKIPPED);
+        return 0ull;
+    }
 
     auto occ     = board.occ() ^ Bitboard::fromSquare(king_sq);
     auto queens  = board.pieces(PieceType::QUEEN, c);
@@ -4113,6 +5207,8 @@ inline void movegen::legalmoves(Movelist& movelist, const Board& board, int piec
      be 0! This is done on purpose since it enables
      you to append new move types to any movelist.
     */
+    detail::countStat(detail::StatCounter::GENERATIONS);
+
     auto king_sq = board.kingSq(c);
 
     Bitboard occ_us  = board.us(c);
@@ -4157,7 +5253,10 @@ inline void movegen::legalmoves(Movelist& movelist, const Board& board, int piec
     }
 
     // Early return for double check as described earlier
-    if (checks == 2) return;
+    if (checks == 2) {
+        detail::countStat(detail::StatCounter::DOUBLE_CHECK_EXITS);
+        return;
+    }
 
     // Moves have to be on the checkmask
     movable_square &= checkmask;
@@ -4219,6 +5318,8 @@ inline void movegen::legalmoves(Movelist& movelist, const Board& board, int piec
         legalmoves<Color::WHITE, mt, GenMode::ALL_MOVES>(movelist, board, pieces);
     else
         legalmoves<Color::BLACK, mt, GenMode::ALL_MOVES>(movelist, board, pieces);
+
+    detail::countMovelistSize(movelist.size());
 }
 
 template <movegen::MoveGenType mt>
@@ -4413,10 +5514,13 @@ template <Color::underlying c>
 }
 
 [[nodiscard]] inline bool movegen::isLegal(const Board& board, const Move move) {
-    if (board.sideToMove() == Color::WHITE)
-        return movegen::isLegal<Color::WHITE>(board, move);
-    else
-        return movegen::isLegal<Color::BLACK>(board, move);
+    const auto legal = board.sideToMove() == Color::WHITE ? movegen::isLegal<Color::WHITE>(board, move)
+                                                          : movegen::isLegal<Color::BLACK>(board, move);
+
+    detail::countStat(detail::StatCounter::IS_LEGAL);
+    if (!legal) detail::countStat(detail::StatCounter::IS_LEGAL_FALSE);
+
+    return legal;
 }
 
 template <Color::underlying c>
@@ -4457,75 +5561,439 @@ inline const std::array<std::array<Bitboard, 64>, 64> movegen::SQUARES_BETWEEN_B
 
 }  // namespace chess
 
+#include <chrono>
+#include <climits>
+#include <condition_variable>
+#include <cstring>
 #include <istream>
+#include <mutex>
+#include <streambuf>
+#include <thread>
 
-namespace chess::pgn {
 
-namespace detail {
+#ifdef CHESS_HAS_ZLIB
+#    include <zlib.h>
+#endif
+
+#ifdef CHESS_HAS_ZSTD
+#    include <zstd.h>
+#endif
+
+namespace chess::pgn {
 
 /**
- * @brief Private class
+ * @brief Source of raw PGN bytes for the StreamParser, implement this to feed the parser
+ * from something other than a std::istream.
  */
-class StringBuffer {
+class InputSource {
    public:
-    bool empty() const noexcept { return index_ == 0; }
-
-    void clear() noexcept { index_ = 0; }
-
-    std::string_view get() const noexcept { return std::string_view(buffer_.data(), index_); }
+    virtual ~InputSource() = default;
 
-    bool add(char c) {
-        if (index_ >= N) {
-            return false;
-        }
+    /**
+     * @brief Reads up to size bytes into buffer. Returns the number of bytes read,
+     * 0 means the input is exhausted.
+     * @param buffer
+     * @param size
+     * @return
+     */
+    virtual std::size_t read(char* buffer, std::size_t size) = 0;
 
-        buffer_[index_] = c;
+    /**
+     * @brief True if the input could not be read completely, e.g. corrupt or truncated compressed
+     * data. The StreamParser then returns StreamParserError::SourceError once the input is exhausted.
+     * @return
+     */
+    virtual bool error() const { return false; }
+};
 
-        ++index_;
+/**
+ * @brief Reads from a std::istream, this is what the StreamParser uses for streams.
+ */
+class IStreamSource : public InputSource {
+   public:
+    explicit IStreamSource(std::istream& stream) : stream_(stream) {}
 
-        return true;
+    std::size_t read(char* buffer, std::size_t size) override {
+        stream_.read(buffer, static_cast<std::streamsize>(size));
+        return static_cast<std::size_t>(stream_.gcount());
     }
 
    private:
-    // PGN String Tokens are limited to 255 characters
-    static constexpr int N = 255;
-
-    std::array<char, N> buffer_ = {};
-
-    std::size_t index_ = 0;
+    std::istream& stream_;
 };
 
+#ifdef CHESS_HAS_ZLIB
 /**
- * @brief Private class
- * @tparam BUFFER_SIZE
+ * @brief Decompresses gzip or zlib data read from a std::istream.
+ * Concatenated gzip members are read one after another.
+ * Only available if CHESS_HAS_ZLIB is defined and zlib is linked.
  */
-template <std::size_t BUFFER_SIZE>
-class StreamBuffer {
-   private:
-    static constexpr std::size_t N = BUFFER_SIZE;
-    using BufferType               = std::array<char, N * N>;
-
+class GzipSource : public InputSource {
    public:
-    StreamBuffer(std::istream& stream) : stream_(stream) {}
+    explicit GzipSource(std::istream& stream) : stream_(stream) {
+        // 15 window bits + 32 to detect gzip and zlib headers
+        ok_    = inflateInit2(&zs_, 15 + 32) == Z_OK;
+        error_ = !ok_;
+    }
 
-    // Get the current character, skip carriage returns
-    std::optional<char> some() {
-        while (true) {
-            if (buffer_index_ < bytes_read_) {
-                const auto c = buffer_[buffer_index_];
+    ~GzipSource() override {
+        if (ok_) inflateEnd(&zs_);
+    }
 
-                if (c == '\r') {
-                    ++buffer_index_;
-                    continue;
-                }
+    GzipSource(const GzipSource&)            = delete;
+    GzipSource& operator=(const GzipSource&) = delete;
 
-                return c;
-            }
+    std::size_t read(char* buffer, std::size_t size) override {
+        zs_.next_out  = reinterpret_cast<Bytef*>(buffer);
+        zs_.avail_out = static_cast<uInt>(size);
 
-            if (!fill()) {
-                return std::nullopt;
-            }
-        }
+        while (ok_ && zs_.avail_out > 0) {
+            if (zs_.avail_in == 0) {
+                stream_.read(in_.data(), static_cast<std::streamsize>(in_.size()));
+                zs_.next_in  = reinterpret_cast<Bytef*>(in_.data());
+                zs_.avail_in = static_cast<uInt>(stream_.gcount());
+
+                if (zs_.avail_in == 0) {
+                    // the input ended inside a member, the file is truncated
+                    if (in_member_) {
+                        error_ = true;
+                        ok_    = false;
+                    }
+
+                    break;
+                }
+            }
+
+            in_member_     = true;
+            const auto ret = inflate(&zs_, Z_NO_FLUSH);
+
+            if (ret == Z_STREAM_END) {
+                // another gzip member might follow
+                in_member_ = false;
+                if (inflateReset(&zs_) != Z_OK) ok_ = false;
+            } else if (ret != Z_OK) {
+                error_ = true;
+                ok_    = false;
+            }
+        }
+
+        return size - zs_.avail_out;
+    }
+
+    /**
+     * @brief True if the compressed data was corrupt or truncated.
+     * @return
+     */
+    bool error() const noexcept override { return error_; }
+
+   private:
+    std::istream& stream_;
+    std::array<char, 1 << 16> in_ = {};
+    z_stream zs_                  = {};
+    bool ok_                      = false;
+    bool error_                   = false;
+    bool in_member_               = false;
+};
+#endif
+
+#ifdef CHESS_HAS_ZSTD
+/**
+ * @brief Decompresses zstd data read from a std::istream.
+ * Only available if CHESS_HAS_ZSTD is defined and libzstd is linked.
+ */
+class ZstdSource : public InputSource {
+   public:
+    explicit ZstdSource(std::istream& stream)
+        : stream_(stream), dctx_(ZSTD_createDCtx()), in_data_(ZSTD_DStreamInSize()) {}
+
+    ~ZstdSource() override { ZSTD_freeDCtx(dctx_); }
+
+    ZstdSource(const ZstdSource&)            = delete;
+    ZstdSource& operator=(const ZstdSource&) = delete;
+
+    std::size_t read(char* buffer, std::size_t size) override {
+        ZSTD_outBuffer out = {buffer, size, 0};
+
+        while (dctx_ && !error_ && out.pos < out.size) {
+            if (in_.pos == in_.size) {
+                stream_.read(in_data_.data(), static_cast<std::streamsize>(in_data_.size()));
+                in_ = {in_data_.data(), static_cast<std::size_t>(stream_.gcount()), 0};
+            }
+
+            const auto eof = in_.size == 0;
+            if (eof && pending_ == 0) break;
+
+            const auto before = out.pos;
+            const auto ret    = ZSTD_decompressStream(dctx_, &out, &in_);
+
+            if (ZSTD_isError(ret)) {
+                error_ = true;
+                break;
+            }
+
+            // 0 once a frame is complete and flushed
+            pending_ = ret;
+
+            // without input the decoder can only flush, a frame that makes no progress is truncated
+            if (eof && out.pos == before) {
+                error_ = pending_ != 0;
+                break;
+            }
+        }
+
+        return out.pos;
+    }
+
+    /**
+     * @brief True if the compressed data was corrupt or truncated.
+     * @return
+     */
+    bool error() const noexcept override { return error_; }
+
+   private:
+    std::istream& stream_;
+    ZSTD_DCtx* dctx_;
+    std::vector<char> in_data_;
+    ZSTD_inBuffer in_    = {nullptr, 0, 0};
+    std::size_t pending_ = 0;
+    bool error_          = false;
+};
+#endif
+
+/**
+ * @brief Reads another InputSource ahead on a second thread, so that
+ * decompression and parsing run in parallel.
+ */
+class ThreadedSource : public InputSource {
+   public:
+    explicit ThreadedSource(InputSource& source, std::size_t block_size = 1 << 20) : source_(source) {
+        for (auto& block : blocks_) block.data.resize(block_size);
+
+        worker_ = std::thread([this] { produce(); });
+    }
+
+    ~ThreadedSource() override {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stop_ = true;
+        }
+
+        cv_.notify_all();
+        worker_.join();
+    }
+
+    ThreadedSource(const ThreadedSource&)            = delete;
+    ThreadedSource& operator=(const ThreadedSource&) = delete;
+
+    /**
+     * @brief The error of the wrapped source, known once read() returned all of its data.
+     * @return
+     */
+    bool error() const override {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return error_;
+    }
+
+    std::size_t read(char* buffer, std::size_t size) override {
+        std::size_t total = 0;
+
+        while (total < size) {
+            auto& block = blocks_[read_index_ % blocks_.size()];
+
+            if (!block_ready_) {
+                std::unique_lock<std::mutex> lock(mutex_);
+                cv_.wait(lock, [this] { return filled_ > 0; });
+                block_ready_ = true;
+            }
+
+            // an empty block marks the end of the input
+            if (block.size == 0) break;
+
+            const auto n = std::min(size - total, block.size - block_pos_);
+            std::memcpy(buffer + total, block.data.data() + block_pos_, n);
+
+            total += n;
+            block_pos_ += n;
+
+            if (block_pos_ == block.size) {
+                // hand the block back to the worker
+                {
+                    std::lock_guard<std::mutex> lock(mutex_);
+                    --filled_;
+                }
+
+                cv_.notify_all();
+
+                ++read_index_;
+                block_pos_   = 0;
+                block_ready_ = false;
+            }
+        }
+
+        return total;
+    }
+
+   private:
+    struct Block {
+        std::vector<char> data;
+        std::size_t size = 0;
+    };
+
+    void produce() {
+        for (std::size_t write_index = 0;; ++write_index) {
+            {
+                std::unique_lock<std::mutex> lock(mutex_);
+                cv_.wait(lock, [this] { return stop_ || filled_ < blocks_.size(); });
+                if (stop_) return;
+            }
+
+            auto& block = blocks_[write_index % blocks_.size()];
+            block.size  = 0;
+
+            while (block.size < block.data.size()) {
+                const auto n = source_.read(block.data.data() + block.size, block.data.size() - block.size);
+                if (n == 0) break;
+                block.size += n;
+            }
+
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                ++filled_;
+
+                // only this thread reads the source
+                if (block.size == 0) error_ = source_.error();
+            }
+
+            cv_.notify_all();
+
+            if (block.size == 0) return;
+        }
+    }
+
+    InputSource& source_;
+
+    std::array<Block, 4> blocks_;
+
+    // consumer state, only touched by read()
+    std::size_t read_index_ = 0;
+    std::size_t block_pos_  = 0;
+    bool block_ready_       = false;
+
+    mutable std::mutex mutex_;
+    std::condition_variable cv_;
+    std::size_t filled_ = 0;
+    bool stop_          = false;
+    bool error_         = false;
+
+    std::thread worker_;
+};
+
+/**
+ * @brief Counters of a StreamParser, only collected if CHESS_PGN_STATS is defined.
+ * Otherwise all values stay zero. Moves, comments and headers of skipped games are counted too.
+ */
+struct StreamParserStats {
+    std::uint64_t bytes         = 0;
+    std::uint64_t games         = 0;
+    std::uint64_t moves         = 0;
+    std::uint64_t comments      = 0;
+    std::uint64_t headers       = 0;
+    std::uint64_t skipped_games = 0;
+
+    // time spent waiting for the input source
+    std::chrono::nanoseconds read_time = std::chrono::nanoseconds(0);
+    // time spent inside the visitor callbacks
+    std::chrono::nanoseconds visitor_time = std::chrono::nanoseconds(0);
+};
+
+namespace detail {
+
+/**
+ * @brief Private class, adds its lifetime to total if CHESS_PGN_STATS is defined, otherwise does nothing.
+ */
+class StatsTimer {
+   public:
+#ifdef CHESS_PGN_STATS
+    explicit StatsTimer(std::chrono::nanoseconds& total) noexcept
+        : total_(total), start_(std::chrono::steady_clock::now()) {}
+
+    ~StatsTimer() { total_ += std::chrono::steady_clock::now() - start_; }
+
+   private:
+    std::chrono::nanoseconds& total_;
+    std::chrono::steady_clock::time_point start_;
+#else
+    explicit StatsTimer(std::chrono::nanoseconds&) noexcept {}
+#endif
+};
+
+/**
+ * @brief Private class
+ */
+class StringBuffer {
+   public:
+    bool empty() const noexcept { return index_ == 0; }
+
+    void clear() noexcept { index_ = 0; }
+
+    std::string_view get() const noexcept { return std::string_view(buffer_.data(), index_); }
+
+    bool add(char c) {
+        if (index_ >= N) {
+            return false;
+        }
+
+        buffer_[index_] = c;
+
+        ++index_;
+
+        return true;
+    }
+
+   private:
+    // PGN String Tokens are limited to 255 characters
+    static constexpr int N = 255;
+
+    std::array<char, N> buffer_ = {};
+
+    std::size_t index_ = 0;
+};
+
+/**
+ * @brief Private class
+ * @tparam BUFFER_SIZE
+ */
+template <std::size_t BUFFER_SIZE>
+class StreamBuffer {
+   private:
+    static constexpr std::size_t N = BUFFER_SIZE;
+    using BufferType               = std::array<char, N * N>;
+
+   public:
+    StreamBuffer(std::istream& stream) : stream_source_(stream), source_(*stream_source_) {}
+    StreamBuffer(InputSource& source) : source_(source) {}
+
+    StreamBuffer(const StreamBuffer&)            = delete;
+    StreamBuffer& operator=(const StreamBuffer&) = delete;
+
+    // Get the current character, skip carriage returns
+    std::optional<char> some() {
+        while (true) {
+            if (buffer_index_ < bytes_read_) {
+                const auto c = buffer_[buffer_index_];
+
+                if (c == '\r') {
+                    ++buffer_index_;
+                    continue;
+                }
+
+                return c;
+            }
+
+            if (!fill()) {
+                return std::nullopt;
+            }
+        }
     }
 
     // Assume that the current character is already the opening_delim
@@ -4561,10 +6029,24 @@ class StreamBuffer {
     }
 
     bool fill() {
+        // the pinned view points into the buffer, which is about to be overwritten
+        if (pinned_view_ && !pinned_view_->empty()) {
+            pinned_spill_->append(*pinned_view_);
+            *pinned_view_ = {};
+        }
+
+        buffer_offset_ += bytes_read_;
         buffer_index_ = 0;
+        bytes_read_   = 0;
+
+        // a character which was already read by peek()
+        if (has_lookahead_) {
+            buffer_[0]     = lookahead_;
+            bytes_read_    = 1;
+            has_lookahead_ = false;
+        }
 
-        stream_.read(buffer_.data(), N * N);
-        bytes_read_ = stream_.gcount();
+        bytes_read_ += readSource(buffer_.data() + bytes_read_, N * N - bytes_read_);
 
         return bytes_read_ > 0;
     }
@@ -4579,7 +6061,8 @@ class StreamBuffer {
 
     char peek() {
         if (buffer_index_ + 1 >= bytes_read_) {
-            return stream_.peek();
+            if (!has_lookahead_) has_lookahead_ = readSource(&lookahead_, 1) == 1;
+            return has_lookahead_ ? lookahead_ : '\0';
         }
 
         return buffer_[buffer_index_ + 1];
@@ -4593,13 +6076,96 @@ class StreamBuffer {
         return buffer_[buffer_index_];
     }
 
+    // Returns the characters from the current one up to delim, but at most until the end of the buffer.
+    // If delim was found, found is set and the position moves past delim.
+    // The returned view is only valid until the next fill.
+    std::string_view readUntil(char delim, bool& found) {
+        found = false;
+
+        if (buffer_index_ >= bytes_read_ && !fill()) {
+            return {};
+        }
+
+        const auto begin  = buffer_.data() + buffer_index_;
+        const auto length = bytes_read_ - buffer_index_;
+        const auto end    = static_cast<const char*>(std::memchr(begin, delim, length));
+
+        if (end == nullptr) {
+            buffer_index_ = bytes_read_;
+            return {begin, length};
+        }
+
+        found = true;
+        buffer_index_ += (end - begin) + 1;
+
+        return {begin, static_cast<std::size_t>(end - begin)};
+    }
+
+    // Bytes read from the source and the time it took, only counted with CHESS_PGN_STATS
+    std::uint64_t bytesRead() const noexcept { return source_bytes_; }
+
+    bool sourceError() const { return source_.error(); }
+    std::chrono::nanoseconds readTime() const noexcept { return read_time_; }
+
+    // Before the buffer is refilled, the content of view is appended to spill and view is cleared
+    void pin(std::string_view* view, std::string* spill) noexcept {
+        pinned_view_  = view;
+        pinned_spill_ = spill;
+    }
+
+    // Offset of the current character, counted from where the stream was when we started reading
+    std::uint64_t tell() const noexcept { return buffer_offset_ + buffer_index_; }
+
    private:
-    std::istream& stream_;
+    std::size_t readSource(char* buffer, std::size_t size) {
+        StatsTimer timer(read_time_);
+
+        const auto n = source_.read(buffer, size);
+
+#ifdef CHESS_PGN_STATS
+        source_bytes_ += n;
+#endif
+
+        return n;
+    }
+
+    std::optional<IStreamSource> stream_source_;
+    InputSource& source_;
     BufferType buffer_;
-    std::streamsize bytes_read_   = 0;
-    std::streamsize buffer_index_ = 0;
+    std::uint64_t buffer_offset_ = 0;
+    std::size_t bytes_read_      = 0;
+    std::size_t buffer_index_    = 0;
+
+    char lookahead_     = '\0';
+    bool has_lookahead_ = false;
+
+    std::string_view* pinned_view_ = nullptr;
+    std::string* pinned_spill_     = nullptr;
+
+    std::uint64_t source_bytes_         = 0;
+    std::chrono::nanoseconds read_time_ = std::chrono::nanoseconds(0);
+};
+
+/**
+ * @brief Private class, exposes a memory range as a std::istream.
+ */
+class MemoryStreamBuf : public std::streambuf {
+   public:
+    MemoryStreamBuf(char* data, std::size_t size) { setg(data, data, data + size); }
 };
 
+inline void writeVarint(std::ostream& os, std::uint64_t value) {
+    utils::writeVarint(value, [&os](std::uint8_t byte) { os.put(static_cast<char>(byte)); });
+}
+
+inline bool readVarint(std::istream& is, std::uint64_t& value) {
+    return utils::readVarint(value, [&is](std::uint8_t& byte) {
+        const auto c = is.get();
+        byte         = static_cast<std::uint8_t>(c);
+        return c != std::char_traits<char>::eof();
+    });
+}
+
 }  // namespace detail
 
 /**
@@ -4658,7 +6224,8 @@ class StreamParserError {
         ExceededMaxStringLength,
         InvalidHeaderMissingClosingBracket,
         InvalidHeaderMissingClosingQuote,
-        NotEnoughData
+        NotEnoughData,
+        SourceError
     };
 
     StreamParserError() : code_(None) {}
@@ -4679,6 +6246,8 @@ class StreamParserError {
                 return "Invalid header: missing closing quote";
             case NotEnoughData:
                 return "Not enough data";
+            case SourceError:
+                return "Source error: the input is corrupt or truncated";
             default:
                 assert(false);
                 return "Unknown error";
@@ -4707,21 +6276,69 @@ template <std::size_t BUFFER_SIZE =
           >
 class StreamParser {
    public:
-    StreamParser(std::istream& stream) : stream_buffer(stream) {}
+    StreamParser(std::istream& stream) : stream_buffer(stream) { stream_buffer.pin(&comment_view, &comment); }
+
+    /**
+     * @brief Reads the PGN data from a custom source, e.g. a GzipSource or a ThreadedSource.
+     * @param source
+     */
+    StreamParser(InputSource& source) : stream_buffer(source) { stream_buffer.pin(&comment_view, &comment); }
 
-    StreamParserError readGames(Visitor& vis) {
+    StreamParserError readGames(Visitor& vis) { return parse(vis, false); }
+
+    /**
+     * @brief Reads the next game only, repeated calls continue where the last one stopped.
+     * Returns NotEnoughData once there are no more games.
+     * @param vis
+     * @return
+     */
+    StreamParserError readGame(Visitor& vis) { return parse(vis, true); }
+
+    /**
+     * @brief Counters collected while parsing, all zero unless CHESS_PGN_STATS is defined.
+     * @return
+     */
+    StreamParserStats stats() const noexcept {
+        auto stats      = stats_;
+        stats.bytes     = stream_buffer.bytesRead();
+        stats.read_time = stream_buffer.readTime();
+        return stats;
+    }
+
+    /**
+     * @brief Offset of the character the parser is currently looking at, relative to the
+     * position of the stream when parsing started. Inside Visitor::startPgn this is the
+     * offset of the opening '[' of the game.
+     * @return
+     */
+    std::uint64_t offset() const noexcept { return stream_buffer.tell(); }
+
+   private:
+    StreamParserError parse(Visitor& vis, bool single_game) {
         visitor = &vis;
 
-        if (!stream_buffer.fill()) {
-            return StreamParserError::NotEnoughData;
+        if (!started) {
+            started = true;
+
+            if (!stream_buffer.fill()) {
+                return stream_buffer.sourceError() ? StreamParserError::SourceError : StreamParserError::NotEnoughData;
+            }
         }
 
+        game_ended = false;
+
         while (auto c = stream_buffer.some()) {
             if (in_header) {
                 visitor->skipPgn(false);
 
                 if (*c == '[') {
-                    visitor->startPgn();
+                    count(&StreamParserStats::games);
+
+                    {
+                        detail::StatsTimer timer(stats_.visitor_time);
+                        visitor->startPgn();
+                    }
+
                     pgn_end = false;
 
                     processHeader();
@@ -4741,22 +6358,34 @@ class StreamParser {
 
             if (!dont_advance_after_body) stream_buffer.advance();
             dont_advance_after_body = false;
+
+            if (single_game && game_ended) {
+                return error;
+            }
         }
 
         if (!pgn_end) {
             onEnd();
         }
 
+        // the games before it were read, but the input ended early
+        if (stream_buffer.sourceError()) {
+            return StreamParserError::SourceError;
+        }
+
+        if (single_game && !game_ended) {
+            return StreamParserError::NotEnoughData;
+        }
+
         return error;
     }
 
-   private:
     void reset_trackers() {
         header.first.clear();
         header.second.clear();
 
         move.clear();
-        comment.clear();
+        clearComment();
 
         in_header = true;
         in_body   = false;
@@ -4764,10 +6393,15 @@ class StreamParser {
 
     void callVisitorMoveFunction() {
         if (!move.empty()) {
-            if (!visitor->skip()) visitor->move(move.get(), comment);
+            count(&StreamParserStats::moves);
 
-            move.clear();
-            comment.clear();
+            if (!visitor->skip()) {
+                detail::StatsTimer timer(stats_.visitor_time);
+                visitor->move(move.get(), commentView());
+            }
+
+            move.clear();
+            clearComment();
         }
     }
 
@@ -4838,7 +6472,12 @@ class StreamParser {
                         stream_buffer.advance();
                     }
 
-                    if (!visitor->skip()) visitor->header(header.first.get(), header.second.get());
+                    count(&StreamParserStats::headers);
+
+                    if (!visitor->skip()) {
+                        detail::StatsTimer timer(stats_.visitor_time);
+                        visitor->header(header.first.get(), header.second.get());
+                    }
 
                     header.first.clear();
                     header.second.clear();
@@ -4849,7 +6488,10 @@ class StreamParser {
                     in_header = false;
                     in_body   = true;
 
-                    if (!visitor->skip()) visitor->startMoves();
+                    if (!visitor->skip()) {
+                        detail::StatsTimer timer(stats_.visitor_time);
+                        visitor->startMoves();
+                    }
 
                     return;
                 default:
@@ -4858,7 +6500,10 @@ class StreamParser {
                     in_header = false;
                     in_body   = true;
 
-                    if (!visitor->skip()) visitor->startMoves();
+                    if (!visitor->skip()) {
+                        detail::StatsTimer timer(stats_.visitor_time);
+                        visitor->startMoves();
+                    }
 
                     return;
             }
@@ -4888,23 +6533,15 @@ class StreamParser {
 
                 // reading comment
                 stream_buffer.advance();
-
-                while (auto k = stream_buffer.some()) {
-                    stream_buffer.advance();
-
-                    if (*k == '}') {
-                        break;
-                    }
-
-                    comment += *k;
-                }
+                readComment();
 
                 // the game has no moves, but a comment followed by a game termination
                 if (!visitor->skip()) {
-                    visitor->move("", comment);
+                    detail::StatsTimer timer(stats_.visitor_time);
+                    visitor->move("", commentView());
 
                     has_comment = false;
-                    comment.clear();
+                    clearComment();
                 }
             } else {
                 break;
@@ -5087,16 +6724,7 @@ class StreamParser {
                 case '{': {
                     // reading comment
                     stream_buffer.advance();
-
-                    while (auto c = stream_buffer.some()) {
-                        stream_buffer.advance();
-
-                        if (*c == '}') {
-                            break;
-                        }
-
-                        comment += *c;
-                    }
+                    readComment();
 
                     break;
                 }
@@ -5133,14 +6761,80 @@ class StreamParser {
         }
     }
 
+    // Reads a comment up to and including the closing '}'. The comment stays a view into the
+    // read buffer, it is only copied into comment if it straddles a refill, contains a '\r'
+    // or a move has more than one comment.
+    void readComment() {
+        count(&StreamParserStats::comments);
+
+        bool found = false;
+
+        while (!found) {
+            const auto chunk = stream_buffer.readUntil('}', found);
+
+            if (chunk.empty()) {
+                // end of the input or an empty comment
+                if (!found) return;
+                continue;
+            }
+
+            const bool has_cr = std::memchr(chunk.data(), '\r', chunk.size()) != nullptr;
+
+            if (comment.empty() && comment_view.empty() && !has_cr) {
+                comment_view = chunk;
+                continue;
+            }
+
+            comment.append(comment_view);
+            comment_view = {};
+
+            if (!has_cr) {
+                comment.append(chunk);
+                continue;
+            }
+
+            for (const auto c : chunk) {
+                if (c != '\r') comment += c;
+            }
+        }
+    }
+
+    std::string_view commentView() {
+        if (comment.empty()) return comment_view;
+
+        comment.append(comment_view);
+        comment_view = {};
+
+        return comment;
+    }
+
+    void count([[maybe_unused]] std::uint64_t StreamParserStats::*counter) noexcept {
+#ifdef CHESS_PGN_STATS
+        ++(stats_.*counter);
+#endif
+    }
+
+    void clearComment() noexcept {
+        comment.clear();
+        comment_view = {};
+    }
+
     void onEnd() {
         callVisitorMoveFunction();
-        visitor->endPgn();
+
+        if (visitor->skip()) count(&StreamParserStats::skipped_games);
+
+        {
+            detail::StatsTimer timer(stats_.visitor_time);
+            visitor->endPgn();
+        }
+
         visitor->skipPgn(false);
 
         reset_trackers();
 
-        pgn_end = true;
+        pgn_end    = true;
+        game_ended = true;
     }
 
     bool is_space(const char c) noexcept {
@@ -5181,7 +6875,10 @@ class StreamParser {
     std::pair<detail::StringBuffer, detail::StringBuffer> header = {detail::StringBuffer{}, detail::StringBuffer{}};
 
     detail::StringBuffer move = {};
-    std::string comment       = {};
+
+    // comment_view points into the read buffer, comment is only used if that is not possible
+    std::string comment           = {};
+    std::string_view comment_view = {};
 
     // State
 
@@ -5192,253 +6889,2677 @@ class StreamParser {
 
     bool pgn_end = true;
 
+    StreamParserStats stats_;
+
+    // state for reading one game at a time
+    bool started    = false;
+    bool game_ended = false;
+
     bool dont_advance_after_body = false;
 };
-}  // namespace chess::pgn
 
+/**
+ * @brief Evaluation, depth and time of an engine comment like "+0.31/18 0.52s" or "-M4/22 1.1s",
+ * as written by cutechess, fastchess and fishtest.
+ */
+struct EngineComment {
+    // centipawns from the view of the side which made the move, or moves to mate if mate is set
+    int score = 0;
+    bool mate = false;
+    int depth = 0;
+    // milliseconds, -1 if the comment has no time
+    int time_ms = -1;
+};
 
+/**
+ * @brief Parses an engine comment like "+0.31/18 0.52s", "-M4/22 1.1s" or "+1.20/15".
+ * Anything after the time is ignored, e.g. ", White wins by adjudication".
+ * Other comments, like "book", and numbers too large for an int return std::nullopt.
+ * @param comment
+ * @return
+ */
+inline std::optional<EngineComment> parseEngineComment(std::string_view comment) noexcept {
+    EngineComment info;
 
-namespace chess {
-class uci {
+    std::size_t i    = 0;
+    const auto n     = comment.size();
+    const auto digit = [&](std::size_t idx) { return idx < n && comment[idx] >= '0' && comment[idx] <= '9'; };
+
+    // reads a number, false if it doesn't fit into value / scale
+    const auto number = [&](int& value, int scale) {
+        value = 0;
+
+        while (digit(i)) {
+            const int d = comment[i++] - '0';
+            if (value > (INT_MAX / scale - d) / 10) return false;
+            value = value * 10 + d;
+        }
+
+        return true;
+    };
+
+    bool negative = false;
+    if (i < n && (comment[i] == '+' || comment[i] == '-')) negative = comment[i++] == '-';
+
+    if (i < n && comment[i] == 'M') {
+        info.mate = true;
+        ++i;
+    }
+
+    if (!digit(i)) return std::nullopt;
+
+    // the fraction adds up to 99 centipawns
+    int whole = 0;
+    if (!number(whole, info.mate ? 1 : 101)) return std::nullopt;
+
+    if (info.mate) {
+        info.score = whole;
+    } else {
+        // up to two decimals, "+1.5" is 150 centipawns
+        int fraction = 0;
+        int digits   = 0;
+
+        if (i < n && comment[i] == '.') {
+            ++i;
+            while (digit(i)) {
+                if (digits < 2) {
+                    fraction = fraction * 10 + (comment[i] - '0');
+                    ++digits;
+                }
+
+                ++i;
+            }
+        }
+
+        while (digits++ < 2) fraction *= 10;
+
+        info.score = whole * 100 + fraction;
+    }
+
+    if (negative) info.score = -info.score;
+
+    if (i >= n || comment[i] != '/' || !digit(++i)) return std::nullopt;
+
+    if (!number(info.depth, 1)) return std::nullopt;
+
+    if (i >= n || comment[i] != ' ' || !digit(i + 1)) return info;
+
+    ++i;
+
+    // time in seconds with up to three decimals, e.g. "0.52s"
+    int seconds = 0;
+    int millis  = 0;
+    int digits  = 0;
+
+    if (!number(seconds, 1001)) return std::nullopt;
+
+    if (i < n && comment[i] == '.') {
+        ++i;
+        while (digit(i)) {
+            if (digits < 3) {
+                millis = millis * 10 + (comment[i] - '0');
+                ++digits;
+            }
+
+            ++i;
+        }
+    }
+
+    while (digits++ < 3) millis *= 10;
+
+    if (i < n && comment[i] == 's') info.time_ms = seconds * 1000 + millis;
+
+    return info;
+}
+
+/**
+ * @brief A single game read by pgn::games(). All strings point into buffers owned by the game,
+ * which are reused for the next game, so the views are only valid until the iterator advances.
+ */
+class Game {
    public:
+    struct Header {
+        std::string_view key;
+        std::string_view value;
+    };
+
+    struct MoveEntry {
+        std::string_view move;
+        std::string_view comment;
+    };
+
     /**
-     * @brief Converts an internal move to a UCI string
-     * @param move
-     * @param chess960
+     * @brief Headers in the order they appear in the PGN.
      * @return
      */
-    [[nodiscard]] static std::string moveToUci(const Move& move, bool chess960 = false) noexcept(false) {
-        // Get the from and to squares
-        Square from_sq = move.from();
-        Square to_sq   = move.to();
+    const std::vector<Header>& headers() const noexcept { return headers_; }
 
-        // If the move is not a chess960 castling move and is a king moving more than one square,
-        // update the to square to be the correct square for a regular castling move
-        if (!chess960 && move.typeOf() == Move::CASTLING) {
-            to_sq = Square(to_sq > from_sq ? File::FILE_G : File::FILE_C, from_sq.rank());
+    /**
+     * @brief Moves in SAN as written in the PGN, with the comment following each move.
+     * @return
+     */
+    const std::vector<MoveEntry>& moves() const noexcept { return moves_; }
+
+    /**
+     * @brief Value of the first header with the given key.
+     * @param key
+     * @return
+     */
+    std::optional<std::string_view> header(std::string_view key) const {
+        for (const auto& h : headers_) {
+            if (h.key == key) return h.value;
         }
 
-        // Add the from and to squares to the string stream
-        std::string result = static_cast<std::string>(from_sq);
-        result += static_cast<std::string>(to_sq);
+        return std::nullopt;
+    }
 
-        // If the move is a promotion, add the promoted piece to the string stream
-        if (move.typeOf() == Move::PROMOTION) {
-            result += static_cast<std::string>(move.promotionType());
+   private:
+    friend class GameReader;
+
+    struct Span {
+        std::uint32_t offset;
+        std::uint32_t length;
+    };
+
+    void clear() noexcept {
+        data_.clear();
+        header_spans_.clear();
+        move_spans_.clear();
+        headers_.clear();
+        moves_.clear();
+    }
+
+    Span append(std::string_view str) {
+        const auto offset = static_cast<std::uint32_t>(data_.size());
+        data_.append(str);
+        return {offset, static_cast<std::uint32_t>(str.size())};
+    }
+
+    void addHeader(std::string_view key, std::string_view value) {
+        header_spans_.push_back({append(key), append(value)});
+    }
+
+    void addMove(std::string_view move, std::string_view comment) {
+        move_spans_.push_back({append(move), append(comment)});
+    }
+
+    // data_ might have been reallocated while the game was read,
+    // so the views are only created once the game is complete
+    void finish() {
+        const auto view = [this](Span span) { return std::string_view(data_).substr(span.offset, span.length); };
+
+        for (const auto& [key, value] : header_spans_) headers_.push_back({view(key), view(value)});
+        for (const auto& [move, comment] : move_spans_) moves_.push_back({view(move), view(comment)});
+    }
+
+    std::string data_;
+    std::vector<std::pair<Span, Span>> header_spans_;
+    std::vector<std::pair<Span, Span>> move_spans_;
+
+    std::vector<Header> headers_;
+    std::vector<MoveEntry> moves_;
+};
+
+/**
+ * @brief Reads the games of a PGN one at a time, use pgn::games() to create one.
+ */
+class GameReader {
+   public:
+    class iterator {
+       public:
+        using iterator_category = std::input_iterator_tag;
+        using value_type        = Game;
+        using difference_type   = std::ptrdiff_t;
+        using pointer           = Game*;
+        using reference         = Game&;
+
+        iterator() = default;
+        explicit iterator(GameReader* reader) : reader_(reader) {}
+
+        Game& operator*() const { return reader_->game_; }
+        Game* operator->() const { return &reader_->game_; }
+
+        iterator& operator++() {
+            if (!reader_->next()) reader_ = nullptr;
+            return *this;
         }
 
-        return result;
+        bool operator==(const iterator& other) const { return reader_ == other.reader_; }
+        bool operator!=(const iterator& other) const { return reader_ != other.reader_; }
+
+       private:
+        GameReader* reader_ = nullptr;
+    };
+
+    explicit GameReader(std::istream& stream) : parser_(stream) {}
+    explicit GameReader(InputSource& source) : parser_(source) {}
+
+    /**
+     * @brief Reads the first game, may only be called once.
+     * @return
+     */
+    iterator begin() { return next() ? iterator(this) : iterator(); }
+    iterator end() { return iterator(); }
+
+    /**
+     * @brief Reads the next game into game(), returns false at the end of the input or on an error.
+     * @return
+     */
+    bool next() {
+        const auto err = parser_.readGame(visitor_);
+
+        if (err == StreamParserError::NotEnoughData) return false;
+
+        error_ = err;
+        return !err;
     }
 
+    const Game& game() const noexcept { return game_; }
+
     /**
-     * @brief Converts a UCI string to an internal move.
-     * @param board
-     * @param uci
+     * @brief The error which stopped the iteration, None if all games were read.
      * @return
      */
-    [[nodiscard]] static Move uciToMove(const Board& board, std::string_view uci) noexcept(false) {
-        if (uci.length() < 4) {
-            return Move::NO_MOVE;
-        }
+    StreamParserError error() const noexcept { return error_; }
 
-        Square source = Square(uci.substr(0, 2));
-        Square target = Square(uci.substr(2, 2));
+   private:
+    class GameVisitor : public Visitor {
+       public:
+        explicit GameVisitor(Game& game) : game_(game) {}
 
-        if (!source.is_valid() || !target.is_valid()) {
-            return Move::NO_MOVE;
-        }
+        void startPgn() override { game_.clear(); }
+        void header(std::string_view key, std::string_view value) override { game_.addHeader(key, value); }
+        void startMoves() override {}
+        void move(std::string_view move, std::string_view comment) override { game_.addMove(move, comment); }
+        void endPgn() override { game_.finish(); }
 
-        auto pt = board.at(source).type();
+       private:
+        Game& game_;
+    };
 
-        // castling in chess960
-        if (board.chess960() && pt == PieceType::KING && board.at(target).type() == PieceType::ROOK &&
-            board.at(target).color() == board.sideToMove()) {
-            return Move::make<Move::CASTLING>(source, target);
-        }
+    StreamParser<> parser_;
+    Game game_;
+    GameVisitor visitor_{game_};
+    StreamParserError error_;
+};
 
-        // convert to king captures rook
-        // in chess960 the move should be sent as king captures rook already!
-        if (!board.chess960() && pt == PieceType::KING && Square::distance(target, source) == 2) {
-            target = Square(target > source ? File::FILE_H : File::FILE_A, source.rank());
-            return Move::make<Move::CASTLING>(source, target);
-        }
+/**
+ * @brief Pull based alternative to StreamParser::readGames.
+ *
+ * @code
+ * for (const auto& game : pgn::games(stream)) {
+ *     auto white = game.header("White");
+ *     for (const auto& [move, comment] : game.moves()) { ... }
+ * }
+ * @endcode
+ * @param stream
+ * @return
+ */
+inline GameReader games(std::istream& stream) { return GameReader(stream); }
+inline GameReader games(InputSource& source) { return GameReader(source); }
 
-        // en passant
-        if (pt == PieceType::PAWN && target == board.enpassantSq()) {
-            return Move::make<Move::ENPASSANT>(source, target);
-        }
+/**
+ * @brief Index of the games in a PGN file, allows to read a single game or a range of games
+ * without parsing the games before them. Each entry stores the byte offset and length of a game
+ * and the values of the header keys passed to the constructor.
+ * The offsets are the ones seen by StreamParser::readGames, a game starts at its first '['
+ * and ends right before the first '[' of the next game.
+ */
+class GameIndex {
+   public:
+    struct Entry {
+        std::uint64_t offset = 0;
+        std::uint64_t length = 0;
 
-        // promotion
-        if (pt == PieceType::PAWN && uci.length() == 5 && Square::back_rank(target, ~board.sideToMove())) {
-            auto promotion = PieceType(uci.substr(4, 1));
+        // values of GameIndex::keys(), empty if the game does not have the header
+        std::vector<std::string> headers;
+    };
 
-            if (promotion == PieceType::NONE || promotion == PieceType::KING || promotion == PieceType::PAWN) {
-                return Move::NO_MOVE;
-            }
+    explicit GameIndex(std::vector<std::string> keys = {}) : keys_(std::move(keys)) {}
 
-            return Move::make<Move::PROMOTION>(source, target, PieceType(uci.substr(4, 1)));
+    /**
+     * @brief Scans the whole stream and records every game. Offsets are relative to the
+     * beginning of the stream, not to its current position.
+     * @param stream
+     * @return
+     */
+    StreamParserError build(std::istream& stream) {
+        entries_.clear();
+
+        const auto start = stream.tellg();
+        const auto base  = start == std::istream::pos_type(-1) ? 0 : static_cast<std::uint64_t>(start);
+
+        StreamParser<> parser(stream);
+        IndexVisitor vis(*this, parser, base);
+
+        const auto error = parser.readGames(vis);
+
+        // the last game ends with the stream
+        if (!entries_.empty()) {
+            entries_.back().length = base + parser.offset() - entries_.back().offset;
         }
 
-        return (uci.length() == 4) ? Move::make<Move::NORMAL>(source, target) : Move::NO_MOVE;
+        return error;
     }
 
     /**
-     * @brief Converts a move to a SAN string
-     * @param board
-     * @param move
+     * @brief Parses a single game of the indexed stream, the stream has to be seekable.
+     * Returns StreamParserError::NotEnoughData if the game is not part of the index.
+     * @param stream
+     * @param game
+     * @param vis
      * @return
      */
-    [[nodiscard]] static std::string moveToSan(const Board& board, const Move& move) noexcept(false) {
-        std::string san;
-        moveToRep<false>(board, move, san);
-        return san;
+    StreamParserError readGame(std::istream& stream, std::size_t game, Visitor& vis) const {
+        return readGames(stream, game, 1, vis);
     }
 
     /**
-     * @brief Converts a move to a LAN string
-     * @param board
-     * @param move
+     * @brief Parses the games [first, first + count) of the indexed stream, the stream has to be seekable.
+     * Returns StreamParserError::NotEnoughData if the range is not part of the index.
+     * @param stream
+     * @param first
+     * @param count
+     * @param vis
      * @return
      */
-    [[nodiscard]] static std::string moveToLan(const Board& board, const Move& move) noexcept(false) {
-        std::string lan;
-        moveToRep<true>(board, move, lan);
-        return lan;
+    StreamParserError readGames(std::istream& stream, std::size_t first, std::size_t count, Visitor& vis) const {
+        if (count == 0 || first >= entries_.size() || count > entries_.size() - first) {
+            return StreamParserError::NotEnoughData;
+        }
+
+        const auto& front = entries_[first];
+        const auto& back  = entries_[first + count - 1];
+        const auto length = back.offset + back.length - front.offset;
+
+        std::string buffer(length, '\0');
+
+        stream.clear();
+        stream.seekg(static_cast<std::streamoff>(front.offset));
+        stream.read(buffer.data(), static_cast<std::streamsize>(length));
+        buffer.resize(static_cast<std::size_t>(stream.gcount()));
+
+        detail::MemoryStreamBuf buf(buffer.data(), buffer.size());
+        std::istream game_stream(&buf);
+
+        StreamParser<> parser(game_stream);
+        return parser.readGames(vis);
     }
 
-    class SanParseError : public std::exception {
-       public:
-        explicit SanParseError(const char* message) : msg_(message) {}
+    /**
+     * @brief Writes the index in a compact binary format.
+     * @param os
+     * @return
+     */
+    bool save(std::ostream& os) const {
+        os.write(MAGIC, sizeof(MAGIC));
+        detail::writeVarint(os, VERSION);
 
-        explicit SanParseError(const std::string& message) : msg_(message) {}
+        detail::writeVarint(os, keys_.size());
+        for (const auto& key : keys_) writeString(os, key);
 
-        virtual ~SanParseError() noexcept {}
+        detail::writeVarint(os, entries_.size());
 
-        virtual const char* what() const noexcept { return msg_.c_str(); }
+        std::uint64_t prev_offset = 0;
 
-       protected:
-        std::string msg_;
-    };
+        for (const auto& entry : entries_) {
+            // offsets are increasing, store the difference to the previous one
+            detail::writeVarint(os, entry.offset - prev_offset);
+            detail::writeVarint(os, entry.length);
 
-    class AmbiguousMoveError : public std::exception {
-       public:
-        explicit AmbiguousMoveError(const char* message) : msg_(message) {}
+            for (const auto& value : entry.headers) writeString(os, value);
 
-        explicit AmbiguousMoveError(const std::string& message) : msg_(message) {}
+            prev_offset = entry.offset;
+        }
 
-        virtual ~AmbiguousMoveError() noexcept {}
+        return static_cast<bool>(os);
+    }
 
-        virtual const char* what() const noexcept { return msg_.c_str(); }
+    /**
+     * @brief Reads an index written by save(), returns false if the data is not a valid index.
+     * @param is
+     * @return
+     */
+    bool load(std::istream& is) {
+        keys_.clear();
+        entries_.clear();
+
+        char magic[sizeof(MAGIC)] = {};
+        is.read(magic, sizeof(MAGIC));
+        if (!is || std::string_view(magic, sizeof(MAGIC)) != std::string_view(MAGIC, sizeof(MAGIC))) return false;
+
+        std::uint64_t version = 0, key_count = 0, game_count = 0;
+
+        if (!detail::readVarint(is, version) || version != VERSION) return false;
+        if (!detail::readVarint(is, key_count)) return false;
+
+        // counts and sizes are not trusted, storage only grows with the data actually read
+        for (std::uint64_t i = 0; i < key_count; i++) {
+            std::string key;
+            if (!readString(is, key)) return false;
+            keys_.push_back(std::move(key));
+        }
+
+        if (!detail::readVarint(is, game_count)) return false;
+
+        std::uint64_t prev_offset = 0;
+
+        for (std::uint64_t i = 0; i < game_count; i++) {
+            Entry entry;
+            std::uint64_t delta = 0;
+
+            if (!detail::readVarint(is, delta) || !detail::readVarint(is, entry.length)) return false;
+
+            entry.offset = prev_offset + delta;
+            entry.headers.resize(keys_.size());
+
+            for (auto& value : entry.headers) {
+                if (!readString(is, value)) return false;
+            }
+
+            prev_offset = entry.offset;
+            entries_.push_back(std::move(entry));
+        }
+
+        return true;
+    }
+
+    /**
+     * @brief Returns the value of an indexed header of a game, std::nullopt if the key was not indexed
+     * or the game is out of range.
+     * @param game
+     * @param key
+     * @return
+     */
+    std::optional<std::string_view> header(std::size_t game, std::string_view key) const {
+        if (game >= entries_.size()) return std::nullopt;
+
+        for (std::size_t i = 0; i < keys_.size(); i++) {
+            if (keys_[i] == key) return std::string_view(entries_[game].headers[i]);
+        }
+
+        return std::nullopt;
+    }
+
+    const std::vector<std::string>& keys() const noexcept { return keys_; }
+    const std::vector<Entry>& entries() const noexcept { return entries_; }
+
+    const Entry& operator[](std::size_t game) const noexcept { return entries_[game]; }
+
+    std::size_t size() const noexcept { return entries_.size(); }
+    bool empty() const noexcept { return entries_.empty(); }
+
+   private:
+    class IndexVisitor : public Visitor {
+       public:
+        IndexVisitor(GameIndex& index, const StreamParser<>& parser, std::uint64_t base)
+            : index_(index), parser_(parser), base_(base) {}
+
+        void startPgn() override {
+            auto& entries     = index_.entries_;
+            const auto offset = base_ + parser_.offset();
+
+            if (!entries.empty()) entries.back().length = offset - entries.back().offset;
+
+            Entry entry;
+            entry.offset = offset;
+            entry.headers.resize(index_.keys_.size());
+            entries.push_back(std::move(entry));
+        }
+
+        void header(std::string_view key, std::string_view value) override {
+            const auto& keys = index_.keys_;
+
+            for (std::size_t i = 0; i < keys.size(); i++) {
+                if (keys[i] == key) index_.entries_.back().headers[i] = std::string(value);
+            }
+        }
+
+        void startMoves() override {}
+
+        void move(std::string_view, std::string_view) override {}
+
+        void endPgn() override {}
+
+       private:
+        GameIndex& index_;
+        const StreamParser<>& parser_;
+        std::uint64_t base_;
+    };
+
+    static void writeString(std::ostream& os, const std::string& str) {
+        detail::writeVarint(os, str.size());
+        os.write(str.data(), static_cast<std::streamsize>(str.size()));
+    }
+
+    static bool readString(std::istream& is, std::string& str) {
+        std::uint64_t size = 0;
+        if (!detail::readVarint(is, size)) return false;
+
+        // read in chunks, a corrupt size fails at the end of the stream instead of allocating it
+        constexpr std::uint64_t CHUNK = 1 << 16;
+
+        str.clear();
+
+        while (size > 0) {
+            const auto chunk = std::min(size, CHUNK);
+            const auto old   = str.size();
+
+            str.resize(old + chunk);
+            if (!is.read(str.data() + old, static_cast<std::streamsize>(chunk))) return false;
+
+            size -= chunk;
+        }
+
+        return true;
+    }
+
+    static constexpr char MAGIC[4]         = {'P', 'G', 'N', 'I'};
+    static constexpr std::uint64_t VERSION = 1;
+
+    std::vector<std::string> keys_;
+    std::vector<Entry> entries_;
+};
+
+}  // namespace chess::pgn
+
+#include <atomic>
+#include <memory>
+
+
+namespace chess {
+
+/**
+ * @brief xorshift64*, cheap enough to draw a number every ply. Each playout thread owns one,
+ * it is reseeded for every game.
+ */
+class PlayoutRng {
+   public:
+    explicit PlayoutRng(std::uint64_t seed = 1) noexcept { this->seed(seed); }
+
+    /**
+     * @brief Restarts the sequence, any seed (also 0) is mixed with splitmix64 first.
+     * @param seed
+     */
+    void seed(std::uint64_t seed) noexcept {
+        seed += 0x9E3779B97F4A7C15ull;
+        seed = (seed ^ (seed >> 30)) * 0xBF58476D1CE4E5B9ull;
+        seed = (seed ^ (seed >> 27)) * 0x94D049BB133111EBull;
+
+        state_ = (seed ^ (seed >> 31)) | 1;
+    }
+
+    [[nodiscard]] std::uint64_t next() noexcept {
+        state_ ^= state_ >> 12;
+        state_ ^= state_ << 25;
+        state_ ^= state_ >> 27;
+        return state_ * 0x2545F4914F6CDD1Dull;
+    }
+
+    /**
+     * @brief Uniform number in [0, n) without a division.
+     * @param n
+     * @return
+     */
+    [[nodiscard]] std::uint32_t below(std::uint32_t n) noexcept {
+        return static_cast<std::uint32_t>(((next() >> 32) * n) >> 32);
+    }
+
+   private:
+    std::uint64_t state_ = 1;
+};
+
+/**
+ * @brief The default move selection of playout::run, a uniformly random legal move.
+ */
+struct RandomSelector {
+    Move operator()(const Board&, const Movelist& moves, PlayoutRng& rng) const noexcept {
+        return moves[static_cast<int>(rng.below(static_cast<std::uint32_t>(moves.size())))];
+    }
+};
+
+/**
+ * @brief A game played by playout::run.
+ */
+struct PlayoutGame {
+    // number of the game in [0, games), games finish in any order
+    std::uint64_t index = 0;
+    std::vector<Move> moves;
+    // the position before each move, only filled if PlayoutOptions::record_positions is set
+    std::vector<PackedBoard> positions;
+    // NONE if the game was stopped by max_plies or the selector
+    GameResultReason reason = GameResultReason::NONE;
+    // seen from the side to move in the final position, like Board::isGameOver
+    GameResult result = GameResult::NONE;
+};
+
+struct PlayoutOptions {
+    std::string fen     = constants::STARTPOS;
+    bool chess960       = false;
+    std::uint64_t games = 1;
+    // worker threads, 0 uses std::thread::hardware_concurrency()
+    int threads = 1;
+    // game i is played with the seed (seed + i), so the games don't depend on the number of threads
+    std::uint64_t seed = 1;
+    // 0 plays until the game is over
+    int max_plies         = 0;
+    bool record_positions = false;
+    // finished games waiting for the consumer, rounded up to a power of two
+    std::size_t queue_size = 1024;
+};
+
+namespace detail {
+
+/**
+ * @brief Private class, bounded lock-free multi producer multi consumer queue (Vyukov).
+ * Values are swapped in and out of the cells, so that their buffers are reused.
+ */
+template <typename T>
+class PlayoutQueue {
+   public:
+    explicit PlayoutQueue(std::size_t capacity) {
+        std::size_t size = 2;
+        while (size < capacity) size *= 2;
+
+        cells_ = std::make_unique<Cell[]>(size);
+        mask_  = size - 1;
+
+        for (std::size_t i = 0; i < size; ++i) cells_[i].sequence.store(i, std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Moves value into the queue and leaves an old value in its place.
+     * @param value
+     * @return false if the queue is full
+     */
+    bool tryPush(T& value) noexcept {
+        auto pos = tail_.load(std::memory_order_relaxed);
+        Cell* cell;
+
+        while (true) {
+            cell            = &cells_[pos & mask_];
+            const auto seq  = cell->sequence.load(std::memory_order_acquire);
+            const auto diff = static_cast<std::intptr_t>(seq) - static_cast<std::intptr_t>(pos);
+
+            if (diff == 0) {
+                if (tail_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) break;
+            } else if (diff < 0) {
+                return false;
+            } else {
+                pos = tail_.load(std::memory_order_relaxed);
+            }
+        }
+
+        std::swap(cell->value, value);
+        cell->sequence.store(pos + 1, std::memory_order_release);
+
+        return true;
+    }
+
+    /**
+     * @brief Takes the oldest value out of the queue.
+     * @param value
+     * @return false if the queue is empty
+     */
+    bool tryPop(T& value) noexcept {
+        auto pos = head_.load(std::memory_order_relaxed);
+        Cell* cell;
+
+        while (true) {
+            cell            = &cells_[pos & mask_];
+            const auto seq  = cell->sequence.load(std::memory_order_acquire);
+            const auto diff = static_cast<std::intptr_t>(seq) - static_cast<std::intptr_t>(pos + 1);
+
+            if (diff == 0) {
+                if (head_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) break;
+            } else if (diff < 0) {
+                return false;
+            } else {
+                pos = head_.load(std::memory_order_relaxed);
+            }
+        }
+
+        std::swap(cell->value, value);
+        cell->sequence.store(pos + mask_ + 1, std::memory_order_release);
+
+        return true;
+    }
+
+   private:
+    struct Cell {
+        std::atomic<std::size_t> sequence;
+        T value;
+    };
+
+    std::unique_ptr<Cell[]> cells_;
+    std::size_t mask_ = 0;
+
+    // producers and the consumer shouldn't share a cache line
+    alignas(64) std::atomic<std::size_t> tail_ = 0;
+    alignas(64) std::atomic<std::size_t> head_ = 0;
+};
+
+}  // namespace detail
+
+class playout {
+   public:
+    /**
+     * @brief Same result as board.isGameOver(), but reuses the legal moves of the position that a
+     * playout generates anyway, instead of calling anylegalmoves, and only looks for a repetition
+     * once 8 plies were played since the last capture or pawn move.
+     * @param board
+     * @param moves all legal moves of board
+     * @return
+     */
+    [[nodiscard]] static std::pair<GameResultReason, GameResult> gameOver(const Board& board,
+                                                                          const Movelist& moves) noexcept {
+        const auto hfm = board.halfMoveClock();
+
+        if (hfm >= 100) {
+            if (moves.empty() && board.inCheck()) return {GameResultReason::CHECKMATE, GameResult::LOSE};
+            return {GameResultReason::FIFTY_MOVE_RULE, GameResult::DRAW};
+        }
+
+        if (board.isInsufficientMaterial()) return {GameResultReason::INSUFFICIENT_MATERIAL, GameResult::DRAW};
+
+        // the same position comes back 4 plies later at the earliest, 8 plies for a threefold repetition
+        if (hfm >= 8 && board.isRepetition()) return {GameResultReason::THREEFOLD_REPETITION, GameResult::DRAW};
+
+        if (moves.empty()) {
+            if (board.inCheck()) return {GameResultReason::CHECKMATE, GameResult::LOSE};
+            return {GameResultReason::STALEMATE, GameResult::DRAW};
+        }
+
+        return {GameResultReason::NONE, GameResult::NONE};
+    }
+
+    /**
+     * @brief Plays one game into game, the previous content is cleared.
+     * select is called as select(board, legal_moves, rng) and returns the move to play,
+     * NO_MOVE stops the game.
+     * @param start
+     * @param select
+     * @param rng
+     * @param game
+     * @param options
+     */
+    template <typename Select>
+    static void play(const Board& start, Select& select, PlayoutRng& rng, PlayoutGame& game,
+                     const PlayoutOptions& options) {
+        Board board = start;
+        Movelist moves;
+
+        game.moves.clear();
+        game.positions.clear();
+        game.reason = GameResultReason::NONE;
+        game.result = GameResult::NONE;
+
+        while (true) {
+            movegen::legalmoves(moves, board);
+
+            const auto [reason, result] = gameOver(board, moves);
+
+            if (reason != GameResultReason::NONE) {
+                game.reason = reason;
+                game.result = result;
+                return;
+            }
+
+            if (options.max_plies > 0 && static_cast<int>(game.moves.size()) >= options.max_plies) return;
+
+            const Move move = select(board, moves, rng);
+            if (move == Move::NO_MOVE) return;
+
+            if (options.record_positions) game.positions.push_back(Board::Compact::encode(board));
+            game.moves.push_back(move);
+
+            board.makeMove<true>(move);
+        }
+    }
+
+    /**
+     * @brief Plays options.games games on options.threads worker threads, every thread with its
+     * own Board, rng and copy of select. Finished games go through a lock-free queue to the
+     * calling thread, which calls consume(PlayoutGame&) for each of them. consume may move
+     * out of the game. If consume throws, the workers are stopped and the exception is passed on.
+     * @param options
+     * @param consume
+     * @param select see play(), must not throw
+     */
+    template <typename Consume, typename Select = RandomSelector>
+    static void run(const PlayoutOptions& options, Consume&& consume, const Select& select = Select()) {
+        if (options.games == 0) return;
+
+        const auto start = Board(options.fen, options.chess960);
+
+        auto threads = options.threads > 0 ? options.threads : static_cast<int>(std::thread::hardware_concurrency());
+        if (threads <= 0) threads = 1;
+
+        detail::PlayoutQueue<PlayoutGame> queue(options.queue_size);
+        std::atomic<std::uint64_t> next_game = 0;
+        std::atomic<bool> stop               = false;
+
+        auto worker = [&]() {
+            auto thread_select = select;
+            PlayoutRng rng;
+            PlayoutGame game;
+
+            while (!stop.load(std::memory_order_relaxed)) {
+                const auto index = next_game.fetch_add(1, std::memory_order_relaxed);
+                if (index >= options.games) return;
+
+                rng.seed(options.seed + index);
+                play(start, thread_select, rng, game, options);
+                game.index = index;
+
+                while (!queue.tryPush(game)) {
+                    if (stop.load(std::memory_order_relaxed)) return;
+                    std::this_thread::yield();
+                }
+            }
+        };
+
+        // joins the workers also when consume throws
+        struct Workers {
+            std::vector<std::thread> threads;
+            std::atomic<bool>& stop;
+
+            ~Workers() {
+                stop = true;
+                for (auto& thread : threads) thread.join();
+            }
+        } workers{{}, stop};
+
+        for (int i = 0; i < threads; ++i) workers.threads.emplace_back(worker);
+
+        PlayoutGame game;
+
+        for (std::uint64_t received = 0; received < options.games;) {
+            if (!queue.tryPop(game)) {
+                std::this_thread::yield();
+                continue;
+            }
+
+            received++;
+            consume(game);
+        }
+    }
+};
+
+}  // namespace chess
+
+
+
+namespace chess {
+
+namespace detail {
+// file and rank steps of the 8 queen directions (N, NE, E, SE, S, SW, W, NW) and the 8 knight jumps
+constexpr int POLICY_QUEEN_DX[8]  = {0, 1, 1, 1, 0, -1, -1, -1};
+constexpr int POLICY_QUEEN_DY[8]  = {1, 1, 0, -1, -1, -1, 0, 1};
+constexpr int POLICY_KNIGHT_DX[8] = {1, 2, 2, 1, -1, -2, -2, -1};
+constexpr int POLICY_KNIGHT_DY[8] = {2, 1, -1, -2, -2, -1, 1, 2};
+
+// plane of a (file, rank) step, indexed by (dy + 7) * 15 + (dx + 7), -1 if no plane moves that way
+constexpr std::array<std::int8_t, 15 * 15> makePolicyPlanes() {
+    std::array<std::int8_t, 15 * 15> planes = {};
+
+    for (auto& plane : planes) plane = -1;
+
+    for (int dir = 0; dir < 8; ++dir) {
+        for (int dist = 1; dist <= 7; ++dist) {
+            const auto dx = POLICY_QUEEN_DX[dir] * dist;
+            const auto dy = POLICY_QUEEN_DY[dir] * dist;
+
+            planes[(dy + 7) * 15 + (dx + 7)] = static_cast<std::int8_t>(dir * 7 + dist - 1);
+        }
+    }
+
+    for (int i = 0; i < 8; ++i) {
+        planes[(POLICY_KNIGHT_DY[i] + 7) * 15 + (POLICY_KNIGHT_DX[i] + 7)] = static_cast<std::int8_t>(56 + i);
+    }
+
+    return planes;
+}
+
+// destination square of every index, -1 if it lies off the board
+constexpr std::array<std::int8_t, 64 * 73> makePolicyTargets() {
+    std::array<std::int8_t, 64 * 73> targets = {};
+
+    for (int from = 0; from < 64; ++from) {
+        const auto file = from & 7;
+        const auto rank = from >> 3;
+
+        for (int plane = 0; plane < 73; ++plane) {
+            int dx = 0, dy = 0;
+
+            if (plane < 56) {
+                dx = POLICY_QUEEN_DX[plane / 7] * (plane % 7 + 1);
+                dy = POLICY_QUEEN_DY[plane / 7] * (plane % 7 + 1);
+            } else if (plane < 64) {
+                dx = POLICY_KNIGHT_DX[plane - 56];
+                dy = POLICY_KNIGHT_DY[plane - 56];
+            } else {
+                // underpromotions only exist from the 7th rank
+                dx = (plane - 64) / 3 - 1;
+                dy = rank == 6 ? 1 : 8;
+            }
+
+            const auto to_file = file + dx;
+            const auto to_rank = rank + dy;
+            const auto on_board = to_file >= 0 && to_file < 8 && to_rank >= 0 && to_rank < 8;
+
+            targets[from * 73 + plane] = on_board ? static_cast<std::int8_t>(to_rank * 8 + to_file) : -1;
+        }
+    }
+
+    return targets;
+}
+}  // namespace detail
+
+/**
+ * @brief Conversion between moves and the 8x8x73 policy encoding used by AlphaZero.
+ * A move is stored as its origin square and one of 73 planes, index = from * 73 + plane.
+ * - 0-55: queen-like moves, 8 directions (N, NE, E, SE, S, SW, W, NW) times a distance of 1 to 7
+ * - 56-63: knight moves
+ * - 64-72: underpromotions, (left capture, push, right capture) times (knight, bishop, rook)
+ *
+ * Squares are seen from the side to move. For black the board is mirrored vertically, so pawns
+ * always move north. Queen promotions use the queen-like planes and castling is encoded like
+ * Move stores it, as king captures rook.
+ */
+class policy {
+   public:
+    static constexpr int PLANES = 73;
+    static constexpr int SIZE   = 64 * PLANES;
+
+    using Mask = std::bitset<SIZE>;
+
+    /**
+     * @brief Policy index of a move.
+     * @param move
+     * @param stm the side making the move, its squares are mirrored if it is black
+     * @return index in [0, SIZE), -1 if the move can't be encoded (e.g. NO_MOVE)
+     */
+    [[nodiscard]] static constexpr int moveToIndex(const Move& move, Color stm) noexcept {
+        const auto flip = stm == Color::BLACK ? 56 : 0;
+        const auto from = move.from().index() ^ flip;
+        const auto to   = move.to().index() ^ flip;
+
+        const auto dx = (to & 7) - (from & 7);
+        const auto dy = (to >> 3) - (from >> 3);
+
+        if (move.typeOf() == Move::PROMOTION && move.promotionType() != PieceType::QUEEN) {
+            const auto piece = static_cast<int>(move.promotionType()) - static_cast<int>(PieceType::KNIGHT);
+            return from * PLANES + 64 + (dx + 1) * 3 + piece;
+        }
+
+        const auto plane = PLANES_BY_STEP[(dy + 7) * 15 + (dx + 7)];
+
+        return plane < 0 ? -1 : from * PLANES + plane;
+    }
+
+    /**
+     * @brief The move for a policy index in the given position. Castling, en passant and promotions
+     * are derived from the board, the move is not checked for legality.
+     * @param board
+     * @param index
+     * @return NO_MOVE if the index points off the board
+     */
+    [[nodiscard]] static Move indexToMove(const Board& board, int index) noexcept {
+        if (index < 0 || index >= SIZE) return Move::NO_MOVE;
+
+        const auto target = TARGETS[index];
+        if (target < 0) return Move::NO_MOVE;
+
+        const auto stm   = board.sideToMove();
+        const auto flip  = stm == Color::BLACK ? 56 : 0;
+        const auto from  = Square((index / PLANES) ^ flip);
+        const auto to    = Square(target ^ flip);
+        const auto plane = index % PLANES;
+        const auto pt    = board.at<PieceType>(from);
+
+        if (plane >= 64) {
+            const auto promotion = PieceType(static_cast<PieceType::underlying>((plane - 64) % 3 + 1));
+            return Move::make<Move::PROMOTION>(from, to, promotion);
+        }
+
+        if (pt == PieceType::PAWN) {
+            if (Square::back_rank(to, ~stm)) return Move::make<Move::PROMOTION>(from, to, PieceType::QUEEN);
+            if (to == board.enpassantSq()) return Move::make<Move::ENPASSANT>(from, to);
+        }
+
+        if (pt == PieceType::KING && board.at(to) == Piece(PieceType::ROOK, stm)) {
+            return Move::make<Move::CASTLING>(from, to);
+        }
+
+        return Move::make(from, to);
+    }
+
+    /**
+     * @brief Converts a list of moves into policy indices.
+     * @param moves
+     * @param stm
+     * @param out must have room for moves.size() indices
+     */
+    static void movesToIndices(const Movelist& moves, Color stm, std::uint16_t* out) noexcept {
+        for (const auto& move : moves) *out++ = static_cast<std::uint16_t>(moveToIndex(move, stm));
+    }
+
+    /**
+     * @brief Converts policy indices back into moves for the given position, see indexToMove.
+     * @param board
+     * @param indices
+     * @param count
+     * @param out the moves are appended
+     */
+    static void indicesToMoves(const Board& board, const std::uint16_t* indices, std::size_t count,
+                               Movelist& out) noexcept {
+        for (std::size_t i = 0; i < count; ++i) out.add(indexToMove(board, indices[i]));
+    }
+
+    /**
+     * @brief Bitset over the policy space with the indices of all legal moves set.
+     * @param board
+     * @return
+     */
+    [[nodiscard]] static Mask legalMask(const Board& board) {
+        Movelist moves;
+        movegen::legalmoves(moves, board);
+
+        Mask mask;
+        for (const auto& move : moves) mask.set(moveToIndex(move, board.sideToMove()));
+
+        return mask;
+    }
+
+   private:
+    static constexpr auto PLANES_BY_STEP = detail::makePolicyPlanes();
+    static constexpr auto TARGETS        = detail::makePolicyTargets();
+};
+
+}  // namespace chess
+
+#include <fstream>
+#include <map>
+#include <shared_mutex>
+#include <tuple>
+
+
+namespace chess {
+
+/**
+ * @brief Result of a tablebase probe, for the side to move.
+ */
+struct TablebaseResult {
+    GameResult result = GameResult::NONE;
+    // plies until mate, 0 for draws and if the side to move is mated
+    int dtm = 0;
+};
+
+namespace detail {
+
+// values of a table, one byte per position: 0 is a draw, otherwise mate in (value - 1) plies,
+// an odd number of plies is a win for the side to move, an even number a loss
+constexpr std::uint8_t TB_DRAW    = 0;
+constexpr std::uint8_t TB_UNKNOWN = 254;
+constexpr std::uint8_t TB_ILLEGAL = 255;
+constexpr int TB_MAX_PLY          = 252;
+
+// "no value yet" of the generation counters
+constexpr std::uint8_t TB_NONE = 255;
+
+/**
+ * @brief Private class, the table of one material signature like "KRvK", white is the stronger side.
+ * The index has a slot for each piece in signature order, both kings first of their side.
+ * The white king is mapped into a1-d1-d4 (10 squares) by the 8 board symmetries, or into files a-d
+ * (32 squares) by the left-right mirror if there are pawns. A pawn takes the 48 squares of ranks 2-7,
+ * plus 8 files for the pawn that just moved two squares if both sides have pawns and the opponent
+ * can take it en passant. Every other piece takes 64 squares.
+ */
+class TbTable {
+   public:
+    explicit TbTable(const std::string& name) : name_(name) {
+        const auto split = name.find('v');
+
+        for (std::size_t i = 0; i < name.size(); ++i) {
+            if (i == split) continue;
+
+            const auto color = i < split ? Color::WHITE : Color::BLACK;
+            pieces_.push_back(Piece(typeOf(name[i]), color));
+        }
+
+        for (const auto piece : pieces_) {
+            if (piece.type() == PieceType::PAWN) pawns_[piece.color()] = true;
+        }
+
+        size_ = pawns() ? 32 : 10;
+
+        for (std::size_t i = 1; i < pieces_.size(); ++i) {
+            radix_[i] = pieces_[i].type() == PieceType::PAWN ? (enPassant() ? 56 : 48) : 64;
+            size_ *= radix_[i];
+        }
+    }
+
+    [[nodiscard]] const std::string& name() const noexcept { return name_; }
+
+    // positions per side to move
+    [[nodiscard]] std::size_t size() const noexcept { return size_; }
+
+    [[nodiscard]] std::uint8_t at(Color stm, std::size_t index) const noexcept { return data_[stm][index]; }
+
+    /**
+     * @brief Index of a position with the material of this table.
+     * @param board
+     * @param flip the colors of the board are swapped with respect to the table
+     * @return
+     */
+    [[nodiscard]] std::size_t index(const Board& board, bool flip) const noexcept {
+        std::array<int, 5> squares = {};
+        std::size_t i              = 0;
+
+        while (i < pieces_.size()) {
+            const auto piece = pieces_[i];
+            const auto color = flip ? ~piece.color() : piece.color();
+            auto bb          = board.pieces(piece.type(), color);
+
+            while (bb) {
+                const auto sq = bb.pop();
+                squares[i++]  = flip ? sq ^ 56 : sq;
+            }
+        }
+
+        int ep = -1;
+
+        if (board.enpassantSq() != Square::NO_SQ) {
+            const auto pawn = (board.enpassantSq().index() ^ 8) ^ (flip ? 56 : 0);
+            for (std::size_t j = 0; j < pieces_.size(); ++j) {
+                if (squares[j] == pawn && pieces_[j].type() == PieceType::PAWN) ep = static_cast<int>(j);
+            }
+        }
+
+        return canonical(squares, ep);
+    }
+
+    /**
+     * @brief Retrograde analysis of all positions. lookup(board) returns the value of a position
+     * after a capture or promotion, from the tables this one depends on.
+     * @param lookup
+     * @param threads
+     * @return false if a mate is longer than TB_MAX_PLY plies
+     */
+    template <typename Lookup>
+    bool generate(const Lookup& lookup, int threads) {
+        threads = std::max(threads, 1);
+
+        for (int side = 0; side < 2; ++side) {
+            data_[side].assign(size_, TB_UNKNOWN);
+            remaining_[side] = std::make_unique<std::atomic<std::uint8_t>[]>(size_);
+            win_at_[side]    = std::make_unique<std::atomic<std::uint8_t>[]>(size_);
+            loss_at_[side].assign(size_, 0);
+        }
+
+        // the highest ply an out of table result finalizes a position at
+        std::vector<int> pending(threads, 0);
+
+        parallel(size_, threads, [&](std::size_t begin, std::size_t end, int thread) {
+            for (std::size_t index = begin; index < end; ++index) {
+                for (const auto side : {Color::WHITE, Color::BLACK}) {
+                    pending[thread] = std::max(pending[thread], initialize(index, side, lookup));
+                }
+            }
+        });
+
+        const auto max_pending = *std::max_element(pending.begin(), pending.end());
+        bool complete          = true;
+
+        for (int ply = 0;; ++ply) {
+            if (ply > TB_MAX_PLY) {
+                complete = false;
+                break;
+            }
+
+            std::vector<int> finalized(threads, 0);
+
+            parallel(size_, threads, [&](std::size_t begin, std::size_t end, int thread) {
+                for (std::size_t index = begin; index < end; ++index) {
+                    for (int side = 0; side < 2; ++side) finalized[thread] |= finalize(index, side, ply);
+                }
+            });
+
+            if (std::count(finalized.begin(), finalized.end(), 0) == threads && ply >= max_pending) break;
+
+            // the positions finalized at this ply are the ones with the value ply + 1
+            parallel(size_, threads, [&](std::size_t begin, std::size_t end, int) {
+                for (std::size_t index = begin; index < end; ++index) {
+                    for (int side = 0; side < 2; ++side) {
+                        if (data_[side][index] == ply + 1) propagate(index, Color(side), ply);
+                    }
+                }
+            });
+        }
+
+        for (int side = 0; side < 2; ++side) {
+            std::replace(data_[side].begin(), data_[side].end(), TB_UNKNOWN, TB_DRAW);
+
+            remaining_[side].reset();
+            win_at_[side].reset();
+            loss_at_[side] = {};
+        }
+
+        return complete;
+    }
+
+    void write(std::ostream& out) const {
+        out.write(MAGIC, sizeof(MAGIC));
+
+        for (int i = 0; i < 8; ++i) out.put(static_cast<char>((size_ >> (8 * i)) & 0xFF));
+        for (const auto& data : data_) out.write(reinterpret_cast<const char*>(data.data()), data.size());
+    }
+
+    bool read(std::istream& in) {
+        char magic[sizeof(MAGIC)];
+        if (!in.read(magic, sizeof(magic)) || !std::equal(magic, magic + sizeof(magic), MAGIC)) return false;
+
+        std::uint64_t size = 0;
+        for (int i = 0; i < 8; ++i) size |= static_cast<std::uint64_t>(static_cast<unsigned char>(in.get())) << (8 * i);
+        if (!in || size != size_) return false;
+
+        for (auto& data : data_) {
+            data.resize(size_);
+            if (!in.read(reinterpret_cast<char*>(data.data()), size_)) return false;
+        }
+
+        return true;
+    }
+
+    static PieceType typeOf(char c) noexcept {
+        switch (c) {
+            case 'K':
+                return PieceType::KING;
+            case 'Q':
+                return PieceType::QUEEN;
+            case 'R':
+                return PieceType::ROOK;
+            case 'B':
+                return PieceType::BISHOP;
+            case 'N':
+                return PieceType::KNIGHT;
+            case 'P':
+                return PieceType::PAWN;
+            default:
+                return PieceType::NONE;
+        }
+    }
+
+   private:
+    static constexpr char MAGIC[8] = {'C', 'H', 'E', 'S', 'S', 'T', 'B', '2'};
+
+    using Squares = std::array<int, 5>;
+
+    // f(begin, end, thread) on equal parts of [0, size)
+    template <typename F>
+    static void parallel(std::size_t size, int threads, const F& f) {
+        if (threads == 1 || size < 1024) {
+            f(0, size, 0);
+            return;
+        }
+
+        std::vector<std::thread> workers;
+        const auto chunk = size / threads;
+
+        for (int i = 0; i < threads; ++i) {
+            const auto begin = i * chunk;
+            const auto end   = i == threads - 1 ? size : begin + chunk;
+            workers.emplace_back([&f, begin, end, i]() { f(begin, end, i); });
+        }
+
+        for (auto& worker : workers) worker.join();
+    }
+
+    [[nodiscard]] bool pawns() const noexcept { return pawns_[0] || pawns_[1]; }
+
+    // only if both sides have pawns there can be en passant captures
+    [[nodiscard]] bool enPassant() const noexcept { return pawns_[0] && pawns_[1]; }
+
+    // mirror the file (1), the rank (2) and along the a1-h8 diagonal (4)
+    static int transform(int sq, int t) noexcept {
+        int file = sq & 7, rank = sq >> 3;
+        if (t & 4) std::swap(file, rank);
+        if (t & 1) file = 7 - file;
+        if (t & 2) rank = 7 - rank;
+        return rank * 8 + file;
+    }
+
+    [[nodiscard]] int kingSlot(int sq) const noexcept {
+        const int file = sq & 7, rank = sq >> 3;
+
+        if (pawns()) return file < 4 ? rank * 4 + file : -1;
+
+        // a1-d1-d4 triangle
+        if (file > 3 || rank > file) return -1;
+        return file * (file + 1) / 2 + rank;
+    }
+
+    [[nodiscard]] int kingSquare(int slot) const noexcept {
+        if (pawns()) return (slot / 4) * 8 + slot % 4;
+
+        int file = 0;
+        while ((file + 1) * (file + 2) / 2 <= slot) file++;
+        return (slot - file * (file + 1) / 2) * 8 + file;
+    }
+
+    // the value stored in the index, a pawn is stored as 0-47 for ranks 2-7 and as 48 + file if it
+    // can be taken en passant
+    [[nodiscard]] int encoded(int sq, std::size_t i, int ep) const noexcept {
+        if (pieces_[i].type() != PieceType::PAWN) return sq;
+        return static_cast<int>(i) == ep ? 48 + (sq & 7) : sq - 8;
+    }
+
+    [[nodiscard]] std::size_t canonical(const Squares& squares, int ep) const noexcept {
+        auto best = ~std::size_t(0);
+
+        for (int t = 0; t < (pawns() ? 2 : 8); ++t) {
+            const auto slot = kingSlot(transform(squares[0], t));
+            if (slot < 0) continue;
+
+            Squares stored;
+            for (std::size_t i = 0; i < pieces_.size(); ++i) stored[i] = encoded(transform(squares[i], t), i, ep);
+
+            // the same pieces are stored in increasing order
+            for (std::size_t i = 1, start = 1; i <= pieces_.size(); ++i) {
+                if (i < pieces_.size() && pieces_[i] == pieces_[start]) continue;
+                std::sort(stored.begin() + start, stored.begin() + i);
+                start = i;
+            }
+
+            std::size_t index = slot;
+            for (std::size_t i = 1; i < pieces_.size(); ++i) index = index * radix_[i] + stored[i];
+
+            best = std::min(best, index);
+        }
+
+        return best;
+    }
+
+    // squares of the pieces and the pawn that can be taken en passant, false for an unused index
+    bool decode(std::size_t index, Squares& squares, int& ep) const noexcept {
+        const auto original = index;
+        ep                  = -1;
+
+        for (auto i = pieces_.size() - 1; i > 0; --i) {
+            squares[i] = static_cast<int>(index % radix_[i]);
+            index /= radix_[i];
+        }
+
+        squares[0] = kingSquare(static_cast<int>(index));
+
+        Bitboard occupied = 0ull;
+
+        for (std::size_t i = 0; i < pieces_.size(); ++i) {
+            if (pieces_[i].type() == PieceType::PAWN) {
+                if (squares[i] >= 48) {
+                    if (ep != -1) return false;
+                    ep         = static_cast<int>(i);
+                    squares[i] = (pieces_[i].color() == Color::WHITE ? 24 : 32) + squares[i] - 48;
+                } else {
+                    squares[i] += 8;
+                }
+            }
+
+            if (occupied.check(squares[i])) return false;
+            occupied.set(squares[i]);
+        }
+
+        // the pawn came from two squares behind
+        if (ep != -1) {
+            const int dir = pieces_[ep].color() == Color::WHITE ? -8 : 8;
+            if (occupied.check(squares[ep] + dir) || occupied.check(squares[ep] + 2 * dir)) return false;
+        }
+
+        return canonical(squares, ep) == original;
+    }
+
+    [[nodiscard]] Board makeBoard(const Squares& squares, int ep, Color stm) const {
+        PackedBoard packed{};
+        std::array<std::uint8_t, 64> nibbles = {};
+        Bitboard occupied                    = 0ull;
+
+        for (std::size_t i = 0; i < pieces_.size(); ++i) {
+            const auto piece = pieces_[i];
+            auto nibble      = static_cast<std::uint8_t>(piece.internal());
+
+            if (static_cast<int>(i) == ep) nibble = 12;
+            if (piece == Piece::BLACKKING && stm == Color::BLACK) nibble = 15;
+
+            nibbles[squares[i]] = nibble;
+            occupied.set(squares[i]);
+        }
+
+        for (int i = 0; i < 8; ++i) packed[i] = (occupied.getBits() >> (56 - 8 * i)) & 0xFF;
+
+        int offset = 16;
+
+        while (occupied) {
+            packed[offset / 2] |= nibbles[occupied.pop()] << (offset % 2 == 0 ? 4 : 0);
+            offset++;
+        }
+
+        return Board::Compact::decode(packed);
+    }
+
+    // a loss for the child is a win for us one ply later and the other way around
+    static void addChild(std::uint8_t value, std::uint8_t& win_at, std::uint8_t& loss_at) noexcept {
+        if (value == TB_DRAW) {
+            loss_at = TB_NONE;
+            return;
+        }
+
+        const auto ply = value - 1;
+
+        if (ply % 2 == 0) {
+            win_at = std::min<std::uint8_t>(win_at, ply + 1);
+        } else if (loss_at != TB_NONE) {
+            loss_at = std::max<std::uint8_t>(loss_at, ply + 1);
+        }
+    }
+
+    // sets up the counters of a position, returns the highest ply they finalize it at
+    template <typename Lookup>
+    int initialize(std::size_t position, Color side, const Lookup& lookup) {
+        Squares squares;
+        int ep;
+
+        if (!decode(position, squares, ep) || (ep != -1 && pieces_[ep].color() == side)) {
+            data_[side][position] = TB_ILLEGAL;
+            return 0;
+        }
+
+        auto board = makeBoard(squares, ep, side);
+
+        if (board.isAttacked(board.kingSq(~side), side)) {
+            data_[side][position] = TB_ILLEGAL;
+            return 0;
+        }
+
+        Movelist moves;
+        movegen::legalmoves(moves, board);
+
+        if (ep != -1 && std::none_of(moves.begin(), moves.end(),
+                                     [](const Move& move) { return move.typeOf() == Move::ENPASSANT; })) {
+            data_[side][position] = TB_ILLEGAL;
+            return 0;
+        }
+
+        std::uint8_t win_at  = TB_NONE;
+        std::uint8_t loss_at = 0;
+
+        // stalemate
+        if (moves.empty() && !board.inCheck()) loss_at = TB_NONE;
+
+        std::array<std::size_t, constants::MAX_MOVES> children;
+        int count = 0;
+
+        for (const auto& move : moves) {
+            const auto leaves = move.typeOf() == Move::PROMOTION || move.typeOf() == Move::ENPASSANT ||
+                                board.at(move.to()) != Piece::NONE;
+
+            board.makeMove<true>(move);
+
+            if (leaves) {
+                addChild(lookup(board), win_at, loss_at);
+            } else {
+                children[count++] = index(board, false);
+            }
+
+            board.unmakeMove(move);
+        }
+
+        std::sort(children.begin(), children.begin() + count);
+        count = static_cast<int>(std::unique(children.begin(), children.begin() + count) - children.begin());
+
+        remaining_[side][position].store(static_cast<std::uint8_t>(count), std::memory_order_relaxed);
+        win_at_[side][position].store(win_at, std::memory_order_relaxed);
+        loss_at_[side][position] = loss_at;
+
+        return std::max(win_at == TB_NONE ? 0 : win_at, loss_at == TB_NONE ? 0 : loss_at);
+    }
+
+    bool finalize(std::size_t index, int side, int ply) noexcept {
+        auto& value = data_[side][index];
+        if (value != TB_UNKNOWN) return false;
+
+        const auto win_at = win_at_[side][index].load(std::memory_order_relaxed);
+
+        // a win as soon as a child is lost, a loss once all children are won and the out of table ones are reached
+        if (win_at == ply ||
+            (win_at == TB_NONE && remaining_[side][index].load(std::memory_order_relaxed) == 0 &&
+             loss_at_[side][index] <= ply)) {
+            value = static_cast<std::uint8_t>(ply + 1);
+            return true;
+        }
+
+        return false;
+    }
+
+    // adds the predecessor of squares with side to move and the ones where our last move allowed en passant
+    void addPredecessor(const Squares& squares, Color side, std::vector<std::size_t>& out) const {
+        const auto index = canonical(squares, -1);
+        if (data_[side][index] != TB_ILLEGAL) out.push_back(index);
+
+        if (!enPassant()) return;
+
+        for (std::size_t i = 0; i < pieces_.size(); ++i) {
+            const auto piece = pieces_[i];
+            if (piece.type() != PieceType::PAWN || piece.color() == side) continue;
+            if ((squares[i] >> 3) != (piece.color() == Color::WHITE ? 3 : 4)) continue;
+
+            const auto ep_index = canonical(squares, static_cast<int>(i));
+            if (data_[side][ep_index] != TB_ILLEGAL) out.push_back(ep_index);
+        }
+    }
+
+    // un-makes every move of the side that moved last, the predecessors are notified of the result
+    void propagate(std::size_t index, Color side, int ply) {
+        Squares squares;
+        int ep;
+        decode(index, squares, ep);
+
+        const auto mover = ~side;
+        std::vector<std::size_t> predecessors;
+
+        if (ep != -1) {
+            // the pawn came from its second rank
+            auto before = squares;
+            before[ep] += pieces_[ep].color() == Color::WHITE ? -16 : 16;
+            addPredecessor(before, mover, predecessors);
+        } else {
+            Bitboard occupied = 0ull;
+            for (std::size_t i = 0; i < pieces_.size(); ++i) occupied.set(squares[i]);
+
+            for (std::size_t i = 0; i < pieces_.size(); ++i) {
+                const auto piece = pieces_[i];
+                if (piece.color() != mover) continue;
+
+                const auto from = Square(squares[i]);
+                auto before     = squares;
+
+                if (piece.type() == PieceType::PAWN) {
+                    const int dir  = mover == Color::WHITE ? -8 : 8;
+                    const int back = squares[i] + dir;
+                    const int rank = back >> 3;
+
+                    if (rank == 0 || rank == 7 || occupied.check(back)) continue;
+
+                    before[i] = back;
+                    addPredecessor(before, mover, predecessors);
+
+                    const int start = back + dir;
+                    if ((start >> 3) != (mover == Color::WHITE ? 1 : 6) || occupied.check(start)) continue;
+
+                    // this double move leads to the en passant position instead
+                    if (enPassant() && data_[side][canonical(squares, static_cast<int>(i))] != TB_ILLEGAL) continue;
+
+                    before[i] = start;
+                    addPredecessor(before, mover, predecessors);
+                    continue;
+                }
+
+                Bitboard targets;
+
+                switch (piece.type()) {
+                    case PieceType(PieceType::KNIGHT):
+                        targets = attacks::knight(from);
+                        break;
+                    case PieceType(PieceType::BISHOP):
+                        targets = attacks::bishop(from, occupied);
+                        break;
+                    case PieceType(PieceType::ROOK):
+                        targets = attacks::rook(from, occupied);
+                        break;
+                    case PieceType(PieceType::QUEEN):
+                        targets = attacks::queen(from, occupied);
+                        break;
+                    default:
+                        targets = attacks::king(from);
+                        break;
+                }
+
+                targets &= ~occupied;
+
+                while (targets) {
+                    before[i] = targets.pop();
+                    addPredecessor(before, mover, predecessors);
+                }
+            }
+        }
+
+        std::sort(predecessors.begin(), predecessors.end());
+        predecessors.erase(std::unique(predecessors.begin(), predecessors.end()), predecessors.end());
+
+        const bool lost = ply % 2 == 0;
+
+        for (const auto predecessor : predecessors) {
+            if (data_[mover][predecessor] != TB_UNKNOWN) continue;
+
+            if (lost) {
+                win_at_[mover][predecessor].store(static_cast<std::uint8_t>(ply + 1), std::memory_order_relaxed);
+            } else {
+                remaining_[mover][predecessor].fetch_sub(1, std::memory_order_relaxed);
+            }
+        }
+    }
+
+    std::string name_;
+    std::vector<Piece> pieces_;
+    std::array<bool, 2> pawns_ = {false, false};
+    // values of the slot of each piece but the white king
+    std::array<std::size_t, 5> radix_ = {};
+    std::size_t size_                 = 0;
+
+    std::array<std::vector<std::uint8_t>, 2> data_;
+
+    // during generate(): in table children not known to be won by the opponent, the ply a win is
+    // found at and the ply the out of table children lose at the latest, TB_NONE if one draws
+    std::array<std::unique_ptr<std::atomic<std::uint8_t>[]>, 2> remaining_;
+    std::array<std::unique_ptr<std::atomic<std::uint8_t>[]>, 2> win_at_;
+    std::array<std::vector<std::uint8_t>, 2> loss_at_;
+};
+
+}  // namespace detail
+
+/**
+ * @brief Endgame tablebase with win/draw/loss and distance to mate for up to MAX_PIECES pieces,
+ * generated by retrograde analysis when a material is probed for the first time. Positions with
+ * castling rights are not covered and the 50 move rule is ignored. Thread safe, probes of loaded
+ * tables don't wait for a table that is being generated.
+ */
+class Tablebase {
+   public:
+    static constexpr int MAX_PIECES = 5;
+
+    /**
+     * @param directory generated tables are stored here and read back instead of generating them
+     * again, empty keeps them in memory only
+     * @param threads threads used to generate a table
+     */
+    explicit Tablebase(std::string directory = "", int threads = 1)
+        : directory_(std::move(directory)), threads_(threads) {}
+
+    /**
+     * @brief Result of the position, the table of its material is generated or loaded if needed.
+     * @param board
+     * @return std::nullopt for too many pieces, castling rights, an illegal position or a mate longer
+     * than 126 moves
+     */
+    [[nodiscard]] std::optional<TablebaseResult> probe(const Board& board) {
+        if (board.occ().count() > MAX_PIECES || !board.castlingRights().isEmpty()) return std::nullopt;
+
+        // the index has no room for a pawn on its first or last rank
+        const auto edges = Bitboard(Rank::RANK_1) | Bitboard(Rank::RANK_8);
+        if (board.pieces(PieceType::PAWN) & edges) return std::nullopt;
+
+        if (!ensure(material(board))) return std::nullopt;
+
+        std::shared_lock<std::shared_mutex> lock(mutex_);
+
+        const auto value = lookup(board);
+
+        if (value == detail::TB_ILLEGAL) return std::nullopt;
+        if (value == detail::TB_DRAW) return TablebaseResult{GameResult::DRAW, 0};
+
+        const int ply = value - 1;
+        return TablebaseResult{ply % 2 ? GameResult::WIN : GameResult::LOSE, ply};
+    }
+
+    /**
+     * @brief The fastest mate, the slowest loss or a move that holds the draw.
+     * @param board
+     * @return Move::NO_MOVE if the position can't be probed or there are no legal moves
+     */
+    [[nodiscard]] Move bestMove(const Board& board) {
+        if (!probe(board)) return Move::NO_MOVE;
+
+        Movelist moves;
+        movegen::legalmoves(moves, board);
+
+        std::shared_lock<std::shared_mutex> lock(mutex_);
+
+        Move best      = Move::NO_MOVE;
+        int best_score = 0;
+
+        for (const auto& move : moves) {
+            auto child = board;
+            child.makeMove<true>(move);
+
+            // the children are covered by the tables loaded for probe()
+            const auto value = lookup(child);
+            const int ply    = value - 1;
+
+            // quick wins first, then draws, then slow losses
+            const int score = value == detail::TB_DRAW ? 1000 : ply % 2 == 0 ? 2000 - ply : ply;
+
+            if (best == Move::NO_MOVE || score > best_score) {
+                best       = move;
+                best_score = score;
+            }
+        }
+
+        return best;
+    }
+
+    /**
+     * @brief Generates or loads the table of a material like "KBNvK" and the ones it depends on.
+     * @param material
+     * @return false for an invalid material, more than MAX_PIECES pieces or a mate longer than 126 moves
+     */
+    bool generate(std::string_view material) {
+        const auto split = material.find('v');
+
+        if (split == std::string_view::npos || material.size() - 1 > MAX_PIECES) return false;
+
+        std::string white(material.substr(0, split));
+        std::string black(material.substr(split + 1));
+
+        for (auto* side : {&white, &black}) {
+            if (side->empty() || (*side)[0] != 'K') return false;
+            if (std::count(side->begin(), side->end(), 'K') != 1) return false;
+
+            for (const auto c : *side) {
+                if (detail::TbTable::typeOf(c) == PieceType::NONE) return false;
+            }
+
+            std::sort(side->begin() + 1, side->end(), [](char a, char b) { return order(a) < order(b); });
+        }
+
+        return ensure(stronger(black, white) ? black + "v" + white : white + "v" + black);
+    }
+
+    /**
+     * @brief Material signature of a position, the stronger side first, e.g. "KRPvKR".
+     * @param board
+     * @return
+     */
+    [[nodiscard]] static std::string material(const Board& board) {
+        const auto white = side(board, Color::WHITE);
+        const auto black = side(board, Color::BLACK);
+
+        return stronger(black, white) ? black + "v" + white : white + "v" + black;
+    }
+
+   private:
+    static constexpr std::string_view ORDER = "KQRBNP";
+
+    static int order(char c) noexcept { return static_cast<int>(ORDER.find(c)); }
+
+    static std::string side(const Board& board, Color color) {
+        std::string pieces;
+
+        for (const auto c : ORDER) {
+            const auto count = board.pieces(detail::TbTable::typeOf(c), color).count();
+            pieces.append(count, c);
+        }
+
+        return pieces;
+    }
+
+    // more pieces, or the better piece at the first difference
+    static bool stronger(const std::string& a, const std::string& b) noexcept {
+        if (a.size() != b.size()) return a.size() > b.size();
+
+        for (std::size_t i = 0; i < a.size(); ++i) {
+            if (a[i] != b[i]) return order(a[i]) < order(b[i]);
+        }
+
+        return false;
+    }
+
+    static bool insufficient(const std::string& name) noexcept {
+        return name == "KvK" || name == "KBvK" || name == "KNvK";
+    }
+
+    // value of a position whose table is loaded, requires a shared lock of mutex_ or load_mutex_
+    std::uint8_t lookup(const Board& board) const {
+        const auto name = material(board);
+        if (insufficient(name)) return detail::TB_DRAW;
+
+        const auto& table = *tables_.at(name);
+
+        // the board has the colors of the table if white is at least as strong
+        const bool flip = name.compare(0, name.find('v'), side(board, Color::WHITE)) != 0;
+        const auto stm  = flip ? ~board.sideToMove() : board.sideToMove();
+
+        return table.at(stm, table.index(board, flip));
+    }
+
+    // loads the table unless it is there already, only one table is loaded at a time
+    bool ensure(const std::string& name) {
+        if (insufficient(name)) return true;
+
+        {
+            std::shared_lock<std::shared_mutex> lock(mutex_);
+
+            const auto it = tables_.find(name);
+            if (it != tables_.end()) return it->second != nullptr;
+        }
+
+        std::lock_guard<std::mutex> lock(load_mutex_);
+
+        return load(name);
+    }
+
+    // loads or generates a table and its dependencies, requires load_mutex_. Only load() changes
+    // tables_, so it reads it without mutex_ and takes that exclusively for an insert only
+    bool load(const std::string& name) {
+        if (insufficient(name)) return true;
+
+        const auto it = tables_.find(name);
+        if (it != tables_.end()) return it->second != nullptr;
+
+        const auto split = name.find('v');
+        const auto white = name.substr(0, split);
+        const auto black = name.substr(split + 1);
+
+        // every material a capture and/or promotion leads to
+        for (const auto& [us, them, white_moves] : {std::tuple{white, black, true}, std::tuple{black, white, false}}) {
+            for (std::size_t i = 1; i < them.size(); ++i) {
+                if (!load(join(us, erase(them, i), white_moves))) return failed(name);
+            }
+
+            const auto pawn = us.find('P');
+            if (pawn == std::string::npos) continue;
+
+            for (const char promoted : {'Q', 'R', 'B', 'N'}) {
+                auto after = erase(us, pawn) + promoted;
+                std::sort(after.begin() + 1, after.end(), [](char a, char b) { return order(a) < order(b); });
+
+                if (!load(join(after, them, white_moves))) return failed(name);
+
+                for (std::size_t i = 1; i < them.size(); ++i) {
+                    if (!load(join(after, erase(them, i), white_moves))) return failed(name);
+                }
+            }
+        }
+
+        auto table = std::make_unique<detail::TbTable>(name);
+        const auto path = directory_.empty() ? std::string() : directory_ + "/" + name + ".ctb";
+
+        std::ifstream in(path, std::ios::binary);
+
+        if (path.empty() || !in.is_open() || !table->read(in)) {
+            if (!table->generate([this](const Board& board) { return lookup(board); }, threads_)) {
+                return failed(name);
+            }
+
+            if (!path.empty()) {
+                std::ofstream out(path, std::ios::binary);
+                table->write(out);
+            }
+        }
+
+        insert(name, std::move(table));
+
+        return true;
+    }
+
+    bool failed(const std::string& name) {
+        insert(name, nullptr);
+        return false;
+    }
+
+    void insert(const std::string& name, std::unique_ptr<detail::TbTable> table) {
+        std::lock_guard<std::shared_mutex> lock(mutex_);
+        tables_[name] = std::move(table);
+    }
+
+    static std::string erase(std::string pieces, std::size_t i) { return pieces.erase(i, 1); }
+
+    static std::string join(const std::string& us, const std::string& them, bool white) {
+        const auto& w = white ? us : them;
+        const auto& b = white ? them : us;
+        return stronger(b, w) ? b + "v" + w : w + "v" + b;
+    }
+
+    std::string directory_;
+    int threads_;
+
+    // mutex_ guards tables_ against the inserts, load_mutex_ lets one thread at a time load tables
+    std::shared_mutex mutex_;
+    std::mutex load_mutex_;
+    std::map<std::string, std::unique_ptr<detail::TbTable>> tables_;
+};
+
+}  // namespace chess
+
+#include <cstdlib>
+#include <new>
+#include <type_traits>
+
+#if defined(_WIN32)
+#    include <malloc.h>
+#elif defined(__linux__)
+#    include <sys/mman.h>
+#endif
+
+#if defined(_MSC_VER)
+#    include <xmmintrin.h>
+#endif
+
+namespace chess {
+
+/**
+ * @brief Hash table shared by search threads, keyed by Board::hash(). Entry can be any trivially
+ * copyable type, e.g. move, score and bound of a search or the node count of a perft.
+ * Slots are read and written without locks. The stored key is xor'ed with the entry, so an entry
+ * torn by two threads writing at once fails the next probe. The lower 48 bits of the key are
+ * verified and the upper bits select the cluster, so the whole key is compared once the table has
+ * at least 2^16 clusters. A cluster holds as many slots as fit into a cache line.
+ */
+template <typename Entry>
+class TranspositionTable {
+    static_assert(std::is_trivially_copyable_v<Entry>, "Entry must be trivially copyable");
+
+   public:
+    // depths outside [MIN_DEPTH, MAX_DEPTH] are clamped
+    static constexpr int MIN_DEPTH = -16;
+    static constexpr int MAX_DEPTH = MIN_DEPTH + 254;
+
+    TranspositionTable() = default;
+
+    explicit TranspositionTable(std::size_t mb) { resize(mb); }
+
+    ~TranspositionTable() { deallocate(); }
+
+    TranspositionTable(const TranspositionTable&)            = delete;
+    TranspositionTable& operator=(const TranspositionTable&) = delete;
+
+    /**
+     * @brief Reallocates the table with the given size, all entries are lost. 0 frees it, a table
+     * without memory finds nothing and stores nothing. Uses huge pages on Linux if the kernel allows it.
+     * Throws std::bad_alloc if the memory can't be allocated, with CHESS_NO_EXCEPTIONS the table stays empty.
+     * @param mb
+     * @param threads threads that clear the new memory
+     */
+    void resize(std::size_t mb, int threads = 1) {
+        deallocate();
+
+        const auto count = mb * 1024 * 1024 / sizeof(Cluster);
+        if (count == 0) return;
+
+        if (!allocate(count)) {
+#ifndef CHESS_NO_EXCEPTIONS
+            throw std::bad_alloc();
+#else
+            return;
+#endif
+        }
+
+        zero(threads, true);
+    }
+
+    /**
+     * @brief Empties all slots, split over the given number of threads.
+     * @param threads
+     */
+    void clear(int threads = 1) { zero(threads, false); }
+
+    /**
+     * @brief Ages all entries, call it between two searches and not during one. Entries of older
+     * searches are replaced first.
+     */
+    void newSearch() noexcept { generation_ = static_cast<std::uint8_t>(generation_ + 1); }
+
+    /**
+     * @brief Starts loading the cluster of key into the cache, e.g. with the key of
+     * Board::zobristAfter(move) before making the move.
+     * @param key
+     */
+    void prefetch(std::uint64_t key) const noexcept {
+        if (!clusters_) return;
+
+#if defined(_MSC_VER)
+        _mm_prefetch(reinterpret_cast<const char*>(&clusters_[index(key)]), _MM_HINT_T0);
+#else
+        __builtin_prefetch(&clusters_[index(key)]);
+#endif
+    }
+
+    /**
+     * @brief Looks up the entry of key.
+     * @param key
+     * @param entry set if found
+     * @param depth set to the depth the entry was stored with, if found
+     * @return
+     */
+    [[nodiscard]] bool probe(std::uint64_t key, Entry& entry, int& depth) const noexcept {
+        if (!clusters_) return false;
+
+        for (const auto& slot : clusters_[index(key)].slots) {
+            const auto meta = slot.meta.load(std::memory_order_relaxed);
+            if (!(meta & DEPTH_MASK)) continue;
+
+            std::uint64_t words[WORDS];
+            if (!matches(slot, meta, key, words)) continue;
+
+            std::memcpy(&entry, words, sizeof(Entry));
+            depth = unpackDepth(meta);
+            return true;
+        }
+
+        return false;
+    }
+
+    [[nodiscard]] bool probe(std::uint64_t key, Entry& entry) const noexcept {
+        int depth;
+        return probe(key, entry, depth);
+    }
+
+    /**
+     * @brief Stores an entry. An entry of the same key is only overwritten by one of at least its
+     * depth or if it is from an older search. Otherwise the slot of the cluster with the lowest
+     * depth minus 8 per search of age is replaced, empty slots first.
+     * @param key
+     * @param depth
+     * @param entry
+     */
+    void store(std::uint64_t key, int depth, const Entry& entry) noexcept {
+        if (!clusters_) return;
+
+        depth = std::clamp(depth, MIN_DEPTH, MAX_DEPTH);
+
+        Slot* replace = nullptr;
+        int worst     = INT_MAX;
+
+        for (auto& slot : clusters_[index(key)].slots) {
+            const auto meta = slot.meta.load(std::memory_order_relaxed);
+
+            if (!(meta & DEPTH_MASK)) {
+                if (worst != INT_MIN) {
+                    replace = &slot;
+                    worst   = INT_MIN;
+                }
+
+                continue;
+            }
+
+            std::uint64_t words[WORDS];
+
+            if (matches(slot, meta, key, words)) {
+                if (depth < unpackDepth(meta) && age(meta) == 0) return;
+                replace = &slot;
+                break;
+            }
+
+            const auto value = unpackDepth(meta) - 8 * age(meta);
+
+            if (value < worst) {
+                replace = &slot;
+                worst   = value;
+            }
+        }
+
+        std::uint64_t words[WORDS] = {};
+        std::memcpy(words, &entry, sizeof(Entry));
+
+        for (std::size_t i = 0; i < WORDS; ++i) replace->data[i].store(words[i], std::memory_order_relaxed);
+
+        const auto depth_bits      = static_cast<std::uint64_t>(depth - MIN_DEPTH + 1) << 48;
+        const auto generation_bits = static_cast<std::uint64_t>(generation_) << 56;
+        replace->meta.store(((key ^ fold(words)) & KEY_MASK) | depth_bits | generation_bits, std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Permille of the slots used by the current search, sampled from the first 1000 clusters,
+     * as reported by UCI engines in "info hashfull".
+     * @return
+     */
+    [[nodiscard]] int hashfull() const noexcept {
+        const auto sample = std::min<std::size_t>(count_, 1000);
+        std::size_t used  = 0;
+
+        for (std::size_t i = 0; i < sample; ++i) {
+            for (const auto& slot : clusters_[i].slots) {
+                const auto meta = slot.meta.load(std::memory_order_relaxed);
+                used += (meta & DEPTH_MASK) && age(meta) == 0;
+            }
+        }
+
+        return sample ? static_cast<int>(used * 1000 / (sample * SLOTS)) : 0;
+    }
+
+    /**
+     * @brief Number of entries the table can hold.
+     * @return
+     */
+    [[nodiscard]] std::size_t size() const noexcept { return count_ * SLOTS; }
+
+   private:
+    static constexpr std::size_t WORDS = (sizeof(Entry) + 7) / 8;
+
+    // meta word: generation (8 bits) | depth - MIN_DEPTH + 1, 0 if empty (8 bits) | key ^ entry (lower 48 bits)
+    static constexpr std::uint64_t KEY_MASK   = 0xFFFFFFFFFFFFull;
+    static constexpr std::uint64_t DEPTH_MASK = 0xFFull << 48;
+
+    struct Slot {
+        std::atomic<std::uint64_t> meta;
+        std::atomic<std::uint64_t> data[WORDS];
+    };
+
+    static constexpr std::size_t SLOTS = sizeof(Slot) >= 64 ? 1 : 64 / sizeof(Slot);
+
+    struct alignas(64) Cluster {
+        Slot slots[SLOTS];
+    };
+
+    // mixed with a multiplication, a plain xor would let words of two different entries cancel out
+    static std::uint64_t fold(const std::uint64_t (&words)[WORDS]) noexcept {
+        std::uint64_t folded = 0;
+        for (const auto word : words) folded = (folded ^ word) * 0x9E3779B97F4A7C15ull;
+        return folded;
+    }
+
+    static int unpackDepth(std::uint64_t meta) noexcept {
+        return static_cast<int>((meta >> 48) & 0xFF) + MIN_DEPTH - 1;
+    }
+
+    static bool matches(const Slot& slot, std::uint64_t meta, std::uint64_t key,
+                        std::uint64_t (&words)[WORDS]) noexcept {
+        for (std::size_t i = 0; i < WORDS; ++i) words[i] = slot.data[i].load(std::memory_order_relaxed);
+        return ((meta ^ key ^ fold(words)) & KEY_MASK) == 0;
+    }
+
+    int age(std::uint64_t meta) const noexcept { return static_cast<std::uint8_t>(generation_ - (meta >> 56)); }
+
+    // the upper 32 bits pick the cluster, the lower 48 are verified
+    std::size_t index(std::uint64_t key) const noexcept {
+        return static_cast<std::size_t>(((key >> 32) * static_cast<std::uint64_t>(count_)) >> 32);
+    }
+
+    bool allocate(std::size_t count) {
+        auto bytes   = count * sizeof(Cluster);
+        void* memory = nullptr;
+
+#if defined(_WIN32)
+        memory = _aligned_malloc(bytes, alignof(Cluster));
+#else
+        std::size_t alignment = alignof(Cluster);
+
+#    if defined(__linux__) && defined(MADV_HUGEPAGE)
+        // 2 MB aligned, so that the kernel can back the whole table with transparent huge pages
+        constexpr std::size_t HUGE_PAGE = 2 * 1024 * 1024;
+
+        if (bytes >= HUGE_PAGE) {
+            alignment = HUGE_PAGE;
+            bytes     = (bytes + HUGE_PAGE - 1) / HUGE_PAGE * HUGE_PAGE;
+        }
+#    endif
+
+        if (posix_memalign(&memory, alignment, bytes) != 0) memory = nullptr;
+
+#    if defined(__linux__) && defined(MADV_HUGEPAGE)
+        if (memory) madvise(memory, bytes, MADV_HUGEPAGE);
+#    endif
+#endif
+
+        clusters_ = static_cast<Cluster*>(memory);
+        count_    = memory ? count : 0;
+
+        return memory != nullptr;
+    }
+
+    void deallocate() noexcept {
+        if (!clusters_) return;
+
+#if defined(_WIN32)
+        _aligned_free(clusters_);
+#else
+        std::free(clusters_);
+#endif
+
+        clusters_ = nullptr;
+        count_    = 0;
+    }
+
+    // zeroes all clusters on the given threads. With construct the clusters of fresh memory start
+    // their lifetime in the same loop, so every page is written once and by the thread that zeroes it
+    void zero(int threads, bool construct) {
+        const auto fill = [this, construct](std::size_t begin, std::size_t end) {
+            for (std::size_t i = begin; i < end; ++i) {
+                // default initialization, the atomics are not written here
+                if (construct) new (&clusters_[i]) Cluster;
+
+                for (auto& slot : clusters_[i].slots) {
+                    slot.meta.store(0, std::memory_order_relaxed);
+                    for (auto& word : slot.data) word.store(0, std::memory_order_relaxed);
+                }
+            }
+        };
+
+        generation_ = 0;
+
+        if (threads <= 1 || count_ < static_cast<std::size_t>(threads)) {
+            fill(0, count_);
+            return;
+        }
+
+        std::vector<std::thread> workers;
+        const auto chunk = count_ / threads;
+
+        for (int i = 0; i < threads; ++i) {
+            const auto begin = i * chunk;
+            const auto end   = i == threads - 1 ? count_ : begin + chunk;
+            workers.emplace_back(fill, begin, end);
+        }
+
+        for (auto& worker : workers) worker.join();
+    }
+
+    Cluster* clusters_       = nullptr;
+    std::size_t count_       = 0;
+    std::uint8_t generation_ = 0;
+};
+
+}  // namespace chess
+
+#include <charconv>
+
+
+namespace chess {
+class uci {
+   public:
+    /**
+     * @brief Maximum number of characters written by the buffer version of moveToUci.
+     */
+    static constexpr std::size_t MAX_UCI_LENGTH = 5;
+
+    /**
+     * @brief Converts an internal move to a UCI string
+     * @param move
+     * @param chess960
+     * @return
+     */
+    [[nodiscard]] static std::string moveToUci(const Move& move, bool chess960 = false) noexcept(false) {
+        char buffer[MAX_UCI_LENGTH];
+        return std::string(buffer, moveToUci(move, buffer, chess960));
+    }
+
+    /**
+     * @brief Writes the UCI string of a move into out, without allocating.
+     * @param move
+     * @param out must have room for MAX_UCI_LENGTH characters, no null terminator is written
+     * @param chess960
+     * @return the number of characters written
+     */
+    static std::size_t moveToUci(const Move& move, char* out, bool chess960 = false) noexcept {
+        const auto from = move.from().index();
+        auto to         = move.to().index();
+
+        // castling is stored as king captures rook, outside of chess960 the king goes to the g or c file
+        if (!chess960 && move.typeOf() == Move::CASTLING) {
+            to = (from & 56) | (to > from ? 6 : 2);
+        }
+
+        std::memcpy(out, SQUARE_NAMES + 2 * from, 2);
+        std::memcpy(out + 2, SQUARE_NAMES + 2 * to, 2);
+
+        if (move.typeOf() != Move::PROMOTION) return 4;
+
+        out[4] = "nbrq"[(move.move() >> 12) & 3];
+        return 5;
+    }
+
+    /**
+     * @brief Converts a UCI string to an internal move.
+     * @param board
+     * @param uci
+     * @return
+     */
+    [[nodiscard]] static Move uciToMove(const Board& board, std::string_view uci) noexcept(false) {
+        if (uci.length() < 4) {
+            return Move::NO_MOVE;
+        }
+
+        Square source = Square(uci.substr(0, 2));
+        Square target = Square(uci.substr(2, 2));
+
+        if (!source.is_valid() || !target.is_valid()) {
+            return Move::NO_MOVE;
+        }
+
+        auto pt = board.at(source).type();
+
+        // castling in chess960
+        if (board.chess960() && pt == PieceType::KING && board.at(target).type() == PieceType::ROOK &&
+            board.at(target).color() == board.sideToMove()) {
+            return Move::make<Move::CASTLING>(source, target);
+        }
+
+        // convert to king captures rook
+        // in chess960 the move should be sent as king captures rook already!
+        if (!board.chess960() && pt == PieceType::KING && Square::distance(target, source) == 2) {
+            target = Square(target > source ? File::FILE_H : File::FILE_A, source.rank());
+            return Move::make<Move::CASTLING>(source, target);
+        }
+
+        // en passant
+        if (pt == PieceType::PAWN && target == board.enpassantSq()) {
+            return Move::make<Move::ENPASSANT>(source, target);
+        }
+
+        // promotion
+        if (pt == PieceType::PAWN && uci.length() == 5 && Square::back_rank(target, ~board.sideToMove())) {
+            auto promotion = PieceType(uci.substr(4, 1));
+
+            if (promotion == PieceType::NONE || promotion == PieceType::KING || promotion == PieceType::PAWN) {
+                return Move::NO_MOVE;
+            }
+
+            return Move::make<Move::PROMOTION>(source, target, PieceType(uci.substr(4, 1)));
+        }
+
+        return (uci.length() == 4) ? Move::make<Move::NORMAL>(source, target) : Move::NO_MOVE;
+    }
+
+    /**
+     * @brief Converts a UCI string to a legal move. Same as uciToMove followed by movegen::isLegal,
+     * but the squares are decoded without branching and normal moves are validated against the
+     * mailbox and a single king attack test instead of the full check and pin masks.
+     * It is stricter in two cases: a fifth character on a king move is rejected, and only a king
+     * move of two files on the same rank is read as castling.
+     * Meant for protocol handlers replaying long "position ... moves" commands.
+     * @param board
+     * @param uci
+     * @return NO_MOVE if the string is malformed or the move is not legal.
+     */
+    [[nodiscard]] static Move uciToMoveChecked(const Board& board, std::string_view uci) noexcept {
+        if (uci.length() != 4 && uci.length() != 5) return Move::NO_MOVE;
+
+        // characters outside of a-h and 1-8 wrap around to values above 7
+        const auto from_file = static_cast<unsigned>(uci[0] - 'a');
+        const auto from_rank = static_cast<unsigned>(uci[1] - '1');
+        const auto to_file   = static_cast<unsigned>(uci[2] - 'a');
+        const auto to_rank   = static_cast<unsigned>(uci[3] - '1');
+
+        if ((from_file | from_rank | to_file | to_rank) > 7) return Move::NO_MOVE;
+
+        const auto source = Square(static_cast<int>(from_rank * 8 + from_file));
+        auto target       = Square(static_cast<int>(to_rank * 8 + to_file));
+        const auto pt     = board.at<PieceType>(source);
+
+        std::uint16_t type      = Move::NORMAL;
+        std::uint16_t promotion = 0;
+
+        if (uci.length() == 5) {
+            promotion = promotionIndex(uci[4]);
+            if (pt != PieceType::PAWN || promotion > 3) return Move::NO_MOVE;
+            type = Move::PROMOTION;
+        } else if (pt == PieceType::KING) {
+            if (board.chess960()) {
+                // in chess960 castling is sent as king captures rook
+                if (board.at(target) == Piece(PieceType::ROOK, board.sideToMove())) type = Move::CASTLING;
+            } else if (from_rank == to_rank && (from_file + 2 == to_file || to_file + 2 == from_file)) {
+                type   = Move::CASTLING;
+                target = Square(to_file > from_file ? File::FILE_H : File::FILE_A, source.rank());
+            }
+        } else if (pt == PieceType::PAWN && target == board.enpassantSq()) {
+            type = Move::ENPASSANT;
+        }
+
+        const auto move = Move(static_cast<std::uint16_t>(type | (promotion << 12) | (source.index() << 6) |
+                                                          target.index()));
+
+        // castling and en passant are rare enough to go through the full check
+        if (type == Move::CASTLING || type == Move::ENPASSANT) {
+            return movegen::isLegal(board, move) ? move : Move::NO_MOVE;
+        }
+
+        return isLegalNormal(board, move, pt) ? move : Move::NO_MOVE;
+    }
+
+    /**
+     * @brief Maximum number of characters written by the buffer versions of moveToSan and moveToLan.
+     */
+    static constexpr std::size_t MAX_SAN_LENGTH = 10;
+
+    /**
+     * @brief Converts a move to a SAN string
+     * @param board
+     * @param move
+     * @return
+     */
+    [[nodiscard]] static std::string moveToSan(const Board& board, const Move& move) noexcept(false) {
+        char san[MAX_SAN_LENGTH];
+        return std::string(san, moveToSan(board, move, san));
+    }
+
+    /**
+     * @brief Writes the SAN of a move into out, which needs room for MAX_SAN_LENGTH characters.
+     * No null terminator is written. The board is not copied, a scratch board is only used
+     * to decide between + and # when the move gives check.
+     * @param board
+     * @param move
+     * @param out
+     * @return number of characters written
+     */
+    static std::size_t moveToSan(const Board& board, const Move& move, char* out) {
+        return writeRep<false>(board, move, out);
+    }
+
+    /**
+     * @brief Appends the moves as PGN movetext with move numbers, e.g. "1. e4 e5 2. Nf3", to out.
+     * If black moves first the text starts with "N...". The moves have to be legal.
+     * The line is played once on the board, so the mate check after a checking move can run
+     * directly on it instead of on a scratch board.
+     * @param board starting position
+     * @param moves
+     * @param count
+     * @param out
+     */
+    static void gameToSan(Board board, const Move* moves, std::size_t count, std::string& out) {
+        for (std::size_t i = 0; i < count; ++i) {
+            const auto& move = moves[i];
+
+            if (i > 0) out += ' ';
+
+            if (board.sideToMove() == Color::WHITE || i == 0) {
+                char number[16];
+                const auto end = std::to_chars(number, number + sizeof(number), board.fullMoveNumber()).ptr;
+
+                out.append(number, end);
+                out += board.sideToMove() == Color::WHITE ? ". " : "... ";
+            }
+
+            char san[MAX_SAN_LENGTH];
+            char* p = writeMoveText<false>(board, move, san);
+
+            board.makeMove(move);
+
+            if (board.inCheck()) *p++ = movegen::anylegalmoves(board) ? '+' : '#';
+
+            out.append(san, p);
+        }
+    }
+
+    /**
+     * @brief Appends the moves as PGN movetext with move numbers to out.
+     * @param board starting position
+     * @param moves
+     * @param out
+     */
+    static void gameToSan(const Board& board, const std::vector<Move>& moves, std::string& out) {
+        gameToSan(board, moves.data(), moves.size(), out);
+    }
+
+    /**
+     * @brief Converts a move to a LAN string
+     * @param board
+     * @param move
+     * @return
+     */
+    [[nodiscard]] static std::string moveToLan(const Board& board, const Move& move) noexcept(false) {
+        char lan[MAX_SAN_LENGTH];
+        return std::string(lan, moveToLan(board, move, lan));
+    }
+
+    /**
+     * @brief Writes the LAN of a move into out, which needs room for MAX_SAN_LENGTH characters.
+     * No null terminator is written.
+     * @param board
+     * @param move
+     * @param out
+     * @return number of characters written
+     */
+    static std::size_t moveToLan(const Board& board, const Move& move, char* out) {
+        return writeRep<true>(board, move, out);
+    }
+
+    class SanParseError : public std::exception {
+       public:
+        explicit SanParseError(const char* message) : msg_(message) {}
+
+        explicit SanParseError(const std::string& message) : msg_(message) {}
+
+        virtual ~SanParseError() noexcept {}
+
+        virtual const char* what() const noexcept { return msg_.c_str(); }
+
+       protected:
+        std::string msg_;
+    };
+
+    class AmbiguousMoveError : public std::exception {
+       public:
+        explicit AmbiguousMoveError(const char* message) : msg_(message) {}
+
+        explicit AmbiguousMoveError(const std::string& message) : msg_(message) {}
+
+        virtual ~AmbiguousMoveError() noexcept {}
+
+        virtual const char* what() const noexcept { return msg_.c_str(); }
+
+       protected:
+        std::string msg_;
+    };
+
+    /**
+     * @brief Reasons for tryParseSan to fail.
+     */
+    enum class SanError : std::uint8_t {
+        NONE,              // parsed successfully
+        EMPTY,             // the string is empty
+        INVALID_SYNTAX,    // not SAN, e.g. an unknown piece, a missing square or a bad promotion piece
+        ILLEGAL_CASTLING,  // castling is written correctly but not possible in this position
+        ILLEGAL_MOVE,      // well formed, but no legal move matches
+        AMBIGUOUS,         // more than one legal move matches
+    };
+
+    /**
+     * @brief Parse a san string and return the move.
+     * This function will throw a SanParseError if the san string is invalid.
+     * @param board
+     * @param san
+     * @return
+     */
+    [[nodiscard]] static Move parseSan(const Board& board, std::string_view san) noexcept(false) {
+        Movelist moves;
+
+        return parseSan(board, san, moves);
+    }
+
+    /**
+     * @brief Parse a san string and return the move.
+     * This function will throw a SanParseError if the san string is invalid.
+     * The move is found by looking at the pieces which attack the destination square,
+     * afterwards moves contains the legal moves which matched the san.
+     * @param board
+     * @param san
+     * @param moves
+     * @return
+     */
+    [[nodiscard]] static Move parseSan(const Board& board, std::string_view san, Movelist& moves) noexcept(false) {
+        Move move;
+
+        const auto error = tryParseSan(board, san, move, moves);
+
+#ifndef CHESS_NO_EXCEPTIONS
+        switch (error) {
+            case SanError::INVALID_SYNTAX:
+                // same messages as before tryParseSan existed
+                if (san.length() < 2) throw SanParseError("Failed to parse san. At step 0: " + std::string(san));
+                throw SanParseError("Failed to parse san. At step 1: " + std::string(san));
+            case SanError::ILLEGAL_CASTLING:
+                throw SanParseError("Failed to parse san. At step 2: " + std::string(san) + " " + board.getFen());
+            case SanError::ILLEGAL_MOVE:
+                throw SanParseError("Failed to parse san, illegal move: " + std::string(san) + " " + board.getFen());
+            case SanError::AMBIGUOUS:
+                throw AmbiguousMoveError("Ambiguous san: " + std::string(san) + " in " + board.getFen());
+            default:
+                break;
+        }
+#else
+        static_cast<void>(error);
+#endif
 
-       protected:
-        std::string msg_;
-    };
+        return move;
+    }
 
     /**
-     * @brief Parse a san string and return the move.
-     * This function will throw a SanParseError if the san string is invalid.
+     * @brief Parse a san string without throwing or allocating, for skipping bad moves cheaply.
      * @param board
      * @param san
-     * @return
+     * @param move set to the parsed move, or NO_MOVE on failure
+     * @return SanError::NONE on success, otherwise why the san was rejected
      */
-    [[nodiscard]] static Move parseSan(const Board& board, std::string_view san) noexcept(false) {
+    static SanError tryParseSan(const Board& board, std::string_view san, Move& move) noexcept {
         Movelist moves;
-
-        return parseSan(board, san, moves);
+        return tryParseSan(board, san, move, moves);
     }
 
     /**
-     * @brief Parse a san string and return the move.
-     * This function will throw a SanParseError if the san string is invalid.
+     * @brief Parse a san string without throwing or allocating, for skipping bad moves cheaply.
+     * Afterwards moves contains the legal moves which matched the san.
      * @param board
      * @param san
+     * @param move set to the parsed move, or NO_MOVE on failure
      * @param moves
-     * @return
+     * @return SanError::NONE on success, otherwise why the san was rejected
      */
-    [[nodiscard]] static Move parseSan(const Board& board, std::string_view san, Movelist& moves) noexcept(false) {
-        if (san.empty()) {
-            return Move::NO_MOVE;
-        }
-
-        static constexpr auto pt_to_pgt = [](PieceType pt) { return 1 << (pt); };
-        const SanMoveInformation info   = parseSanInfo(san);
+    static SanError tryParseSan(const Board& board, std::string_view san, Move& move, Movelist& moves) noexcept {
+        move = Move::NO_MOVE;
+        moves.clear();
 
-        if (info.capture) {
-            movegen::legalmoves<movegen::MoveGenType::CAPTURE>(moves, board, pt_to_pgt(info.piece));
-        } else {
-            movegen::legalmoves<movegen::MoveGenType::QUIET>(moves, board, pt_to_pgt(info.piece));
-        }
+        if (san.empty()) return SanError::EMPTY;
 
-        if (info.castling_short || info.castling_long) {
-            for (const auto& move : moves) {
-                if (move.typeOf() == Move::CASTLING) {
-                    if ((info.castling_short && move.to() > move.from()) ||
-                        (info.castling_long && move.to() < move.from())) {
-                        return move;
-                    }
-                }
-            }
+        SanMoveInformation info;
 
-#ifndef CHESS_NO_EXCEPTIONS
-            throw SanParseError("Failed to parse san. At step 2: " + std::string(san) + " " + board.getFen());
-#endif
-        }
+        if (!parseSanInfo(san, info)) return SanError::INVALID_SYNTAX;
 
-        Move matchingMove = Move::NO_MOVE;
-        bool foundMatch   = false;
+        return resolveSan(board, info, move, moves);
+    }
 
-        for (const auto& move : moves) {
-            // Skip all moves that are not to the correct square
-            // or are castling moves
-            if (move.to() != info.to || move.typeOf() == Move::CASTLING) {
-                continue;
-            }
+    class SanCache;
 
-            // Handle promotion moves
-            if (info.promotion != PieceType::NONE) {
-                if (move.typeOf() != Move::PROMOTION || info.promotion != move.promotionType() ||
-                    move.from().file() != info.from_file) {
-                    continue;
-                }
-            }
-            // Handle en passant moves
-            else if (move.typeOf() == Move::ENPASSANT) {
-                if (move.from().file() != info.from_file) {
-                    continue;
-                }
-            }
-            // Handle moves with specific from square
-            else if (info.from != Square::NO_SQ) {
-                if (move.from() != info.from) {
-                    continue;
-                }
-            }
-            // Handle moves with partial from information (rank or file)
-            else if (info.from_rank != Rank::NO_RANK || info.from_file != File::NO_FILE) {
-                if ((info.from_file != File::NO_FILE && move.from().file() != info.from_file) ||
-                    (info.from_rank != Rank::NO_RANK && move.from().rank() != info.from_rank)) {
-                    continue;
-                }
-            }
+    /**
+     * @brief Same as tryParseSan, but the tokenized san is looked up in (and added to) the cache,
+     * so that strings seen before, like "Nf3" or "O-O", are only tokenized once.
+     * @param board
+     * @param san
+     * @param move set to the parsed move, or NO_MOVE on failure
+     * @param moves
+     * @param cache
+     * @return SanError::NONE on success, otherwise why the san was rejected
+     */
+    static SanError tryParseSan(const Board& board, std::string_view san, Move& move, Movelist& moves,
+                                SanCache& cache) noexcept {
+        move = Move::NO_MOVE;
+        moves.clear();
 
-            // If we get here, the move matches our criteria
-            if (foundMatch) {
-#ifndef CHESS_NO_EXCEPTIONS
-                throw AmbiguousMoveError("Ambiguous san: " + std::string(san) + " in " + board.getFen());
-#endif
-            }
+        if (san.empty()) return SanError::EMPTY;
 
-            matchingMove = move;
-            foundMatch   = true;
-        }
+        const auto* info = cache.lookup(san);
 
-        if (!foundMatch) {
-#ifndef CHESS_NO_EXCEPTIONS
-            throw SanParseError("Failed to parse san, illegal move: " + std::string(san) + " " + board.getFen());
-#endif
-        }
+        if (info == nullptr) return SanError::INVALID_SYNTAX;
 
-        return matchingMove;
+        return resolveSan(board, *info, move, moves);
     }
 
     /**
@@ -5489,12 +9610,99 @@ class uci {
         bool capture = false;
     };
 
-    [[nodiscard]] static SanMoveInformation parseSanInfo(std::string_view san) noexcept(false) {
-#ifndef CHESS_NO_EXCEPTIONS
-        if (san.length() < 2) {
-            throw SanParseError("Failed to parse san. At step 0: " + std::string(san));
+   public:
+    /**
+     * @brief Cache from san strings to their tokenized form, see tryParseSan. Games repeat the same
+     * few thousand strings over and over, so after a few games nearly every lookup is a hit.
+     * Strings longer than 8 characters are tokenized on every call.
+     */
+    class SanCache {
+       public:
+        SanCache() : entries_(SIZE) {}
+
+       private:
+        friend class uci;
+
+        static constexpr int BITS               = 12;
+        static constexpr std::size_t SIZE       = std::size_t(1) << BITS;
+        static constexpr std::size_t MAX_PROBES = 8;
+
+        struct Entry {
+            std::uint64_t key = 0;  // the san bytes, 0 for an empty slot
+            bool valid        = false;
+            SanMoveInformation info;
+        };
+
+        // nullptr if the san is not valid
+        const SanMoveInformation* lookup(std::string_view san) noexcept {
+            if (san.size() > sizeof(std::uint64_t)) return parseUncached(san);
+
+            std::uint64_t key = 0;
+            for (std::size_t i = 0; i < san.size(); ++i) key |= std::uint64_t(std::uint8_t(san[i])) << (8 * i);
+
+            auto index = static_cast<std::size_t>((key * 0x9E3779B97F4A7C15ull) >> (64 - BITS));
+
+            for (std::size_t i = 0; i < MAX_PROBES; ++i, index = (index + 1) & (SIZE - 1)) {
+                auto& entry = entries_[index];
+
+                if (entry.key == key) return entry.valid ? &entry.info : nullptr;
+
+                if (entry.key == 0) {
+                    entry.key   = key;
+                    entry.valid = parseSanInfo(san, entry.info);
+                    return entry.valid ? &entry.info : nullptr;
+                }
+            }
+
+            // too crowded around this slot, don't cache
+            return parseUncached(san);
         }
-#endif
+
+        const SanMoveInformation* parseUncached(std::string_view san) noexcept {
+            uncached_ = SanMoveInformation();
+            return parseSanInfo(san, uncached_) ? &uncached_ : nullptr;
+        }
+
+        std::vector<Entry> entries_;
+        SanMoveInformation uncached_;
+    };
+
+   private:
+    // finds the legal move matching the tokenized san
+    static SanError resolveSan(const Board& board, const SanMoveInformation& info, Move& move,
+                               Movelist& moves) noexcept {
+        if (info.castling_short || info.castling_long) {
+            const auto stm    = board.sideToMove();
+            const auto side   = info.castling_short ? Board::CastlingRights::Side::KING_SIDE
+                                                    : Board::CastlingRights::Side::QUEEN_SIDE;
+            const auto rights = board.castlingRights();
+
+            if (info.capture || !rights.has(stm, side)) return SanError::ILLEGAL_CASTLING;
+
+            const auto king     = board.kingSq(stm);
+            const auto rook     = Square(rights.getRookFile(stm, side), king.rank());
+            const auto castling = Move::make<Move::CASTLING>(king, rook);
+
+            if (!movegen::isLegal(board, castling)) return SanError::ILLEGAL_CASTLING;
+
+            moves.add(castling);
+            move = castling;
+            return SanError::NONE;
+        }
+
+        sanCandidates(board, info, moves);
+
+        if (moves.size() > 1) return SanError::AMBIGUOUS;
+        if (moves.empty()) return SanError::ILLEGAL_MOVE;
+
+        move = moves[0];
+        return SanError::NONE;
+    }
+
+    // returns false if the string is not valid san
+    static bool parseSanInfo(std::string_view san, SanMoveInformation& info) noexcept {
+        if (san.length() < 2) return false;
+
         constexpr auto parse_castle = [](std::string_view& san, SanMoveInformation& info, char castling_char) {
             info.piece = PieceType::KING;
 
@@ -5511,23 +9719,19 @@ class uci {
         static constexpr auto isFile = [](char c) { return c >= 'a' && c <= 'h'; };
         static constexpr auto sw     = [](const char& c) { return std::string_view(&c, 1); };
 
-        SanMoveInformation info;
-        bool throw_error = false;
-
         // set to 1 to skip piece type offset
         std::size_t index = 1;
 
         if (san[0] == 'O' || san[0] == '0') {
+            if (san.length() < 3) return false;
             parse_castle(san, info, san[0]);
-            return info;
+            return info.castling_short || info.castling_long;
         } else if (isFile(san[0])) {
             index--;
             info.piece = PieceType::PAWN;
         } else {
             info.piece = PieceType(san);
-            if (info.piece == PieceType::NONE) {
-                throw_error = true;
-            }
+            if (info.piece == PieceType::NONE) return false;
         }
 
         File file_to = File::NO_FILE;
@@ -5566,10 +9770,12 @@ class uci {
         // promotion
         if (index < san.size() && san[index] == '=') {
             index++;
+            if (index == san.size()) return false;
+
             info.promotion = PieceType(sw(san[index]));
             if (info.promotion == PieceType::KING || info.promotion == PieceType::PAWN ||
                 info.promotion == PieceType::NONE) {
-                throw_error = true;
+                return false;
             }
             index++;
         }
@@ -5589,159 +9795,469 @@ class uci {
             info.from_file = file_to;
         }
 
-        if (file_to != File::NO_FILE && rank_to != Rank::NO_RANK) {
-            info.to = Square(file_to, rank_to);
-        } else {
-            throw_error = true;
-        }
+        if (file_to == File::NO_FILE || rank_to == Rank::NO_RANK) return false;
 
-#ifndef CHESS_NO_EXCEPTIONS
-        if (throw_error) {
-            throw SanParseError("Failed to parse san. At step 1: " + std::string(san));
-        }
-#endif
+        info.to = Square(file_to, rank_to);
 
         if (info.from_file != File::NO_FILE && info.from_rank != Rank::NO_RANK) {
             info.from = Square(info.from_file, info.from_rank);
         }
 
-        return info;
+        return true;
     }
 
-    template <bool LAN = false>
-    static void moveToRep(Board board, const Move& move, std::string& str) {
-        if (handleCastling(move, str)) {
-            board.makeMove(move);
-            if (board.inCheck()) appendCheckSymbol(board, str);
+    // Adds the legal moves matching the san information to moves. Instead of generating all moves,
+    // the origin squares are found by looking backwards from the destination square.
+    static void sanCandidates(const Board& board, const SanMoveInformation& info, Movelist& moves) {
+        const auto to = info.to;
+
+        if (to == Square::NO_SQ) return;
+
+        const auto stm    = board.sideToMove();
+        const auto target = board.at(to);
+        const auto occ    = board.occ();
+
+        // the capture sign has to match the destination square
+        const bool is_ep = info.piece == PieceType::PAWN && info.capture && target == Piece::NONE &&
+                           to == board.enpassantSq();
+
+        if (info.capture ? (target == Piece::NONE && !is_ep) || target.color() == stm : target != Piece::NONE) {
             return;
         }
 
+        Bitboard from = board.pieces(info.piece, stm);
+
+        switch (info.piece.internal()) {
+            case PieceType::PAWN: {
+                if (info.capture) {
+                    // squares from which our pawns attack the destination
+                    from &= attacks::pawn(~stm, to);
+                } else {
+                    // no pawn can push to our own back rank
+                    if (Square::back_rank(to, stm)) return;
+
+                    const auto down = make_direction(Direction::SOUTH, stm);
+                    const auto one  = to + down;
+
+                    if (board.at(one) == Piece::NONE && to.rank() == Rank::rank(Rank::RANK_4, stm)) {
+                        from &= Bitboard::fromSquare(one + down);
+                    } else {
+                        from &= Bitboard::fromSquare(one);
+                    }
+                }
+
+                break;
+            }
+            case PieceType::KNIGHT:
+                from &= attacks::knight(to);
+                break;
+            case PieceType::BISHOP:
+                from &= attacks::bishop(to, occ);
+                break;
+            case PieceType::ROOK:
+                from &= attacks::rook(to, occ);
+                break;
+            case PieceType::QUEEN:
+                from &= attacks::queen(to, occ);
+                break;
+            case PieceType::KING:
+                from &= attacks::king(to);
+                break;
+            default:
+                return;
+        }
+
+        if (info.from_file != File::NO_FILE) from &= Bitboard(info.from_file);
+        if (info.from_rank != Rank::NO_RANK) from &= Bitboard(info.from_rank);
+
+        const bool promoting = info.piece == PieceType::PAWN && to.rank() == Rank::rank(Rank::RANK_8, stm);
+
+        // a promotion piece only makes sense for a pawn reaching the last rank
+        if (info.promotion != PieceType::NONE && !promoting) return;
+
+        while (from) {
+            const auto sq = Square(from.pop());
+
+            if (promoting) {
+                // without a promotion piece every promotion matches, which makes the san ambiguous
+                for (const auto pt : {PieceType::QUEEN, PieceType::ROOK, PieceType::BISHOP, PieceType::KNIGHT}) {
+                    if (info.promotion != PieceType::NONE && info.promotion != pt) continue;
+
+                    const auto move = Move::make<Move::PROMOTION>(sq, to, pt);
+                    if (movegen::isLegal(board, move)) moves.add(move);
+                }
+            } else {
+                const auto move = is_ep ? Move::make<Move::ENPASSANT>(sq, to) : Move::make(sq, to);
+                if (movegen::isLegal(board, move)) moves.add(move);
+            }
+        }
+    }
+
+    template <bool LAN = false>
+    static std::size_t writeRep(const Board& board, const Move& move, char* out) {
+        char* p = writeMoveText<LAN>(board, move, out);
+
+        if (board.givesCheck(move) != CheckType::NO_CHECK) {
+            *p++ = givesMate(board, move) ? '#' : '+';
+        }
+
+        return static_cast<std::size_t>(p - out);
+    }
+
+    // Writes everything but the check symbol
+    template <bool LAN>
+    static char* writeMoveText(const Board& board, const Move& move, char* p) {
+        if (move.typeOf() == Move::CASTLING) {
+            const bool king_side = move.to().file() > move.from().file();
+            const auto length    = king_side ? 3 : 5;
+
+            std::memcpy(p, "O-O-O", length);
+            return p + length;
+        }
+
         const PieceType pt   = board.at(move.from()).type();
         const bool isCapture = board.at(move.to()) != Piece::NONE || move.typeOf() == Move::ENPASSANT;
 
         assert(pt != PieceType::NONE);
 
         if (pt != PieceType::PAWN) {
-            appendPieceSymbol(pt, str);
+            *p++ = pieceSymbol(pt);
         }
 
         if constexpr (LAN) {
-            appendSquare(move.from(), str);
+            p = writeSquare(move.from(), p);
         } else {
             if (pt == PieceType::PAWN) {
-                str += isCapture ? static_cast<std::string>(move.from().file()) : "";
+                if (isCapture) *p++ = fileSymbol(move.from().file());
             } else {
-                resolveAmbiguity(board, move, pt, str);
+                p = writeDisambiguation(board, move, pt, p);
             }
         }
 
         if (isCapture) {
-            str += 'x';
+            *p++ = 'x';
         }
 
-        appendSquare(move.to(), str);
+        p = writeSquare(move.to(), p);
 
-        if (move.typeOf() == Move::PROMOTION) appendPromotion(move, str);
-
-        board.makeMove(move);
+        if (move.typeOf() == Move::PROMOTION) {
+            *p++ = '=';
+            *p++ = pieceSymbol(move.promotionType());
+        }
 
-        if (board.inCheck()) appendCheckSymbol(board, str);
+        return p;
     }
 
-    static bool handleCastling(const Move& move, std::string& str) {
-        if (move.typeOf() != Move::CASTLING) return false;
+    // Legality of a normal move or promotion. Instead of building the check and pin masks like
+    // movegen::isLegal, the king is tested for attackers on the occupancy after the move.
+    static bool isLegalNormal(const Board& board, const Move& move, PieceType pt) noexcept {
+        const auto us       = board.sideToMove();
+        const auto from     = move.from();
+        const auto to       = move.to();
+        const auto piece    = board.at(from);
+        const auto captured = board.at(to);
+        const auto occ      = board.occ();
+
+        if (piece == Piece::NONE || piece.color() != us) return false;
+        if (captured != Piece::NONE && (captured.color() == us || captured.type() == PieceType::KING)) return false;
+
+        switch (pt) {
+            case PieceType(PieceType::PAWN): {
+                // should reach the last rank iff promoting
+                if (Square::back_rank(to, ~us) != (move.typeOf() == Move::PROMOTION)) return false;
+
+                if (captured != Piece::NONE) {
+                    if (!attacks::pawn(us, from).check(to.index())) return false;
+                    break;
+                }
+
+                const auto up   = us == Color::WHITE ? 8 : -8;
+                const auto step = to.index() - from.index();
+
+                if (step == up) break;
+                if (step == 2 * up && from.rank() == Rank::rank(Rank::RANK_2, us) &&
+                    board.at(Square(from.index() + up)) == Piece::NONE)
+                    break;
+
+                return false;
+            }
+            case PieceType(PieceType::KNIGHT):
+                if (!attacks::knight(from).check(to.index())) return false;
+                break;
+            case PieceType(PieceType::BISHOP):
+                if (!attacks::bishop(from, occ).check(to.index())) return false;
+                break;
+            case PieceType(PieceType::ROOK):
+                if (!attacks::rook(from, occ).check(to.index())) return false;
+                break;
+            case PieceType(PieceType::QUEEN):
+                if (!attacks::queen(from, occ).check(to.index())) return false;
+                break;
+            case PieceType(PieceType::KING):
+                if (!attacks::king(from).check(to.index())) return false;
+                break;
+            default:
+                return false;
+        }
+
+        // our king should not be attacked once the move is made, a captured piece no longer attacks
+        const auto to_bb     = Bitboard::fromSquare(to);
+        const auto occ_after = (occ ^ Bitboard::fromSquare(from)) | to_bb;
+        const auto them      = board.them(us) & ~to_bb;
+        const auto king_sq   = pt == PieceType::KING ? to : board.kingSq(us);
+        const auto diagonal  = board.pieces(PieceType::BISHOP, PieceType::QUEEN) & them;
+        const auto straight  = board.pieces(PieceType::ROOK, PieceType::QUEEN) & them;
+
+        if (attacks::pawn(us, king_sq) & board.pieces(PieceType::PAWN) & them) return false;
+        if (attacks::knight(king_sq) & board.pieces(PieceType::KNIGHT) & them) return false;
+        if (attacks::king(king_sq) & board.pieces(PieceType::KING) & them) return false;
+        if (attacks::bishop(king_sq, occ_after) & diagonal) return false;
+        if (attacks::rook(king_sq, occ_after) & straight) return false;
 
-        str = (move.to().file() > move.from().file()) ? "O-O" : "O-O-O";
         return true;
     }
 
-    static void appendPieceSymbol(PieceType pieceType, std::string& str) {
-        str += std::toupper(static_cast<std::string>(pieceType)[0]);
-    }
+    // two characters per square, a1 first
+    static constexpr char SQUARE_NAMES[] =
+        "a1b1c1d1e1f1g1h1a2b2c2d2e2f2g2h2a3b3c3d3e3f3g3h3a4b4c4d4e4f4g4h4"
+        "a5b5c5d5e5f5g5h5a6b6c6d6e6f6g6h6a7b7c7d7e7f7g7h7a8b8c8d8e8f8g8h8";
 
-    static void appendSquare(Square square, std::string& str) {
-        str += static_cast<std::string>(square.file());
-        str += static_cast<std::string>(square.rank());
+    // n, b, r, q -> 0..3 as stored in the move encoding, anything else -> 4
+    static std::uint16_t promotionIndex(char c) noexcept {
+        switch (c) {
+            case 'n':
+                return 0;
+            case 'b':
+                return 1;
+            case 'r':
+                return 2;
+            case 'q':
+                return 3;
+            default:
+                return 4;
+        }
     }
 
-    static void appendPromotion(const Move& move, std::string& str) {
-        str += '=';
-        str += std::toupper(static_cast<std::string>(move.promotionType())[0]);
+    static char pieceSymbol(PieceType pt) noexcept { return "PNBRQK"[static_cast<int>(pt)]; }
+
+    static char fileSymbol(File file) noexcept { return static_cast<char>('a' + static_cast<int>(file)); }
+
+    static char* writeSquare(Square square, char* p) noexcept {
+        *p++ = fileSymbol(square.file());
+        *p++ = static_cast<char>('1' + static_cast<int>(square.rank()));
+        return p;
     }
 
-    static void appendCheckSymbol(Board& board, std::string& str) {
-        const auto gameState = board.isGameOver().second;
-        str += (gameState == GameResult::LOSE) ? '#' : '+';
+    // Only called for moves which give check. The move is played on a scratch board
+    // which copies the position but not the move history of the board.
+    static bool givesMate(const Board& board, const Move& move) {
+        thread_local Board scratch;
+
+        scratch.copyPosition(board);
+        scratch.makeMove(move);
+
+        return !movegen::anylegalmoves(scratch);
     }
 
-    static void resolveAmbiguity(const Board& board, const Move& move, PieceType pieceType, std::string& str) {
-        Movelist moves;
-        movegen::legalmoves(moves, board, 1 << pieceType);
+    // Writes the file, rank or square of the origin if another piece of the same type can legally move to the
+    // destination.
+    static char* writeDisambiguation(const Board& board, const Move& move, PieceType pt, char* p) {
+        const auto from = move.from();
+        const auto to   = move.to();
+        const auto occ  = board.occ();
+
+        Bitboard others;
+
+        switch (pt.internal()) {
+            case PieceType::KNIGHT:
+                others = attacks::knight(to);
+                break;
+            case PieceType::BISHOP:
+                others = attacks::bishop(to, occ);
+                break;
+            case PieceType::ROOK:
+                others = attacks::rook(to, occ);
+                break;
+            case PieceType::QUEEN:
+                others = attacks::queen(to, occ);
+                break;
+            default:
+                return p;
+        }
 
-        bool needFile         = false;
-        bool needRank         = false;
-        bool hasAmbiguousMove = false;
+        others &= board.pieces(pt, board.sideToMove());
+        others.clear(from.index());
 
-        for (const auto& m : moves) {
-            if (m != move && m.to() == move.to()) {
-                hasAmbiguousMove = true;
+        /*
+        First, if the moving pieces can be distinguished by their originating files, the originating
+        file letter of the moving piece is inserted immediately after the moving piece letter.
 
-                /*
-                First, if the moving pieces can be distinguished by their originating files, the originating
-                file letter of the moving piece is inserted immediately after the moving piece letter.
+        Second (when the first step fails), if the moving pieces can be distinguished by their
+        originating ranks, the originating rank digit of the moving piece is inserted immediately after
+        the moving piece letter.
 
-                Second (when the first step fails), if the moving pieces can be distinguished by their
-                originating ranks, the originating rank digit of the moving piece is inserted immediately after
-                the moving piece letter.
+        Third (when both the first and the second steps fail), the two character square coordinate of
+        the originating square of the moving piece is inserted immediately after the moving piece
+        letter.
+        */
 
-                Third (when both the first and the second steps fail), the two character square coordinate of
-                the originating square of the moving piece is inserted immediately after the moving piece
-                letter.
-                */
+        bool ambiguous = false;
+        bool same_file = false;
+        bool same_rank = false;
 
-                if (isIdentifiableByType(moves, move, move.from().file())) {
-                    needFile = true;
-                    break;
-                }
+        while (others) {
+            const auto sq = Square(others.pop());
 
-                if (isIdentifiableByType(moves, move, move.from().rank())) {
-                    needRank = true;
-                    break;
-                }
-            }
+            if (!movegen::isLegal(board, Move::make(sq, to))) continue;
+
+            ambiguous = true;
+            same_file |= sq.file() == from.file();
+            same_rank |= sq.rank() == from.rank();
         }
 
-        if (needFile) str += static_cast<std::string>(move.from().file());
-        if (needRank) str += static_cast<std::string>(move.from().rank());
+        if (!ambiguous) return p;
 
-        // we weren't able to disambiguate the move by either file or rank, so we need to use both
-        if (hasAmbiguousMove && !needFile && !needRank) {
-            appendSquare(move.from(), str);
+        if (!same_file) {
+            *p++ = fileSymbol(from.file());
+        } else if (!same_rank) {
+            *p++ = static_cast<char>('1' + static_cast<int>(from.rank()));
+        } else {
+            p = writeSquare(from, p);
         }
+
+        return p;
     }
+};
 
-    template <typename CoordinateType>
-    static bool isIdentifiableByType(const Movelist& moves, const Move move, CoordinateType type) {
-        static_assert(std::is_same_v<CoordinateType, File> || std::is_same_v<CoordinateType, Rank>,
-                      "CoordinateType must be either File or Rank");
+/**
+ * @brief Applies UCI "position" commands to a board. GUIs resend the whole game with every
+ * command, usually with one or two moves more than last time. Only the moves after the common
+ * prefix with the previous command are made (or unmade on a takeback), so the cost of a command
+ * does not grow with the length of the game.
+ */
+class UciPosition {
+   public:
+    explicit UciPosition(bool chess960 = false) : board_(constants::STARTPOS, chess960) {}
 
-        for (const auto& m : moves) {
-            if (m == move || m.to() != move.to()) {
-                continue;
+    /**
+     * @brief Applies a command like "position startpos moves e2e4 e7e5" or
+     * "position fen <fen> moves e2e4". The leading "position" is optional.
+     * @param command
+     * @return false if the position or one of the moves is invalid. The board then holds the
+     * position before the invalid move.
+     */
+    bool set(std::string_view command) {
+        command = trim(command);
+        if (command.substr(0, 8) == "position") command = trim(command.substr(8));
+
+        std::string_view base  = command;
+        std::string_view moves = {};
+
+        if (const auto pos = command.find("moves"); pos != std::string_view::npos) {
+            base  = trim(command.substr(0, pos));
+            moves = command.substr(pos + 5);
+        }
+
+        if (base != base_) {
+            std::string_view fen;
+
+            if (base == "startpos") {
+                fen = constants::STARTPOS;
+            } else if (base.substr(0, 4) == "fen ") {
+                fen = trim(base.substr(4));
+            } else {
+                return false;
+            }
+
+            moves_.clear();
+            text_.clear();
+
+            if (!board_.setFen(fen)) {
+                base_.clear();
+                return false;
             }
 
-            // file
-            if constexpr (std::is_same_v<CoordinateType, File>) {
-                if (type == m.from().file()) return false;
+            base_ = std::string(base);
+        }
+
+        std::size_t common = 0;
+        std::size_t next   = 0;
+
+        // fast path, the new moves extend the old ones
+        if (moves.size() > text_.size() && moves[0] == ' ' && moves.substr(1, text_.size()) == text_ &&
+            (moves.size() == text_.size() + 1 || moves[text_.size() + 1] == ' ')) {
+            common = moves_.size();
+            next   = text_.size() + 1;
+        } else {
+            std::size_t old_pos = 0;
+            std::size_t keep    = 0;
+
+            while (common < moves_.size()) {
+                const auto old_token = nextToken(text_, old_pos);
+                auto new_pos         = next;
+                const auto new_token = nextToken(moves, new_pos);
+
+                if (old_token != new_token) break;
+
+                common++;
+                keep = old_pos;
+                next = new_pos;
             }
-            // rank
-            else {
-                if (type == m.from().rank()) return false;
+
+            while (moves_.size() > common) {
+                board_.unmakeMove(moves_.back());
+                moves_.pop_back();
             }
+
+            text_.resize(keep);
+        }
+
+        for (auto token = nextToken(moves, next); !token.empty(); token = nextToken(moves, next)) {
+            const auto move = uci::uciToMoveChecked(board_, token);
+            if (move == Move::NO_MOVE) return false;
+
+            board_.makeMove<true>(move);
+            moves_.push_back(move);
+
+            if (!text_.empty()) text_ += ' ';
+            text_ += token;
         }
 
         return true;
     }
+
+    /**
+     * @brief The position after the last command.
+     * @return
+     */
+    [[nodiscard]] const Board& board() const noexcept { return board_; }
+
+    /**
+     * @brief The moves played from the base position of the last command.
+     * @return
+     */
+    [[nodiscard]] const std::vector<Move>& moves() const noexcept { return moves_; }
+
+   private:
+    static std::string_view trim(std::string_view str) noexcept {
+        const auto first = str.find_first_not_of(" \t\r\n");
+        if (first == std::string_view::npos) return {};
+        const auto last = str.find_last_not_of(" \t\r\n");
+        return str.substr(first, last - first + 1);
+    }
+
+    // returns the token starting at or after pos and moves pos behind it
+    static std::string_view nextToken(std::string_view str, std::size_t& pos) noexcept {
+        while (pos < str.size() && str[pos] == ' ') pos++;
+        const auto start = pos;
+        while (pos < str.size() && str[pos] != ' ') pos++;
+        return str.substr(start, pos - start);
+    }
+
+    Board board_;
+    std::string base_;
+    std::string text_;  // applied moves, separated by single spaces
+    std::vector<Move> moves_;
 };
 }  // namespace chess
 
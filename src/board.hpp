@@ -1331,6 +1331,25 @@ class Board {
     std::array<std::array<Bitboard, 2>, 2> castling_path = {};
 
    private:
+    friend class uci;
+
+    // Copies the position of other, but not its move history. Used by uci for temporary boards.
+    void copyPosition(const Board& other) {
+        prev_states_.clear();
+
+        pieces_bb_    = other.pieces_bb_;
+        occ_bb_       = other.occ_bb_;
+        board_        = other.board_;
+        key_          = other.key_;
+        cr_           = other.cr_;
+        plies_        = other.plies_;
+        stm_          = other.stm_;
+        ep_sq_        = other.ep_sq_;
+        hfm_          = other.hfm_;
+        chess960_     = other.chess960_;
+        castling_path = other.castling_path;
+    }
+
     void appendFenPiecePlacement(std::string& ss) const {
         for (int rank = 7; rank >= 0; rank--) {
             std::uint32_t free_space = 0;
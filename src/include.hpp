@@ -39,12 +39,19 @@ VERSION: 0.9.3
 #include "color.hpp"
 #include "constants.hpp"
 #include "coords.hpp"
+#include "kpk.hpp"
 #include "move.hpp"
+#include "move_index_codec.hpp"
 #include "movegen.hpp"
 #include "movegen_fwd.hpp"
 #include "movelist.hpp"
 #include "pgn.hpp"
 #include "piece.hpp"
+#include "playout.hpp"
+#include "policy.hpp"
+#include "stats.hpp"
+#include "tablebase.hpp"
+#include "transposition.hpp"
 #include "uci.hpp"
 #include "utils.hpp"
 #include "zobrist.hpp"
@@ -0,0 +1,699 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+
+#include "bitboard.hpp"
+#include "board.hpp"
+#include "color.hpp"
+#include "coords.hpp"
+#include "piece.hpp"
+
+namespace chess {
+
+/**
+ * @brief Bitbase of king and pawn versus king, one bit per position for a win of the side with the
+ * pawn. It covers the pawn on files a-d, the others are mirrored, which takes 24 KB of constant data.
+ */
+class kpk {
+   public:
+    /**
+     * @brief Result for the side to move, like Board::isGameOver. The 50 move rule is ignored.
+     * @param board
+     * @return std::nullopt if the board has other material than two kings and a pawn, a pawn on
+     * the first or last rank or the side not to move in check
+     */
+    [[nodiscard]] static std::optional<GameResult> probe(const Board& board) {
+        const auto pawns = board.pieces(PieceType::PAWN);
+        if (board.occ().count() != 3 || pawns.count() != 1) return std::nullopt;
+
+        // isWin needs a legal position
+        if (pawns & (Bitboard(Rank::RANK_1) | Bitboard(Rank::RANK_8))) return std::nullopt;
+        if (board.isAttacked(board.kingSq(~board.sideToMove()), board.sideToMove())) return std::nullopt;
+
+        const auto strong = board.at(Square(pawns.lsb())).color();
+
+        // seen from the side with the pawn as white
+        const auto relative = [strong](Square sq) { return strong == Color::WHITE ? sq : sq.flip(); };
+
+        const auto stm = board.sideToMove() == strong ? Color::WHITE : Color::BLACK;
+        const auto win = isWin(relative(board.kingSq(strong)), relative(Square(pawns.lsb())),
+                               relative(board.kingSq(~strong)), stm);
+
+        if (!win) return GameResult::DRAW;
+        return board.sideToMove() == strong ? GameResult::WIN : GameResult::LOSE;
+    }
+
+    /**
+     * @brief If white wins with the king on wksq and the pawn on wpsq against the black king on bksq.
+     * The position must be legal.
+     * @param wksq
+     * @param wpsq
+     * @param bksq
+     * @param stm
+     * @return
+     */
+    [[nodiscard]] static bool isWin(Square wksq, Square wpsq, Square bksq, Color stm) {
+        int wk = wksq.index(), wp = wpsq.index(), bk = bksq.index();
+
+        // mirror the pawn onto files a-d
+        if ((wp & 7) > 3) {
+            wk ^= 7;
+            wp ^= 7;
+            bk ^= 7;
+        }
+
+        const auto idx = index(stm, bk, wk, wp);
+        return (BITS[idx / 64] >> (idx % 64)) & 1;
+    }
+
+   private:
+    // 2 sides to move * 24 pawn squares * 64 * 64 king squares
+    static constexpr std::size_t SIZE = 2 * 24 * 64 * 64;
+
+    static std::size_t index(Color stm, int bk, int wk, int wp) noexcept {
+        return wk | (bk << 6) | (static_cast<int>(stm) << 12) | ((wp & 7) << 13) | ((6 - (wp >> 3)) << 15);
+    }
+
+    // generated by retrograde analysis, tests/kpk.cpp checks it against the same generation
+    static constexpr std::array<std::uint64_t, SIZE / 64> BITS = {
+        0xFFFEFFFFFFFFFCFC, 0xFFFEFFFFFFFFF8F8, 0xFFFEFFFFFFFFF1F1, 0xFFFEFFFFFFFFE3E3, 0xFFFEFFFFFFFFC7C7,
+        0xFFFEFFFFFFFF8F8F, 0xFFFEFFFFFFFF1F1F, 0xFFFEFFFFFFFF3F3F, 0xFFFEFFFFFFFCFCFC, 0xFFFEFFFFFFF8F8F8,
+        0xFFFEFFFFFFF1F1F1, 0xFFFEFFFFFFE3E3E3, 0xFFFEFFFFFFC7C7C7, 0xFFFEFFFFFF8F8F8F, 0xFFFEFFFFFF1F1F1F,
+        0xFFFEFFFFFF3F3F3F, 0xFFFEFFFFFCFCFCFF, 0xFFFEFFFFF8F8F8FF, 0xFFFEFFFFF1F1F1FF, 0xFFFEFFFFE3E3E3FF,
+        0xFFFEFFFFC7C7C7FF, 0xFFFEFFFF8F8F8FFF, 0xFFFEFFFF1F1F1FFF, 0xFFFEFFFF3F3F3FFF, 0xFFFEFFFCFCFCFFFF,
+        0xFFFEFFF8F8F8FFFF, 0xFFFEFFF1F1F1FFFF, 0xFFFEFFE3E3E3FFFF, 0xFFFEFFC7C7C7FFFF, 0xFFFEFF8F8F8FFFFF,
+        0xFFFEFF1F1F1FFFFF, 0xFFFEFF3F3F3FFFFF, 0xFFFEFCFCFCFFFFFF, 0xFFFEF8F8F8FFFFFF, 0xFFFEF1F1F1FFFFFF,
+        0xFFFEE3E3E3FFFFFF, 0xFFFEC7C7C7FFFFFF, 0xFFFE8F8F8FFFFFFF, 0xFFFE1F1F1FFFFFFF, 0xFFFE3F3F3FFFFFFF,
+        0xFFFCFCFCFFFFFFFF, 0xFFF8F8F8FFFFFFFF, 0xFFF0F1F1FFFFFFFF, 0xFFE2E3E3FFFFFFFF, 0xFFC6C7C7FFFFFFFF,
+        0xFF8E8F8FFFFFFFFF, 0xFF1E1F1FFFFFFFFF, 0xFF3E3F3FFFFFFFFF, 0x0000000000000000, 0x0000000000000000,
+        0xF0F0F1FFFFFFFFFF, 0xE3E2E3FFFFFFFFFF, 0xC7C6C7FFFFFFFFFF, 0x8F8E8FFFFFFFFFFF, 0x1F1E1FFFFFFFFFFF,
+        0x3F3E3FFFFFFFFFFF, 0x0000000000000000, 0x0000000000000000, 0xF0F0FFFFFFFFFFFF, 0xE3E2FFFFFFFFFFFF,
+        0xC7C6FFFFFFFFFFFF, 0x8F8EFFFFFFFFFFFF, 0x1F1EFFFFFFFFFFFF, 0x3F3EFFFFFFFFFFFF, 0xFFFEFFFFFFFFFCFC,
+        0xFFFEFFFFFFFFF8F8, 0xFFFEFFFFFFFFF1F1, 0xFFFEFFFFFFFFE3E3, 0xFFFEFFFFFFFFC7C7, 0xFFFEFFFFFFFF8F8F,
+        0xFFFEFFFFFFFF1F1F, 0xFFFEFFFFFFFF3F3F, 0xFFFEFFFFFFFCFCFC, 0xFFFEFFFFFFF8F8F8, 0xFFFEFFFFFFF1F1F1,
+        0xFFFEFFFFFFE3E3E3, 0xFFFEFFFFFFC7C7C7, 0xFFFEFFFFFF8F8F8F, 0xFFFEFFFFFF1F1F1F, 0xFFFEFFFFFF3F3F3F,
+        0xFFFEFFFFFCFCFCFF, 0xFFFEFFFFF8F8F8FF, 0xFFFEFFFFF1F1F1FF, 0xFFFEFFFFE3E3E3FF, 0xFFFEFFFFC7C7C7FF,
+        0xFFFEFFFF8F8F8FFF, 0xFFFEFFFF1F1F1FFF, 0xFFFEFFFF3F3F3FFF, 0xFFFEFFFCFCFCFFFF, 0xFFFEFFF8F8F8FFFF,
+        0xFFFEFFF1F1F1FFFF, 0xFFFEFFE3E3E3FFFF, 0xFFFEFFC7C7C7FFFF, 0xFFFEFF8F8F8FFFFF, 0xFFFEFF1F1F1FFFFF,
+        0xFFFEFF3F3F3FFFFF, 0xFFFEFCFCFCFFFFFF, 0xFFFEF8F8F8FFFFFF, 0xFFFEF1F1F1FFFFFF, 0xFFFEE3E3E3FFFFFF,
+        0xFFFEC7C7C7FFFFFF, 0xFFFE8F8F8FFFFFFF, 0xFFFE1F1F1FFFFFFF, 0xFFFE3F3F3FFFFFFF, 0x0300000000000000,
+        0x0200000000000000, 0x0600010000000000, 0xFEE2E3E3FFFFFFFF, 0xFFC6C7C7FFFFFFFF, 0xFF8E8F8FFFFFFFFF,
+        0xFF1E1F1FFFFFFFFF, 0xFF3E3F3FFFFFFFFF, 0x0000000000000000, 0x0000000000000000, 0x0000010000000000,
+        0xE2E2E3FFFFFFFFFF, 0xC7C6C7FFFFFFFFFF, 0x8F8E8FFFFFFFFFFF, 0x1F1E1FFFFFFFFFFF, 0x3F3E3FFFFFFFFFFF,
+        0x0000000000000000, 0x0000000000000000, 0x0000070000000000, 0xE2E2FFFFFFFFFFFF, 0xC7C6FFFFFFFFFFFF,
+        0x8F8EFFFFFFFFFFFF, 0x1F1EFFFFFFFFFFFF, 0x3F3EFFFFFFFFFFFF, 0xFFFDFFFFFFFFFCFC, 0xFFFDFFFFFFFFF8F8,
+        0xFFFDFFFFFFFFF1F1, 0xFFFDFFFFFFFFE3E3, 0xFFFDFFFFFFFFC7C7, 0xFFFDFFFFFFFF8F8F, 0xFFFDFFFFFFFF1F1F,
+        0xFFFDFFFFFFFF3F3F, 0xFFFDFFFFFFFCFCFC, 0xFFFDFFFFFFF8F8F8, 0xFFFDFFFFFFF1F1F1, 0xFFFDFFFFFFE3E3E3,
+        0xFFFDFFFFFFC7C7C7, 0xFFFDFFFFFF8F8F8F, 0xFFFDFFFFFF1F1F1F, 0xFFFDFFFFFF3F3F3F, 0xFFFDFFFFFCFCFCFF,
+        0xFFFDFFFFF8F8F8FF, 0xFFFDFFFFF1F1F1FF, 0xFFFDFFFFE3E3E3FF, 0xFFFDFFFFC7C7C7FF, 0xFFFDFFFF8F8F8FFF,
+        0xFFFDFFFF1F1F1FFF, 0xFFFDFFFF3F3F3FFF, 0xFFFDFFFCFCFCFFFF, 0xFFFDFFF8F8F8FFFF, 0xFFFDFFF1F1F1FFFF,
+        0xFFFDFFE3E3E3FFFF, 0xFFFDFFC7C7C7FFFF, 0xFFFDFF8F8F8FFFFF, 0xFFFDFF1F1F1FFFFF, 0xFFFDFF3F3F3FFFFF,
+        0xFFFDFCFCFCFFFFFF, 0xFFFDF8F8F8FFFFFF, 0xFFFDF1F1F1FFFFFF, 0xFFFDE3E3E3FFFFFF, 0xFFFDC7C7C7FFFFFF,
+        0xFFFD8F8F8FFFFFFF, 0xFFFD1F1F1FFFFFFF, 0xFFFD3F3F3FFFFFFF, 0xFFFCFCFCFFFFFFFF, 0xFFF8F8F8FFFFFFFF,
+        0xFFF1F1F1FFFFFFFF, 0xFFE1E3E3FFFFFFFF, 0xFFC5C7C7FFFFFFFF, 0xFF8D8F8FFFFFFFFF, 0xFF1D1F1FFFFFFFFF,
+        0xFF3D3F3FFFFFFFFF, 0x0C0C0C0000000000, 0x0000000000000000, 0x0101010000000000, 0xE3E1E3FFFFFFFFFF,
+        0xC7C5C7FFFFFFFFFF, 0x8F8D8FFFFFFFFFFF, 0x1F1D1FFFFFFFFFFF, 0x3F3D3FFFFFFFFFFF, 0x0000000000000000,
+        0x00080A0F00000000, 0x0000000000000000, 0xE3E1FFFFFFFFFFFF, 0xC7C5FFFFFFFFFFFF, 0x8F8DFFFFFFFFFFFF,
+        0x1F1DFFFFFFFFFFFF, 0x3F3DFFFFFFFFFFFF, 0xFFFDFFFFFFFFFCFC, 0xFFFDFFFFFFFFF8F8, 0xFFFDFFFFFFFFF1F1,
+        0xFFFDFFFFFFFFE3E3, 0xFFFDFFFFFFFFC7C7, 0xFFFDFFFFFFFF8F8F, 0xFFFDFFFFFFFF1F1F, 0xFFFDFFFFFFFF3F3F,
+        0xFFFDFFFFFFFCFCFC, 0xFFFDFFFFFFF8F8F8, 0xFFFDFFFFFFF1F1F1, 0xFFFDFFFFFFE3E3E3, 0xFFFDFFFFFFC7C7C7,
+        0xFFFDFFFFFF8F8F8F, 0xFFFDFFFFFF1F1F1F, 0xFFFDFFFFFF3F3F3F, 0xFFFDFFFFFCFCFCFF, 0xFFFDFFFFF8F8F8FF,
+        0xFFFDFFFFF1F1F1FF, 0xFFFDFFFFE3E3E3FF, 0xFFFDFFFFC7C7C7FF, 0xFFFDFFFF8F8F8FFF, 0xFFFDFFFF1F1F1FFF,
+        0xFFFDFFFF3F3F3FFF, 0xFFFDFFFCFCFCFFFF, 0xFFFDFFF8F8F8FFFF, 0xFFFDFFF1F1F1FFFF, 0xFFFDFFE3E3E3FFFF,
+        0xFFFDFFC7C7C7FFFF, 0xFFFDFF8F8F8FFFFF, 0xFFFDFF1F1F1FFFFF, 0xFFFDFF3F3F3FFFFF, 0xFFFDFCFCFCFFFFFF,
+        0xFFFDF8F8F8FFFFFF, 0xFFFDF1F1F1FFFFFF, 0xFFFDE3E3E3FFFFFF, 0xFFFDC7C7C7FFFFFF, 0xFFFD8F8F8FFFFFFF,
+        0xFFFD1F1F1FFFFFFF, 0xFFFD3F3F3FFFFFFF, 0x0704040000000000, 0x0700000000000000, 0x0701010000000000,
+        0x0F01030000000000, 0xFFC5C7C7FFFFFFFF, 0xFF8D8F8FFFFFFFFF, 0xFF1D1F1FFFFFFFFF, 0xFF3D3F3FFFFFFFFF,
+        0x0404000000000000, 0x0000000000000000, 0x0101000000000000, 0x0301030000000000, 0xC7C5C7FFFFFFFFFF,
+        0x8F8D8FFFFFFFFFFF, 0x1F1D1FFFFFFFFFFF, 0x3F3D3FFFFFFFFFFF, 0x0404020000000000, 0x0000050000000000,
+        0x0101020000000000, 0x03010F0000000000, 0xC7C5FFFFFFFFFFFF, 0x8F8DFFFFFFFFFFFF, 0x1F1DFFFFFFFFFFFF,
+        0x3F3DFFFFFFFFFFFF, 0xFFFBFFFFFFFFFCFC, 0xFFFBFFFFFFFFF8F8, 0xFFFBFFFFFFFFF1F1, 0xFFFBFFFFFFFFE3E3,
+        0xFFFBFFFFFFFFC7C7, 0xFFFBFFFFFFFF8F8F, 0xFFFBFFFFFFFF1F1F, 0xFFFBFFFFFFFF3F3F, 0xFFFBFFFFFFFCFCFC,
+        0xFFFBFFFFFFF8F8F8, 0xFFFBFFFFFFF1F1F1, 0xFFFBFFFFFFE3E3E3, 0xFFFBFFFFFFC7C7C7, 0xFFFBFFFFFF8F8F8F,
+        0xFFFBFFFFFF1F1F1F, 0xFFFBFFFFFF3F3F3F, 0xFFFBFFFFFCFCFCFF, 0xFFFBFFFFF8F8F8FF, 0xFFFBFFFFF1F1F1FF,
+        0xFFFBFFFFE3E3E3FF, 0xFFFBFFFFC7C7C7FF, 0xFFFBFFFF8F8F8FFF, 0xFFFBFFFF1F1F1FFF, 0xFFFBFFFF3F3F3FFF,
+        0xFFFBFFFCFCFCFFFF, 0xFFFBFFF8F8F8FFFF, 0xFFFBFFF1F1F1FFFF, 0xFFFBFFE3E3E3FFFF, 0xFFFBFFC7C7C7FFFF,
+        0xFFFBFF8F8F8FFFFF, 0xFFFBFF1F1F1FFFFF, 0xFFFBFF3F3F3FFFFF, 0xFFFBFCFCFCFFFFFF, 0xFFFBF8F8F8FFFFFF,
+        0xFFFBF1F1F1FFFFFF, 0xFFFBE3E3E3FFFFFF, 0xFFFBC7C7C7FFFFFF, 0xFFFB8F8F8FFFFFFF, 0xFFFB1F1F1FFFFFFF,
+        0xFFFB3F3F3FFFFFFF, 0xFFF8FCFCFFFFFFFF, 0xFFF8F8F8FFFFFFFF, 0xFFF1F1F1FFFFFFFF, 0xFFE3E3E3FFFFFFFF,
+        0xFFC3C7C7FFFFFFFF, 0xFF8B8F8FFFFFFFFF, 0xFF1B1F1FFFFFFFFF, 0xFF3B3F3FFFFFFFFF, 0xFCF8FCFFFFFFFFFF,
+        0x1818180000000000, 0x0000000000000000, 0x0303030000000000, 0xC7C3C7FFFFFFFFFF, 0x8F8B8FFFFFFFFFFF,
+        0x1F1B1FFFFFFFFFFF, 0x3F3B3FFFFFFFFFFF, 0xFCF8FFFFFFFFFFFF, 0x0000000000000000, 0x0011151F00000000,
+        0x0000000000000000, 0xC7C3FFFFFFFFFFFF, 0x8F8BFFFFFFFFFFFF, 0x1F1BFFFFFFFFFFFF, 0x3F3BFFFFFFFFFFFF,
+        0xFFFBFFFFFFFFFCFC, 0xFFFBFFFFFFFFF8F8, 0xFFFBFFFFFFFFF1F1, 0xFFFBFFFFFFFFE3E3, 0xFFFBFFFFFFFFC7C7,
+        0xFFFBFFFFFFFF8F8F, 0xFFFBFFFFFFFF1F1F, 0xFFFBFFFFFFFF3F3F, 0xFFFBFFFFFFFCFCFC, 0xFFFBFFFFFFF8F8F8,
+        0xFFFBFFFFFFF1F1F1, 0xFFFBFFFFFFE3E3E3, 0xFFFBFFFFFFC7C7C7, 0xFFFBFFFFFF8F8F8F, 0xFFFBFFFFFF1F1F1F,
+        0xFFFBFFFFFF3F3F3F, 0xFFFBFFFFFCFCFCFF, 0xFFFBFFFFF8F8F8FF, 0xFFFBFFFFF1F1F1FF, 0xFFFBFFFFE3E3E3FF,
+        0xFFFBFFFFC7C7C7FF, 0xFFFBFFFF8F8F8FFF, 0xFFFBFFFF1F1F1FFF, 0xFFFBFFFF3F3F3FFF, 0xFFFBFFFCFCFCFFFF,
+        0xFFFBFFF8F8F8FFFF, 0xFFFBFFF1F1F1FFFF, 0xFFFBFFE3E3E3FFFF, 0xFFFBFFC7C7C7FFFF, 0xFFFBFF8F8F8FFFFF,
+        0xFFFBFF1F1F1FFFFF, 0xFFFBFF3F3F3FFFFF, 0xFFFBFCFCFCFFFFFF, 0xFFFBF8F8F8FFFFFF, 0xFFFBF1F1F1FFFFFF,
+        0xFFFBE3E3E3FFFFFF, 0xFFFBC7C7C7FFFFFF, 0xFFFB8F8F8FFFFFFF, 0xFFFB1F1F1FFFFFFF, 0xFFFB3F3F3FFFFFFF,
+        0x1F181C0000000000, 0x0E08080000000000, 0x0E00000000000000, 0x0E02020000000000, 0x1F03070000000000,
+        0xFF8B8F8FFFFFFFFF, 0xFF1B1F1FFFFFFFFF, 0xFF3B3F3FFFFFFFFF, 0x1C181C0000000000, 0x0808000000000000,
+        0x0000000000000000, 0x0202000000000000, 0x0703070000000000, 0x8F8B8FFFFFFFFFFF, 0x1F1B1FFFFFFFFFFF,
+        0x3F3B3FFFFFFFFFFF, 0x1C181C0000000000, 0x0808040000000000, 0x00000A0000000000, 0x0202040000000000,
+        0x07031F0000000000, 0x8F8BFFFFFFFFFFFF, 0x1F1BFFFFFFFFFFFF, 0x3F3BFFFFFFFFFFFF, 0xFFF7FFFFFFFFFCFC,
+        0xFFF7FFFFFFFFF8F8, 0xFFF7FFFFFFFFF1F1, 0xFFF7FFFFFFFFE3E3, 0xFFF7FFFFFFFFC7C7, 0xFFF7FFFFFFFF8F8F,
+        0xFFF7FFFFFFFF1F1F, 0xFFF7FFFFFFFF3F3F, 0xFFF7FFFFFFFCFCFC, 0xFFF7FFFFFFF8F8F8, 0xFFF7FFFFFFF1F1F1,
+        0xFFF7FFFFFFE3E3E3, 0xFFF7FFFFFFC7C7C7, 0xFFF7FFFFFF8F8F8F, 0xFFF7FFFFFF1F1F1F, 0xFFF7FFFFFF3F3F3F,
+        0xFFF7FFFFFCFCFCFF, 0xFFF7FFFFF8F8F8FF, 0xFFF7FFFFF1F1F1FF, 0xFFF7FFFFE3E3E3FF, 0xFFF7FFFFC7C7C7FF,
+        0xFFF7FFFF8F8F8FFF, 0xFFF7FFFF1F1F1FFF, 0xFFF7FFFF3F3F3FFF, 0xFFF7FFFCFCFCFFFF, 0xFFF7FFF8F8F8FFFF,
+        0xFFF7FFF1F1F1FFFF, 0xFFF7FFE3E3E3FFFF, 0xFFF7FFC7C7C7FFFF, 0xFFF7FF8F8F8FFFFF, 0xFFF7FF1F1F1FFFFF,
+        0xFFF7FF3F3F3FFFFF, 0xFFF7FCFCFCFFFFFF, 0xFFF7F8F8F8FFFFFF, 0xFFF7F1F1F1FFFFFF, 0xFFF7E3E3E3FFFFFF,
+        0xFFF7C7C7C7FFFFFF, 0xFFF78F8F8FFFFFFF, 0xFFF71F1F1FFFFFFF, 0xFFF73F3F3FFFFFFF, 0xFFF4FCFCFFFFFFFF,
+        0xFFF0F8F8FFFFFFFF, 0xFFF1F1F1FFFFFFFF, 0xFFE3E3E3FFFFFFFF, 0xFFC7C7C7FFFFFFFF, 0xFF878F8FFFFFFFFF,
+        0xFF171F1FFFFFFFFF, 0xFF373F3FFFFFFFFF, 0xFCF4FCFFFFFFFFFF, 0xF8F0F8FFFFFFFFFF, 0x3030300000000000,
+        0x0000000000000000, 0x0606060000000000, 0x8F878FFFFFFFFFFF, 0x1F171FFFFFFFFFFF, 0x3F373FFFFFFFFFFF,
+        0xFCF4FFFFFFFFFFFF, 0xF8F0FFFFFFFFFFFF, 0x0000000000000000, 0x00222A3E00000000, 0x0000000000000000,
+        0x8F87FFFFFFFFFFFF, 0x1F17FFFFFFFFFFFF, 0x3F37FFFFFFFFFFFF, 0xFFF7FFFFFFFFFCFC, 0xFFF7FFFFFFFFF8F8,
+        0xFFF7FFFFFFFFF1F1, 0xFFF7FFFFFFFFE3E3, 0xFFF7FFFFFFFFC7C7, 0xFFF7FFFFFFFF8F8F, 0xFFF7FFFFFFFF1F1F,
+        0xFFF7FFFFFFFF3F3F, 0xFFF7FFFFFFFCFCFC, 0xFFF7FFFFFFF8F8F8, 0xFFF7FFFFFFF1F1F1, 0xFFF7FFFFFFE3E3E3,
+        0xFFF7FFFFFFC7C7C7, 0xFFF7FFFFFF8F8F8F, 0xFFF7FFFFFF1F1F1F, 0xFFF7FFFFFF3F3F3F, 0xFFF7FFFFFCFCFCFF,
+        0xFFF7FFFFF8F8F8FF, 0xFFF7FFFFF1F1F1FF, 0xFFF7FFFFE3E3E3FF, 0xFFF7FFFFC7C7C7FF, 0xFFF7FFFF8F8F8FFF,
+        0xFFF7FFFF1F1F1FFF, 0xFFF7FFFF3F3F3FFF, 0xFFF7FFFCFCFCFFFF, 0xFFF7FFF8F8F8FFFF, 0xFFF7FFF1F1F1FFFF,
+        0xFFF7FFE3E3E3FFFF, 0xFFF7FFC7C7C7FFFF, 0xFFF7FF8F8F8FFFFF, 0xFFF7FF1F1F1FFFFF, 0xFFF7FF3F3F3FFFFF,
+        0xFFF7FCFCFCFFFFFF, 0xFFF7F8F8F8FFFFFF, 0xFFF7F1F1F1FFFFFF, 0xFFF7E3E3E3FFFFFF, 0xFFF7C7C7C7FFFFFF,
+        0xFFF78F8F8FFFFFFF, 0xFFF71F1F1FFFFFFF, 0xFFF73F3F3FFFFFFF, 0xFFF4FCFCFFFFFFFF, 0x3E30380000000000,
+        0x1C10100000000000, 0x1C00000000000000, 0x1C04040000000000, 0x3E060E0000000000, 0xFF171F1FFFFFFFFF,
+        0xFF373F3FFFFFFFFF, 0xFCF4FCFFFFFFFFFF, 0x3830380000000000, 0x1010000000000000, 0x0000000000000000,
+        0x0404000000000000, 0x0E060E0000000000, 0x1F171FFFFFFFFFFF, 0x3F373FFFFFFFFFFF, 0xFCF4FFFFFFFFFFFF,
+        0x38303E0000000000, 0x1010080000000000, 0x0000140000000000, 0x0404080000000000, 0x0E063E0000000000,
+        0x1F17FFFFFFFFFFFF, 0x3F37FFFFFFFFFFFF, 0xFFFFFEFFFFFFFCFC, 0xFFFFFEFFFFFFF8F8, 0xFFFFFEFFFFFFF1F1,
+        0xFFFFFEFFFFFFE3E3, 0xFFFFFEFFFFFFC7C7, 0xFFFFFEFFFFFF8F8F, 0xFFFFFEFFFFFF1F1F, 0xFFFFFEFFFFFF3F3F,
+        0xFFFFFEFFFFFCFCFC, 0xFFFFFEFFFFF8F8F8, 0xFFFFFEFFFFF1F1F1, 0xFFFFFEFFFFE3E3E3, 0xFFFFFEFFFFC7C7C7,
+        0xFFFFFEFFFF8F8F8F, 0xFFFFFEFFFF1F1F1F, 0xFFFFFEFFFF3F3F3F, 0xFFFFFEFFFCFCFCFF, 0xFFFFFEFFF8F8F8FF,
+        0xFFFFFEFFF1F1F1FF, 0xFFFFFEFFE3E3E3FF, 0xFFFFFEFFC7C7C7FF, 0xFFFFFEFF8F8F8FFF, 0xFFFFFEFF1F1F1FFF,
+        0xFFFFFEFF3F3F3FFF, 0xFFFFFEFCFCFCFFFF, 0xFFFFFEF8F8F8FFFF, 0xFFFFFEF1F1F1FFFF, 0xFFFFFEE3E3E3FFFF,
+        0xFFFFFEC7C7C7FFFF, 0xFFFFFE8F8F8FFFFF, 0xFFFFFE1F1F1FFFFF, 0xFFFFFE3F3F3FFFFF, 0xFFFFFCFCFCFFFFFF,
+        0xFFFFF8F8F8FFFFFF, 0xFFFFF0F1F1FFFFFF, 0xFFFFE2E3E3FFFFFF, 0xFFFFC6C7C7FFFFFF, 0xFFFF8E8F8FFFFFFF,
+        0xFFFF1E1F1FFFFFFF, 0xFFFF3E3F3FFFFFFF, 0x0000000000000000, 0x0200000000000000, 0x0701000000000000,
+        0xFFE3E2E3FFFFFFFF, 0xFFC7C6C7FFFFFFFF, 0xFF8F8E8FFFFFFFFF, 0xFF1F1E1FFFFFFFFF, 0xFF3F3E3FFFFFFFFF,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0xE3E3E2FFFFFFFFFF, 0xC7C7C6FFFFFFFFFF,
+        0x8F8F8EFFFFFFFFFF, 0x1F1F1EFFFFFFFFFF, 0x3F3F3EFFFFFFFFFF, 0x0000000000000000, 0x0000000000000000,
+        0x0000060000000000, 0xE3E3FEFFFFFFFFFF, 0xC7C7FEFFFFFFFFFF, 0x8F8FFEFFFFFFFFFF, 0x1F1FFEFFFFFFFFFF,
+        0x3F3FFEFFFFFFFFFF, 0xFFFFFEFFFFFFFCFC, 0xFFFFFEFFFFFFF8F8, 0xFFFFFEFFFFFFF1F1, 0xFFFFFEFFFFFFE3E3,
+        0xFFFFFEFFFFFFC7C7, 0xFFFFFEFFFFFF8F8F, 0xFFFFFEFFFFFF1F1F, 0xFFFFFEFFFFFF3F3F, 0xFFFFFEFFFFFCFCFC,
+        0xFFFFFEFFFFF8F8F8, 0xFFFFFEFFFFF1F1F1, 0xFFFFFEFFFFE3E3E3, 0xFFFFFEFFFFC7C7C7, 0xFFFFFEFFFF8F8F8F,
+        0xFFFFFEFFFF1F1F1F, 0xFFFFFEFFFF3F3F3F, 0xFFFFFEFFFCFCFCFF, 0xFFFFFEFFF8F8F8FF, 0xFFFFFEFFF1F1F1FF,
+        0xFFFFFEFFE3E3E3FF, 0xFFFFFEFFC7C7C7FF, 0xFFFFFEFF8F8F8FFF, 0xFFFFFEFF1F1F1FFF, 0xFFFFFEFF3F3F3FFF,
+        0xFFFFFEFCFCFCFFFF, 0xFFFFFEF8F8F8FFFF, 0xFFFFFEF1F1F1FFFF, 0xFFFFFEE3E3E3FFFF, 0xFFFFFEC7C7C7FFFF,
+        0xFFFFFE8F8F8FFFFF, 0xFFFFFE1F1F1FFFFF, 0xFFFFFE3F3F3FFFFF, 0x0003000000000000, 0x0003000000000000,
+        0x0207000000000000, 0x070F020200000000, 0xFFFFC6C7C7FFFFFF, 0xFFFF8E8F8FFFFFFF, 0xFFFF1E1F1FFFFFFF,
+        0xFFFF3E3F3FFFFFFF, 0x0000000000000000, 0x0000000000000000, 0x0200000000000000, 0x0602020000000000,
+        0xFFC7C6C7FFFFFFFF, 0xFF8F8E8FFFFFFFFF, 0xFF1F1E1FFFFFFFFF, 0xFF3F3E3FFFFFFFFF, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0202020000000000, 0xC7C7C6FFFFFFFFFF, 0x8F8F8EFFFFFFFFFF,
+        0x1F1F1EFFFFFFFFFF, 0x3F3F3EFFFFFFFFFF, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0202060000000000, 0xC7C7FEFFFFFFFFFF, 0x8F8FFEFFFFFFFFFF, 0x1F1FFEFFFFFFFFFF, 0x3F3FFEFFFFFFFFFF,
+        0xFFFFFDFFFFFFFCFC, 0xFFFFFDFFFFFFF8F8, 0xFFFFFDFFFFFFF1F1, 0xFFFFFDFFFFFFE3E3, 0xFFFFFDFFFFFFC7C7,
+        0xFFFFFDFFFFFF8F8F, 0xFFFFFDFFFFFF1F1F, 0xFFFFFDFFFFFF3F3F, 0xFFFFFDFFFFFCFCFC, 0xFFFFFDFFFFF8F8F8,
+        0xFFFFFDFFFFF1F1F1, 0xFFFFFDFFFFE3E3E3, 0xFFFFFDFFFFC7C7C7, 0xFFFFFDFFFF8F8F8F, 0xFFFFFDFFFF1F1F1F,
+        0xFFFFFDFFFF3F3F3F, 0xFFFFFDFFFCFCFCFF, 0xFFFFFDFFF8F8F8FF, 0xFFFFFDFFF1F1F1FF, 0xFFFFFDFFE3E3E3FF,
+        0xFFFFFDFFC7C7C7FF, 0xFFFFFDFF8F8F8FFF, 0xFFFFFDFF1F1F1FFF, 0xFFFFFDFF3F3F3FFF, 0xFFFFFDFCFCFCFFFF,
+        0xFFFFFDF8F8F8FFFF, 0xFFFFFDF1F1F1FFFF, 0xFFFFFDE3E3E3FFFF, 0xFFFFFDC7C7C7FFFF, 0xFFFFFD8F8F8FFFFF,
+        0xFFFFFD1F1F1FFFFF, 0xFFFFFD3F3F3FFFFF, 0xFFFFFCFCFCFFFFFF, 0xFFFFF8F8F8FFFFFF, 0xFFFFF1F1F1FFFFFF,
+        0xFFFFE1E3E3FFFFFF, 0xFFFFC5C7C7FFFFFF, 0xFFFF8D8F8FFFFFFF, 0xFFFF1D1F1FFFFFFF, 0xFFFF3D3F3FFFFFFF,
+        0x0F0C0C0C00000000, 0x0000000000000000, 0x0701010100000000, 0x0F03010307000000, 0xFFC7C5C7FFFFFFFF,
+        0xFF8F8D8FFFFFFFFF, 0xFF1F1D1FFFFFFFFF, 0xFF3F3D3FFFFFFFFF, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0303011F1F000000, 0xC7C7C5FFFFFFFFFF, 0x8F8F8DFFFFFFFFFF, 0x1F1F1DFFFFFFFFFF,
+        0x3F3F3DFFFFFFFFFF, 0x040C080F00000000, 0x0000050000000000, 0x0101090F00000000, 0x03031D1F1F000000,
+        0xC7C7FDFFFFFFFFFF, 0x8F8FFDFFFFFFFFFF, 0x1F1FFDFFFFFFFFFF, 0x3F3FFDFFFFFFFFFF, 0xFFFFFDFFFFFFFCFC,
+        0xFFFFFDFFFFFFF8F8, 0xFFFFFDFFFFFFF1F1, 0xFFFFFDFFFFFFE3E3, 0xFFFFFDFFFFFFC7C7, 0xFFFFFDFFFFFF8F8F,
+        0xFFFFFDFFFFFF1F1F, 0xFFFFFDFFFFFF3F3F, 0xFFFFFDFFFFFCFCFC, 0xFFFFFDFFFFF8F8F8, 0xFFFFFDFFFFF1F1F1,
+        0xFFFFFDFFFFE3E3E3, 0xFFFFFDFFFFC7C7C7, 0xFFFFFDFFFF8F8F8F, 0xFFFFFDFFFF1F1F1F, 0xFFFFFDFFFF3F3F3F,
+        0xFFFFFDFFFCFCFCFF, 0xFFFFFDFFF8F8F8FF, 0xFFFFFDFFF1F1F1FF, 0xFFFFFDFFE3E3E3FF, 0xFFFFFDFFC7C7C7FF,
+        0xFFFFFDFF8F8F8FFF, 0xFFFFFDFF1F1F1FFF, 0xFFFFFDFF3F3F3FFF, 0xFFFFFDFCFCFCFFFF, 0xFFFFFDF8F8F8FFFF,
+        0xFFFFFDF1F1F1FFFF, 0xFFFFFDE3E3E3FFFF, 0xFFFFFDC7C7C7FFFF, 0xFFFFFD8F8F8FFFFF, 0xFFFFFD1F1F1FFFFF,
+        0xFFFFFD3F3F3FFFFF, 0x0007040400000000, 0x0007000000000000, 0x0007010100000000, 0x070F010300000000,
+        0x0F1F050707000000, 0xFFFF8D8F8FFFFFFF, 0xFFFF1D1F1FFFFFFF, 0xFFFF3D3F3FFFFFFF, 0x0004040000000000,
+        0x0000000000000000, 0x0001010000000000, 0x0703010300000000, 0x0F07050707000000, 0xFF8F8D8FFFFFFFFF,
+        0xFF1F1D1FFFFFFFFF, 0xFF3F3D3FFFFFFFFF, 0x0004000000000000, 0x0000000000000000, 0x0001010000000000,
+        0x0303010F00000000, 0x0707051F07000000, 0x8F8F8DFFFFFFFFFF, 0x1F1F1DFFFFFFFFFF, 0x3F3F3DFFFFFFFFFF,
+        0x0000050000000000, 0x0000000000000000, 0x0101050000000000, 0x0303090F00000000, 0x07071D1F1F000000,
+        0x8F8FFDFFFFFFFFFF, 0x1F1FFDFFFFFFFFFF, 0x3F3FFDFFFFFFFFFF, 0xFFFFFBFFFFFFFCFC, 0xFFFFFBFFFFFFF8F8,
+        0xFFFFFBFFFFFFF1F1, 0xFFFFFBFFFFFFE3E3, 0xFFFFFBFFFFFFC7C7, 0xFFFFFBFFFFFF8F8F, 0xFFFFFBFFFFFF1F1F,
+        0xFFFFFBFFFFFF3F3F, 0xFFFFFBFFFFFCFCFC, 0xFFFFFBFFFFF8F8F8, 0xFFFFFBFFFFF1F1F1, 0xFFFFFBFFFFE3E3E3,
+        0xFFFFFBFFFFC7C7C7, 0xFFFFFBFFFF8F8F8F, 0xFFFFFBFFFF1F1F1F, 0xFFFFFBFFFF3F3F3F, 0xFFFFFBFFFCFCFCFF,
+        0xFFFFFBFFF8F8F8FF, 0xFFFFFBFFF1F1F1FF, 0xFFFFFBFFE3E3E3FF, 0xFFFFFBFFC7C7C7FF, 0xFFFFFBFF8F8F8FFF,
+        0xFFFFFBFF1F1F1FFF, 0xFFFFFBFF3F3F3FFF, 0xFFFFFBFCFCFCFFFF, 0xFFFFFBF8F8F8FFFF, 0xFFFFFBF1F1F1FFFF,
+        0xFFFFFBE3E3E3FFFF, 0xFFFFFBC7C7C7FFFF, 0xFFFFFB8F8F8FFFFF, 0xFFFFFB1F1F1FFFFF, 0xFFFFFB3F3F3FFFFF,
+        0xFFFFF8FCFCFFFFFF, 0xFFFFF8F8F8FFFFFF, 0xFFFFF1F1F1FFFFFF, 0xFFFFE3E3E3FFFFFF, 0xFFFFC3C7C7FFFFFF,
+        0xFFFF8B8F8FFFFFFF, 0xFFFF1B1F1FFFFFFF, 0xFFFF3B3F3FFFFFFF, 0x3F3C383C3E000000, 0x1E18181800000000,
+        0x0000000000000000, 0x0F03030300000000, 0x1F0703070F000000, 0xFF8F8B8FFFFFFFFF, 0xFF1F1B1FFFFFFFFF,
+        0xFF3F3B3FFFFFFFFF, 0x3C3C383F3F000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0707033F3F000000, 0x8F8F8BFFFFFFFFFF, 0x1F1F1BFFFFFFFFFF, 0x3F3F3BFFFFFFFFFF, 0x3C3C3B3F3F000000,
+        0x1818191F00000000, 0x00000A0000000000, 0x0303131F00000000, 0x07073B3F3F000000, 0x8F8FFBFFFFFFFFFF,
+        0x1F1FFBFFFFFFFFFF, 0x3F3FFBFFFFFFFFFF, 0xFFFFFBFFFFFFFCFC, 0xFFFFFBFFFFFFF8F8, 0xFFFFFBFFFFFFF1F1,
+        0xFFFFFBFFFFFFE3E3, 0xFFFFFBFFFFFFC7C7, 0xFFFFFBFFFFFF8F8F, 0xFFFFFBFFFFFF1F1F, 0xFFFFFBFFFFFF3F3F,
+        0xFFFFFBFFFFFCFCFC, 0xFFFFFBFFFFF8F8F8, 0xFFFFFBFFFFF1F1F1, 0xFFFFFBFFFFE3E3E3, 0xFFFFFBFFFFC7C7C7,
+        0xFFFFFBFFFF8F8F8F, 0xFFFFFBFFFF1F1F1F, 0xFFFFFBFFFF3F3F3F, 0xFFFFFBFFFCFCFCFF, 0xFFFFFBFFF8F8F8FF,
+        0xFFFFFBFFF1F1F1FF, 0xFFFFFBFFE3E3E3FF, 0xFFFFFBFFC7C7C7FF, 0xFFFFFBFF8F8F8FFF, 0xFFFFFBFF1F1F1FFF,
+        0xFFFFFBFF3F3F3FFF, 0xFFFFFBFCFCFCFFFF, 0xFFFFFBF8F8F8FFFF, 0xFFFFFBF1F1F1FFFF, 0xFFFFFBE3E3E3FFFF,
+        0xFFFFFBC7C7C7FFFF, 0xFFFFFB8F8F8FFFFF, 0xFFFFFB1F1F1FFFFF, 0xFFFFFB3F3F3FFFFF, 0x1E1F181C00000000,
+        0x000E080800000000, 0x000E000000000000, 0x000E020200000000, 0x0F1F030700000000, 0x1F3F0B0F0F000000,
+        0xFFFF1B1F1FFFFFFF, 0xFFFF3B3F3FFFFFFF, 0x1E1C181C00000000, 0x0008080000000000, 0x0000000000000000,
+        0x0002020000000000, 0x0F07030700000000, 0x1F0F0B0F0F000000, 0xFF1F1B1FFFFFFFFF, 0xFF3F3B3FFFFFFFFF,
+        0x1C1C181F00000000, 0x0008080000000000, 0x0000000000000000, 0x0002020000000000, 0x0707031F00000000,
+        0x0F0F0B3F0F000000, 0x1F1F1BFFFFFFFFFF, 0x3F3F3BFFFFFFFFFF, 0x1C1C191F00000000, 0x08080A0000000000,
+        0x0000000000000000, 0x02020A0000000000, 0x0707131F00000000, 0x0F0F3B3F3F000000, 0x1F1FFBFFFFFFFFFF,
+        0x3F3FFBFFFFFFFFFF, 0xFFFFF7FFFFFFFCFC, 0xFFFFF7FFFFFFF8F8, 0xFFFFF7FFFFFFF1F1, 0xFFFFF7FFFFFFE3E3,
+        0xFFFFF7FFFFFFC7C7, 0xFFFFF7FFFFFF8F8F, 0xFFFFF7FFFFFF1F1F, 0xFFFFF7FFFFFF3F3F, 0xFFFFF7FFFFFCFCFC,
+        0xFFFFF7FFFFF8F8F8, 0xFFFFF7FFFFF1F1F1, 0xFFFFF7FFFFE3E3E3, 0xFFFFF7FFFFC7C7C7, 0xFFFFF7FFFF8F8F8F,
+        0xFFFFF7FFFF1F1F1F, 0xFFFFF7FFFF3F3F3F, 0xFFFFF7FFFCFCFCFF, 0xFFFFF7FFF8F8F8FF, 0xFFFFF7FFF1F1F1FF,
+        0xFFFFF7FFE3E3E3FF, 0xFFFFF7FFC7C7C7FF, 0xFFFFF7FF8F8F8FFF, 0xFFFFF7FF1F1F1FFF, 0xFFFFF7FF3F3F3FFF,
+        0xFFFFF7FCFCFCFFFF, 0xFFFFF7F8F8F8FFFF, 0xFFFFF7F1F1F1FFFF, 0xFFFFF7E3E3E3FFFF, 0xFFFFF7C7C7C7FFFF,
+        0xFFFFF78F8F8FFFFF, 0xFFFFF71F1F1FFFFF, 0xFFFFF73F3F3FFFFF, 0xFFFFF4FCFCFFFFFF, 0xFFFFF0F8F8FFFFFF,
+        0xFFFFF1F1F1FFFFFF, 0xFFFFE3E3E3FFFFFF, 0xFFFFC7C7C7FFFFFF, 0xFFFF878F8FFFFFFF, 0xFFFF171F1FFFFFFF,
+        0xFFFF373F3FFFFFFF, 0xFFFCF4FCFFFFFFFF, 0x7E7870787C000000, 0x3C30303000000000, 0x0000000000000000,
+        0x1E06060600000000, 0x3F0F070F1F000000, 0xFF1F171FFFFFFFFF, 0xFF3F373FFFFFFFFF, 0xFCFCF4FFFFFFFFFF,
+        0x7878707F7F000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0F0F077F7F000000,
+        0x1F1F17FFFFFFFFFF, 0x3F3F37FFFFFFFFFF, 0xFCFCF7FFFFFFFFFF, 0x7878777F7F000000, 0x3030323E00000000,
+        0x0000140000000000, 0x0606263E00000000, 0x0F0F777F7F000000, 0x1F1FF7FFFFFFFFFF, 0x3F3FF7FFFFFFFFFF,
+        0xFFFFF7FFFFFFFCFC, 0xFFFFF7FFFFFFF8F8, 0xFFFFF7FFFFFFF1F1, 0xFFFFF7FFFFFFE3E3, 0xFFFFF7FFFFFFC7C7,
+        0xFFFFF7FFFFFF8F8F, 0xFFFFF7FFFFFF1F1F, 0xFFFFF7FFFFFF3F3F, 0xFFFFF7FFFFFCFCFC, 0xFFFFF7FFFFF8F8F8,
+        0xFFFFF7FFFFF1F1F1, 0xFFFFF7FFFFE3E3E3, 0xFFFFF7FFFFC7C7C7, 0xFFFFF7FFFF8F8F8F, 0xFFFFF7FFFF1F1F1F,
+        0xFFFFF7FFFF3F3F3F, 0xFFFFF7FFFCFCFCFF, 0xFFFFF7FFF8F8F8FF, 0xFFFFF7FFF1F1F1FF, 0xFFFFF7FFE3E3E3FF,
+        0xFFFFF7FFC7C7C7FF, 0xFFFFF7FF8F8F8FFF, 0xFFFFF7FF1F1F1FFF, 0xFFFFF7FF3F3F3FFF, 0xFFFFF7FCFCFCFFFF,
+        0xFFFFF7F8F8F8FFFF, 0xFFFFF7F1F1F1FFFF, 0xFFFFF7E3E3E3FFFF, 0xFFFFF7C7C7C7FFFF, 0xFFFFF78F8F8FFFFF,
+        0xFFFFF71F1F1FFFFF, 0xFFFFF73F3F3FFFFF, 0x7E7F747C7C000000, 0x3C3E303800000000, 0x001C101000000000,
+        0x001C000000000000, 0x001C040400000000, 0x1E3E060E00000000, 0x3F7F171F1F000000, 0xFFFF373F3FFFFFFF,
+        0x7E7C747C7C000000, 0x3C38303800000000, 0x0010100000000000, 0x0000000000000000, 0x0004040000000000,
+        0x1E0E060E00000000, 0x3F1F171F1F000000, 0xFF3F373FFFFFFFFF, 0x7C7C747F7C000000, 0x3838303E00000000,
+        0x0010100000000000, 0x0000000000000000, 0x0004040000000000, 0x0E0E063E00000000, 0x1F1F177F1F000000,
+        0x3F3F37FFFFFFFFFF, 0x7C7C777F7F000000, 0x3838323E00000000, 0x1010140000000000, 0x0000000000000000,
+        0x0404140000000000, 0x0E0E263E00000000, 0x1F1F777F7F000000, 0x3F3FF7FFFFFFFFFF, 0xFFFFFFFEFFFFFCFC,
+        0xFFFFFFFEFFFFF8F8, 0xFFFFFFFEFFFFF1F1, 0xFFFFFFFEFFFFE3E3, 0xFFFFFFFEFFFFC7C7, 0xFFFFFFFEFFFF8F8F,
+        0xFFFFFFFEFFFF1F1F, 0xFFFFFFFEFFFF3F3F, 0xFFFFFFFEFFFCFCFC, 0xFFFFFFFEFFF8F8F8, 0xFFFFFFFEFFF1F1F1,
+        0xFFFFFFFEFFE3E3E3, 0xFFFFFFFEFFC7C7C7, 0xFFFFFFFEFF8F8F8F, 0xFFFFFFFEFF1F1F1F, 0xFFFFFFFEFF3F3F3F,
+        0xFFFFFFFEFCFCFCFF, 0xFFFFFFFEF8F8F8FF, 0xFFFFFFFEF1F1F1FF, 0xFFFFFFFEE3E3E3FF, 0xFFFFFFFEC7C7C7FF,
+        0xFFFFFFFE8F8F8FFF, 0xFFFFFFFE1F1F1FFF, 0xFFFFFFFE3F3F3FFF, 0xFFFFFFFCFCFCFFFF, 0xFFFFFFF8F8F8FFFF,
+        0xFFFFFFF0F1F1FFFF, 0xFFFFFFE2E3E3FFFF, 0xFFFFFFC6C7C7FFFF, 0xFFFFFF8E8F8FFFFF, 0xFFFFFF1E1F1FFFFF,
+        0xFFFFFF3E3F3FFFFF, 0x0000000000000000, 0x0003000000000000, 0x0707010000000000, 0x0F0F030203000000,
+        0xFFFFC7C6C7FFFFFF, 0xFFFF8F8E8FFFFFFF, 0xFFFF1F1E1FFFFFFF, 0xFFFF3F3E3FFFFFFF, 0x0000000000000000,
+        0x0000000000000000, 0x0200000000000000, 0x0703030200000000, 0xFFC7C7C6FFFFFFFF, 0xFF8F8F8EFFFFFFFF,
+        0xFF1F1F1EFFFFFFFF, 0xFF3F3F3EFFFFFFFF, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0303030000000000, 0xC7C7C7FEFFFFFFFF, 0x8F8F8FFEFFFFFFFF, 0x1F1F1FFEFFFFFFFF, 0x3F3F3FFEFFFFFFFF,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0303070000000000, 0xC7C7FFFEFFFFFFFF,
+        0x8F8FFFFEFFFFFFFF, 0x1F1FFFFEFFFFFFFF, 0x3F3FFFFEFFFFFFFF, 0xFFFFFFFEFFFFFCFC, 0xFFFFFFFEFFFFF8F8,
+        0xFFFFFFFEFFFFF1F1, 0xFFFFFFFEFFFFE3E3, 0xFFFFFFFEFFFFC7C7, 0xFFFFFFFEFFFF8F8F, 0xFFFFFFFEFFFF1F1F,
+        0xFFFFFFFEFFFF3F3F, 0xFFFFFFFEFFFCFCFC, 0xFFFFFFFEFFF8F8F8, 0xFFFFFFFEFFF1F1F1, 0xFFFFFFFEFFE3E3E3,
+        0xFFFFFFFEFFC7C7C7, 0xFFFFFFFEFF8F8F8F, 0xFFFFFFFEFF1F1F1F, 0xFFFFFFFEFF3F3F3F, 0xFFFFFFFEFCFCFCFF,
+        0xFFFFFFFEF8F8F8FF, 0xFFFFFFFEF1F1F1FF, 0xFFFFFFFEE3E3E3FF, 0xFFFFFFFEC7C7C7FF, 0xFFFFFFFE8F8F8FFF,
+        0xFFFFFFFE1F1F1FFF, 0xFFFFFFFE3F3F3FFF, 0x0000030000000000, 0x0000030000000000, 0x0003070000000000,
+        0x07070F0202000000, 0x0F0F1F0607000000, 0xFFFFFF8E8F8FFFFF, 0xFFFFFF1E1F1FFFFF, 0xFFFFFF3E3F3FFFFF,
+        0x0000000000000000, 0x0000000000000000, 0x0002000000000000, 0x0206020200000000, 0x070F070600000000,
+        0xFFFF8F8E8FFFFFFF, 0xFFFF1F1E1FFFFFFF, 0xFFFF3F3E3FFFFFFF, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0202020000000000, 0x0707070000000000, 0xFF8F8F8EFFFFFFFF, 0xFF1F1F1EFFFFFFFF,
+        0xFF3F3F3EFFFFFFFF, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0202000000000000,
+        0x0707070000000000, 0x8F8F8FFEFFFFFFFF, 0x1F1F1FFEFFFFFFFF, 0x3F3F3FFEFFFFFFFF, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0202000000000000, 0x0707070000000000, 0x8F8FFFFEFFFFFFFF,
+        0x1F1FFFFEFFFFFFFF, 0x3F3FFFFEFFFFFFFF, 0xFFFFFFFDFFFFFCFC, 0xFFFFFFFDFFFFF8F8, 0xFFFFFFFDFFFFF1F1,
+        0xFFFFFFFDFFFFE3E3, 0xFFFFFFFDFFFFC7C7, 0xFFFFFFFDFFFF8F8F, 0xFFFFFFFDFFFF1F1F, 0xFFFFFFFDFFFF3F3F,
+        0xFFFFFFFDFFFCFCFC, 0xFFFFFFFDFFF8F8F8, 0xFFFFFFFDFFF1F1F1, 0xFFFFFFFDFFE3E3E3, 0xFFFFFFFDFFC7C7C7,
+        0xFFFFFFFDFF8F8F8F, 0xFFFFFFFDFF1F1F1F, 0xFFFFFFFDFF3F3F3F, 0xFFFFFFFDFCFCFCFF, 0xFFFFFFFDF8F8F8FF,
+        0xFFFFFFFDF1F1F1FF, 0xFFFFFFFDE3E3E3FF, 0xFFFFFFFDC7C7C7FF, 0xFFFFFFFD8F8F8FFF, 0xFFFFFFFD1F1F1FFF,
+        0xFFFFFFFD3F3F3FFF, 0xFFFFFFFCFCFCFFFF, 0xFFFFFFF8F8F8FFFF, 0xFFFFFFF1F1F1FFFF, 0xFFFFFFE1E3E3FFFF,
+        0xFFFFFFC5C7C7FFFF, 0xFFFFFF8D8F8FFFFF, 0xFFFFFF1D1F1FFFFF, 0xFFFFFF3D3F3FFFFF, 0x000F0C0C0C000000,
+        0x0000000000000000, 0x0007010101000000, 0x0F0F030103070000, 0x1F1F070507070000, 0xFFFF8F8D8FFFFFFF,
+        0xFFFF1F1D1FFFFFFF, 0xFFFF3F3D3FFFFFFF, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0703030103000000, 0x0F0707050F070000, 0xFF8F8F8DFFFFFFFF, 0xFF1F1F1DFFFFFFFF, 0xFF3F3F3DFFFFFFFF,
+        0x0C0C0C0C00000000, 0x0000000000000000, 0x0101010100000000, 0x0303030D03000000, 0x0707071D1F070000,
+        0x8F8F8FFDFFFFFFFF, 0x1F1F1FFDFFFFFFFF, 0x3F3F3FFDFFFFFFFF, 0x0C0C0F0D00000000, 0x00080F0D00000000,
+        0x01010F0D00000000, 0x03031F1D03000000, 0x07073F3D1F070000, 0x8F8FFFFDFFFFFFFF, 0x1F1FFFFDFFFFFFFF,
+        0x3F3FFFFDFFFFFFFF, 0xFFFFFFFDFFFFFCFC, 0xFFFFFFFDFFFFF8F8, 0xFFFFFFFDFFFFF1F1, 0xFFFFFFFDFFFFE3E3,
+        0xFFFFFFFDFFFFC7C7, 0xFFFFFFFDFFFF8F8F, 0xFFFFFFFDFFFF1F1F, 0xFFFFFFFDFFFF3F3F, 0xFFFFFFFDFFFCFCFC,
+        0xFFFFFFFDFFF8F8F8, 0xFFFFFFFDFFF1F1F1, 0xFFFFFFFDFFE3E3E3, 0xFFFFFFFDFFC7C7C7, 0xFFFFFFFDFF8F8F8F,
+        0xFFFFFFFDFF1F1F1F, 0xFFFFFFFDFF3F3F3F, 0xFFFFFFFDFCFCFCFF, 0xFFFFFFFDF8F8F8FF, 0xFFFFFFFDF1F1F1FF,
+        0xFFFFFFFDE3E3E3FF, 0xFFFFFFFDC7C7C7FF, 0xFFFFFFFD8F8F8FFF, 0xFFFFFFFD1F1F1FFF, 0xFFFFFFFD3F3F3FFF,
+        0x0000070404000000, 0x0000070000000000, 0x0000070101000000, 0x00070F0103000000, 0x0F0F1F0507070000,
+        0x1F1F3F0D0F070000, 0xFFFFFF1D1F1FFFFF, 0xFFFFFF3D3F3FFFFF, 0x0000040400000000, 0x0000000000000000,
+        0x0000010100000000, 0x0007030103000000, 0x070F070503000000, 0x0F1F0F0D0F070000, 0xFFFF1F1D1FFFFFFF,
+        0xFFFF3F3D3FFFFFFF, 0x0000040000000000, 0x0000000000000000, 0x0000010000000000, 0x0003030100000000,
+        0x0707070503000000, 0x0F0F0F0D0F070000, 0xFF1F1F1DFFFFFFFF, 0xFF3F3F3DFFFFFFFF, 0x0004040000000000,
+        0x0000000000000000, 0x0001010000000000, 0x0303030100000000, 0x0707070D03000000, 0x0F0F0F1D0F070000,
+        0x1F1F1FFDFFFFFFFF, 0x3F3F3FFDFFFFFFFF, 0x0404070000000000, 0x0000070000000000, 0x0101070000000000,
+        0x03030F0100000000, 0x07071F0D03000000, 0x0F0F3F1D1F070000, 0x1F1FFFFDFFFFFFFF, 0x3F3FFFFDFFFFFFFF,
+        0xFFFFFFFBFFFFFCFC, 0xFFFFFFFBFFFFF8F8, 0xFFFFFFFBFFFFF1F1, 0xFFFFFFFBFFFFE3E3, 0xFFFFFFFBFFFFC7C7,
+        0xFFFFFFFBFFFF8F8F, 0xFFFFFFFBFFFF1F1F, 0xFFFFFFFBFFFF3F3F, 0xFFFFFFFBFFFCFCFC, 0xFFFFFFFBFFF8F8F8,
+        0xFFFFFFFBFFF1F1F1, 0xFFFFFFFBFFE3E3E3, 0xFFFFFFFBFFC7C7C7, 0xFFFFFFFBFF8F8F8F, 0xFFFFFFFBFF1F1F1F,
+        0xFFFFFFFBFF3F3F3F, 0xFFFFFFFBFCFCFCFF, 0xFFFFFFFBF8F8F8FF, 0xFFFFFFFBF1F1F1FF, 0xFFFFFFFBE3E3E3FF,
+        0xFFFFFFFBC7C7C7FF, 0xFFFFFFFB8F8F8FFF, 0xFFFFFFFB1F1F1FFF, 0xFFFFFFFB3F3F3FFF, 0xFFFFFFF8FCFCFFFF,
+        0xFFFFFFF8F8F8FFFF, 0xFFFFFFF1F1F1FFFF, 0xFFFFFFE3E3E3FFFF, 0xFFFFFFC3C7C7FFFF, 0xFFFFFF8B8F8FFFFF,
+        0xFFFFFF1B1F1FFFFF, 0xFFFFFF3B3F3FFFFF, 0x3F3F3C383C3E0000, 0x001E181818000000, 0x0000000000000000,
+        0x000F030303000000, 0x1F1F0703070F0000, 0x3F3F0F0B0F0F0000, 0xFFFF1F1B1FFFFFFF, 0xFFFF3F3B3FFFFFFF,
+        0x3E3C3C383C000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0F07070307000000,
+        0x1F0F0F0B1F0F0000, 0xFF1F1F1BFFFFFFFF, 0xFF3F3F3BFFFFFFFF, 0x3C3C3C3B3C000000, 0x1818181800000000,
+        0x0000000000000000, 0x0303030300000000, 0x0707071B07000000, 0x0F0F0F3B3F0F0000, 0x1F1F1FFBFFFFFFFF,
+        0x3F3F3FFBFFFFFFFF, 0x3C3C3F3B3C000000, 0x18181F1B00000000, 0x00111F1B00000000, 0x03031F1B00000000,
+        0x07073F3B07000000, 0x0F0F7F7B3F0F0000, 0x1F1FFFFBFFFFFFFF, 0x3F3FFFFBFFFFFFFF, 0xFFFFFFFBFFFFFCFC,
+        0xFFFFFFFBFFFFF8F8, 0xFFFFFFFBFFFFF1F1, 0xFFFFFFFBFFFFE3E3, 0xFFFFFFFBFFFFC7C7, 0xFFFFFFFBFFFF8F8F,
+        0xFFFFFFFBFFFF1F1F, 0xFFFFFFFBFFFF3F3F, 0xFFFFFFFBFFFCFCFC, 0xFFFFFFFBFFF8F8F8, 0xFFFFFFFBFFF1F1F1,
+        0xFFFFFFFBFFE3E3E3, 0xFFFFFFFBFFC7C7C7, 0xFFFFFFFBFF8F8F8F, 0xFFFFFFFBFF1F1F1F, 0xFFFFFFFBFF3F3F3F,
+        0xFFFFFFFBFCFCFCFF, 0xFFFFFFFBF8F8F8FF, 0xFFFFFFFBF1F1F1FF, 0xFFFFFFFBE3E3E3FF, 0xFFFFFFFBC7C7C7FF,
+        0xFFFFFFFB8F8F8FFF, 0xFFFFFFFB1F1F1FFF, 0xFFFFFFFB3F3F3FFF, 0x001E1F181C000000, 0x00000E0808000000,
+        0x00000E0000000000, 0x00000E0202000000, 0x000F1F0307000000, 0x1F1F3F0B0F0F0000, 0x3F3F7F1B1F0F0000,
+        0xFFFFFF3B3F3FFFFF, 0x001E1C181C000000, 0x0000080800000000, 0x0000000000000000, 0x0000020200000000,
+        0x000F070307000000, 0x0F1F0F0B07000000, 0x1F3F1F1B1F0F0000, 0xFFFF3F3B3FFFFFFF, 0x001C1C1800000000,
+        0x0000080000000000, 0x0000000000000000, 0x0000020000000000, 0x0007070300000000, 0x0F0F0F0B07000000,
+        0x1F1F1F1B1F0F0000, 0xFF3F3F3BFFFFFFFF, 0x1C1C1C1800000000, 0x0008080000000000, 0x0000000000000000,
+        0x0002020000000000, 0x0707070300000000, 0x0F0F0F1B07000000, 0x1F1F1F3B1F0F0000, 0x3F3F3FFBFFFFFFFF,
+        0x1C1C1F1800000000, 0x08080E0000000000, 0x00000E0000000000, 0x02020E0000000000, 0x07071F0300000000,
+        0x0F0F3F1B07000000, 0x1F1F7F3B3F0F0000, 0x3F3FFFFBFFFFFFFF, 0xFFFFFFF7FFFFFCFC, 0xFFFFFFF7FFFFF8F8,
+        0xFFFFFFF7FFFFF1F1, 0xFFFFFFF7FFFFE3E3, 0xFFFFFFF7FFFFC7C7, 0xFFFFFFF7FFFF8F8F, 0xFFFFFFF7FFFF1F1F,
+        0xFFFFFFF7FFFF3F3F, 0xFFFFFFF7FFFCFCFC, 0xFFFFFFF7FFF8F8F8, 0xFFFFFFF7FFF1F1F1, 0xFFFFFFF7FFE3E3E3,
+        0xFFFFFFF7FFC7C7C7, 0xFFFFFFF7FF8F8F8F, 0xFFFFFFF7FF1F1F1F, 0xFFFFFFF7FF3F3F3F, 0xFFFFFFF7FCFCFCFF,
+        0xFFFFFFF7F8F8F8FF, 0xFFFFFFF7F1F1F1FF, 0xFFFFFFF7E3E3E3FF, 0xFFFFFFF7C7C7C7FF, 0xFFFFFFF78F8F8FFF,
+        0xFFFFFFF71F1F1FFF, 0xFFFFFFF73F3F3FFF, 0xFFFFFFF4FCFCFFFF, 0xFFFFFFF0F8F8FFFF, 0xFFFFFFF1F1F1FFFF,
+        0xFFFFFFE3E3E3FFFF, 0xFFFFFFC7C7C7FFFF, 0xFFFFFF878F8FFFFF, 0xFFFFFF171F1FFFFF, 0xFFFFFF373F3FFFFF,
+        0xFFFFFCF4FCFC0000, 0x7E7E7870787C0000, 0x003C303030000000, 0x0000000000000000, 0x001E060606000000,
+        0x3F3F0F070F1F0000, 0x7F7F1F171F1F0000, 0xFFFF3F373FFFFFFF, 0xFEFCFCF4FEFC0000, 0x7C78787078000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x1F0F0F070F000000, 0x3F1F1F173F1F0000,
+        0xFF3F3F37FFFFFFFF, 0xFCFCFCF7FFFC0000, 0x7878787678000000, 0x3030303000000000, 0x0000000000000000,
+        0x0606060600000000, 0x0F0F0F370F000000, 0x1F1F1F777F1F0000, 0x3F3F3FF7FFFFFFFF, 0xFCFCFFF7FFFC0000,
+        0x78787F7778000000, 0x30303E3600000000, 0x00223E3600000000, 0x06063E3600000000, 0x0F0F7F770F000000,
+        0x1F1FFFF77F1F0000, 0x3F3FFFF7FFFFFFFF, 0xFFFFFFF7FFFFFCFC, 0xFFFFFFF7FFFFF8F8, 0xFFFFFFF7FFFFF1F1,
+        0xFFFFFFF7FFFFE3E3, 0xFFFFFFF7FFFFC7C7, 0xFFFFFFF7FFFF8F8F, 0xFFFFFFF7FFFF1F1F, 0xFFFFFFF7FFFF3F3F,
+        0xFFFFFFF7FFFCFCFC, 0xFFFFFFF7FFF8F8F8, 0xFFFFFFF7FFF1F1F1, 0xFFFFFFF7FFE3E3E3, 0xFFFFFFF7FFC7C7C7,
+        0xFFFFFFF7FF8F8F8F, 0xFFFFFFF7FF1F1F1F, 0xFFFFFFF7FF3F3F3F, 0xFFFFFFF7FCFCFCFF, 0xFFFFFFF7F8F8F8FF,
+        0xFFFFFFF7F1F1F1FF, 0xFFFFFFF7E3E3E3FF, 0xFFFFFFF7C7C7C7FF, 0xFFFFFFF78F8F8FFF, 0xFFFFFFF71F1F1FFF,
+        0xFFFFFFF73F3F3FFF, 0x7E7E7F747C7C0000, 0x003C3E3038000000, 0x00001C1010000000, 0x00001C0000000000,
+        0x00001C0404000000, 0x001E3E060E000000, 0x3F3F7F171F1F0000, 0x7F7FFF373F1F0000, 0x7C7E7C7478000000,
+        0x003C383038000000, 0x0000101000000000, 0x0000000000000000, 0x0000040400000000, 0x001E0E060E000000,
+        0x1F3F1F170F000000, 0x3F7F3F373F1F0000, 0x7C7C7C7478000000, 0x0038383000000000, 0x0000100000000000,
+        0x0000000000000000, 0x0000040000000000, 0x000E0E0600000000, 0x1F1F1F170F000000, 0x3F3F3F373F1F0000,
+        0x7C7C7C7678000000, 0x3838383000000000, 0x0010100000000000, 0x0000000000000000, 0x0004040000000000,
+        0x0E0E0E0600000000, 0x1F1F1F370F000000, 0x3F3F3F773F1F0000, 0x7C7C7F7678000000, 0x38383E3000000000,
+        0x10101C0000000000, 0x00001C0000000000, 0x04041C0000000000, 0x0E0E3E0600000000, 0x1F1F7F370F000000,
+        0x3F3FFF777F1F0000, 0xFFFFFFFFFEFFFCFC, 0xFFFFFFFFFEFFF8F8, 0xFFFFFFFFFEFFF1F1, 0xFFFFFFFFFEFFE3E3,
+        0xFFFFFFFFFEFFC7C7, 0xFFFFFFFFFEFF8F8F, 0xFFFFFFFFFEFF1F1F, 0xFFFFFFFFFEFF3F3F, 0xFFFFFFFFFEFCFCFC,
+        0xFFFFFFFFFEF8F8F8, 0xFFFFFFFFFEF1F1F1, 0xFFFFFFFFFEE3E3E3, 0xFFFFFFFFFEC7C7C7, 0xFFFFFFFFFE8F8F8F,
+        0xFFFFFFFFFE1F1F1F, 0xFFFFFFFFFE3F3F3F, 0xFFFFFFFFFCFCFCFF, 0xFFFFFFFFF8F8F8FF, 0xFFFFFFFFF0F1F1FF,
+        0xFFFFFFFFE2E3E3FF, 0xFFFFFFFFC6C7C7FF, 0xFFFFFFFF8E8F8FFF, 0xFFFFFFFF1E1F1FFF, 0xFFFFFFFF3E3F3FFF,
+        0x0000000000000000, 0x0000030000000000, 0x0007070100000000, 0x070F0F0302030000, 0x0F1F1F0706070000,
+        0xFFFFFF8F8E8FFFFF, 0xFFFFFF1F1E1FFFFF, 0xFFFFFF3F3E3FFFFF, 0x0000000000000000, 0x0000000000000000,
+        0x0002000000000000, 0x0707030302000000, 0x0F0F070706000000, 0xFFFF8F8F8EFFFFFF, 0xFFFF1F1F1EFFFFFF,
+        0xFFFF3F3F3EFFFFFF, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0703030300000000,
+        0x0F07070700000000, 0xFF8F8F8FFEFFFFFF, 0xFF1F1F1FFEFFFFFF, 0xFF3F3F3FFEFFFFFF, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0303030000000000, 0x0707070F00000000, 0x8F8F8FFFFEFFFFFF,
+        0x1F1F1FFFFEFFFFFF, 0x3F3F3FFFFEFFFFFF, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0303070000000000, 0x07070F0F00000000, 0x8F8FFFFFFEFFFFFF, 0x1F1FFFFFFEFFFFFF, 0x3F3FFFFFFEFFFFFF,
+        0xFFFFFFFFFEFFFCFC, 0xFFFFFFFFFEFFF8F8, 0xFFFFFFFFFEFFF1F1, 0xFFFFFFFFFEFFE3E3, 0xFFFFFFFFFEFFC7C7,
+        0xFFFFFFFFFEFF8F8F, 0xFFFFFFFFFEFF1F1F, 0xFFFFFFFFFEFF3F3F, 0xFFFFFFFFFEFCFCFC, 0xFFFFFFFFFEF8F8F8,
+        0xFFFFFFFFFEF1F1F1, 0xFFFFFFFFFEE3E3E3, 0xFFFFFFFFFEC7C7C7, 0xFFFFFFFFFE8F8F8F, 0xFFFFFFFFFE1F1F1F,
+        0xFFFFFFFFFE3F3F3F, 0x0000000300000000, 0x0000000300000000, 0x0000030700000000, 0x0007070F02020000,
+        0x070F0F1F06070000, 0x0F1F1F3F0E0F0000, 0xFFFFFFFF1E1F1FFF, 0xFFFFFFFF3E3F3FFF, 0x0000000000000000,
+        0x0000000000000000, 0x0000020000000000, 0x0002060202000000, 0x07070F0706000000, 0x0F0F1F0F0E000000,
+        0xFFFFFF1F1E1FFFFF, 0xFFFFFF3F3E3FFFFF, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0002020200000000, 0x0707070700000000, 0x0F0F0F0F00000000, 0xFFFF1F1F1EFFFFFF, 0xFFFF3F3F3EFFFFFF,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0002020000000000, 0x0707070000000000,
+        0x0F0F0F0F00000000, 0xFF1F1F1FFEFFFFFF, 0xFF3F3F3FFEFFFFFF, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0002000000000000, 0x0707070000000000, 0x0F0F0F0F00000000, 0x1F1F1FFFFEFFFFFF,
+        0x3F3F3FFFFEFFFFFF, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0202000000000000,
+        0x0707070000000000, 0x0F0F0F0F00000000, 0x1F1FFFFFFEFFFFFF, 0x3F3FFFFFFEFFFFFF, 0xFFFFFFFFFDFFFCFC,
+        0xFFFFFFFFFDFFF8F8, 0xFFFFFFFFFDFFF1F1, 0xFFFFFFFFFDFFE3E3, 0xFFFFFFFFFDFFC7C7, 0xFFFFFFFFFDFF8F8F,
+        0xFFFFFFFFFDFF1F1F, 0xFFFFFFFFFDFF3F3F, 0xFFFFFFFFFDFCFCFC, 0xFFFFFFFFFDF8F8F8, 0xFFFFFFFFFDF1F1F1,
+        0xFFFFFFFFFDE3E3E3, 0xFFFFFFFFFDC7C7C7, 0xFFFFFFFFFD8F8F8F, 0xFFFFFFFFFD1F1F1F, 0xFFFFFFFFFD3F3F3F,
+        0xFFFFFFFFFCFCFCFF, 0xFFFFFFFFF8F8F8FF, 0xFFFFFFFFF1F1F1FF, 0xFFFFFFFFE1E3E3FF, 0xFFFFFFFFC5C7C7FF,
+        0xFFFFFFFF8D8F8FFF, 0xFFFFFFFF1D1F1FFF, 0xFFFFFFFF3D3F3FFF, 0x00000F0C0C0C0000, 0x0000000000000000,
+        0x0000070101010000, 0x000F0F0301030700, 0x0F1F1F0705070700, 0x1F3F3F0F0D0F1F0F, 0xFFFFFF1F1D1FFFFF,
+        0xFFFFFF3F3D3FFFFF, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0007030301030000,
+        0x0F0F0707050F0700, 0x1F1F0F0F0D1F1F0F, 0xFFFF1F1F1DFFFFFF, 0xFFFF3F3F3DFFFFFF, 0x000C0C0C0C000000,
+        0x0000000000000000, 0x0001010101000000, 0x0703030305030000, 0x0F0707070D0F0700, 0x1F0F0F0F1D1F1F0F,
+        0xFF1F1F1FFDFFFFFF, 0xFF3F3F3FFDFFFFFF, 0x0C0C0C0E0D000000, 0x0000000505000000, 0x0101010B0D000000,
+        0x030303171D030000, 0x0707072F3D0F0700, 0x0F0F0F5F7D1F1F0F, 0x1F1F1FFFFDFFFFFF, 0x3F3F3FFFFDFFFFFF,
+        0x0C0C0F0F0C000000, 0x00080F0F00000000, 0x01010F0F01000000, 0x03031F1F05030000, 0x07073F3F0D0F0700,
+        0x0F0F7F7F1D1F1F0F, 0x1F1FFFFFFDFFFFFF, 0x3F3FFFFFFDFFFFFF, 0xFFFFFFFFFDFFFCFC, 0xFFFFFFFFFDFFF8F8,
+        0xFFFFFFFFFDFFF1F1, 0xFFFFFFFFFDFFE3E3, 0xFFFFFFFFFDFFC7C7, 0xFFFFFFFFFDFF8F8F, 0xFFFFFFFFFDFF1F1F,
+        0xFFFFFFFFFDFF3F3F, 0xFFFFFFFFFDFCFCFC, 0xFFFFFFFFFDF8F8F8, 0xFFFFFFFFFDF1F1F1, 0xFFFFFFFFFDE3E3E3,
+        0xFFFFFFFFFDC7C7C7, 0xFFFFFFFFFD8F8F8F, 0xFFFFFFFFFD1F1F1F, 0xFFFFFFFFFD3F3F3F, 0x0000000704040000,
+        0x0000000700000000, 0x0000000701010000, 0x0000070F01030000, 0x000F0F1F05070700, 0x0F1F1F3F0D0F0700,
+        0x1F3F3F7F1D1F1F0F, 0xFFFFFFFF3D3F3FFF, 0x0000000404000000, 0x0000000000000000, 0x0000000101000000,
+        0x0000070301030000, 0x00070F0705030000, 0x0F0F1F0F0D0F0700, 0x1F1F3F1F1D1F1F0F, 0xFFFFFF3F3D3FFFFF,
+        0x0000000400000000, 0x0000000000000000, 0x0000000100000000, 0x0000030301000000, 0x0007070705030000,
+        0x0F0F0F0F0D0F0700, 0x1F1F1F1F1D1F1F0F, 0xFFFF3F3F3DFFFFFF, 0x0000040400000000, 0x0000000000000000,
+        0x0000010100000000, 0x0003030301000000, 0x0007070705030000, 0x0F0F0F0F0D0F0700, 0x1F1F1F1F1D1F1F0F,
+        0xFF3F3F3FFDFFFFFF, 0x0004040500000000, 0x0000000200000000, 0x0001010500000000, 0x0003030B01000000,
+        0x0707071705030000, 0x0F0F0F2F0D0F0700, 0x1F1F1F5F1D1F1F0F, 0x3F3F3FFFFDFFFFFF, 0x0404070400000000,
+        0x0000070000000000, 0x0101070100000000, 0x03030F0301000000, 0x07071F0705030000, 0x0F0F3F0F0D0F0700,
+        0x1F1F7F5F1D1F1F0F, 0x3F3FFFFFFDFFFFFF, 0xFFFFFFFFFBFFFCFC, 0xFFFFFFFFFBFFF8F8, 0xFFFFFFFFFBFFF1F1,
+        0xFFFFFFFFFBFFE3E3, 0xFFFFFFFFFBFFC7C7, 0xFFFFFFFFFBFF8F8F, 0xFFFFFFFFFBFF1F1F, 0xFFFFFFFFFBFF3F3F,
+        0xFFFFFFFFFBFCFCFC, 0xFFFFFFFFFBF8F8F8, 0xFFFFFFFFFBF1F1F1, 0xFFFFFFFFFBE3E3E3, 0xFFFFFFFFFBC7C7C7,
+        0xFFFFFFFFFB8F8F8F, 0xFFFFFFFFFB1F1F1F, 0xFFFFFFFFFB3F3F3F, 0xFFFFFFFFF8FCFCFF, 0xFFFFFFFFF8F8F8FF,
+        0xFFFFFFFFF1F1F1FF, 0xFFFFFFFFE3E3E3FF, 0xFFFFFFFFC3C7C7FF, 0xFFFFFFFF8B8F8FFF, 0xFFFFFFFF1B1F1FFF,
+        0xFFFFFFFF3B3F3FFF, 0x003F3F3C383C3E00, 0x00001E1818180000, 0x0000000000000000, 0x00000F0303030000,
+        0x001F1F0703070F00, 0x1F3F3F0F0B0F0F00, 0x3F7F7F1F1B1F3F1F, 0xFFFFFF3F3B3FFFFF, 0x003E3C3C383C0000,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x000F070703070000, 0x1F1F0F0F0B1F0F00,
+        0x3F3F1F1F1B3F3F1F, 0xFFFF3F3F3BFFFFFF, 0x3E3C3C3C3A3C0000, 0x0018181818000000, 0x0000000000000000,
+        0x0003030303000000, 0x0F0707070B070000, 0x1F0F0F0F1B1F0F00, 0x3F1F1F1F3B3F3F1F, 0xFF3F3F3FFBFFFFFF,
+        0x3C3C3C3E3B3C0000, 0x1818181D1B000000, 0x0000000A0A000000, 0x030303171B000000, 0x0707072F3B070000,
+        0x0F0F0F5F7B1F0F00, 0x1F1F1FBFFB3F3F1F, 0x3F3F3FFFFBFFFFFF, 0x3C3C3F3F3A3C0000, 0x18181F1F18000000,
+        0x00111F1F00000000, 0x03031F1F03000000, 0x07073F3F0B070000, 0x0F0F7F7F1B1F0F00, 0x1F1FFFFF3B3F3F1F,
+        0x3F3FFFFFFBFFFFFF, 0xFFFFFFFFFBFFFCFC, 0xFFFFFFFFFBFFF8F8, 0xFFFFFFFFFBFFF1F1, 0xFFFFFFFFFBFFE3E3,
+        0xFFFFFFFFFBFFC7C7, 0xFFFFFFFFFBFF8F8F, 0xFFFFFFFFFBFF1F1F, 0xFFFFFFFFFBFF3F3F, 0xFFFFFFFFFBFCFCFC,
+        0xFFFFFFFFFBF8F8F8, 0xFFFFFFFFFBF1F1F1, 0xFFFFFFFFFBE3E3E3, 0xFFFFFFFFFBC7C7C7, 0xFFFFFFFFFB8F8F8F,
+        0xFFFFFFFFFB1F1F1F, 0xFFFFFFFFFB3F3F3F, 0x00001E1F181C0000, 0x0000000E08080000, 0x0000000E00000000,
+        0x0000000E02020000, 0x00000F1F03070000, 0x001F1F3F0B0F0F00, 0x1F3F3F7F1B1F0F00, 0x3F7F7FFF3B3F3F1F,
+        0x00001E1C181C0000, 0x0000000808000000, 0x0000000000000000, 0x0000000202000000, 0x00000F0703070000,
+        0x000F1F0F0B070000, 0x1F1F3F1F1B1F0F00, 0x3F3F7F3F3B3F3F1F, 0x00001C1C18000000, 0x0000000800000000,
+        0x0000000000000000, 0x0000000200000000, 0x0000070703000000, 0x000F0F0F0B070000, 0x1F1F1F1F1B1F0F00,
+        0x3F3F3F3F3B3F3F1F, 0x001C1C1C18000000, 0x0000080800000000, 0x0000000000000000, 0x0000020200000000,
+        0x0007070703000000, 0x000F0F0F0B070000, 0x1F1F1F1F1B1F0F00, 0x3F3F3F3F3B3F3F1F, 0x001C1C1D18000000,
+        0x0008080A00000000, 0x0000000400000000, 0x0002020A00000000, 0x0007071703000000, 0x0F0F0F2F0B070000,
+        0x1F1F1F5F1B1F0F00, 0x3F3F3FBF3B3F3F1F, 0x1C1C1F1C18000000, 0x08080E0800000000, 0x00000E0000000000,
+        0x02020E0200000000, 0x07071F0703000000, 0x0F0F3F0F0B070000, 0x1F1F7F1F1B1F0F00, 0x3F3FFFBF3B3F3F1F,
+        0xFFFFFFFFF7FFFCFC, 0xFFFFFFFFF7FFF8F8, 0xFFFFFFFFF7FFF1F1, 0xFFFFFFFFF7FFE3E3, 0xFFFFFFFFF7FFC7C7,
+        0xFFFFFFFFF7FF8F8F, 0xFFFFFFFFF7FF1F1F, 0xFFFFFFFFF7FF3F3F, 0xFFFFFFFFF7FCFCFC, 0xFFFFFFFFF7F8F8F8,
+        0xFFFFFFFFF7F1F1F1, 0xFFFFFFFFF7E3E3E3, 0xFFFFFFFFF7C7C7C7, 0xFFFFFFFFF78F8F8F, 0xFFFFFFFFF71F1F1F,
+        0xFFFFFFFFF73F3F3F, 0xFFFFFFFFF4FCFCFF, 0xFFFFFFFFF0F8F8FF, 0xFFFFFFFFF1F1F1FF, 0xFFFFFFFFE3E3E3FF,
+        0xFFFFFFFFC7C7C7FF, 0xFFFFFFFF878F8FFF, 0xFFFFFFFF171F1FFF, 0xFFFFFFFF373F3FFF, 0xFEFFFFFCF4FCFC00,
+        0x007E7E7870787C00, 0x00003C3030300000, 0x0000000000000000, 0x00001E0606060000, 0x003F3F0F070F1F00,
+        0x3F7F7F1F171F1F00, 0x7FFFFF3F373F7F3F, 0xFEFEFCFCF4FEFC00, 0x007C787870780000, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x001F0F0F070F0000, 0x3F3F1F1F173F1F00, 0x7F7F3F3F377F7F3F,
+        0xFEFCFCFCF6FEFC00, 0x7C78787874780000, 0x0030303030000000, 0x0000000000000000, 0x0006060606000000,
+        0x1F0F0F0F170F0000, 0x3F1F1F1F373F1F00, 0x7F3F3F3F777F7F3F, 0xFCFCFCFEF7FEFC00, 0x7878787D77780000,
+        0x3030303A36000000, 0x0000001414000000, 0x0606062E36000000, 0x0F0F0F5F770F0000, 0x1F1F1FBFF73F1F00,
+        0x3F3F3F7FF77F7F3F, 0xFCFCFFFFF6FEFC00, 0x78787F7F74780000, 0x30303E3E30000000, 0x00223E3E00000000,
+        0x06063E3E06000000, 0x0F0F7F7F170F0000, 0x1F1FFFFF373F1F00, 0x3F3FFFFF777F7F3F, 0xFFFFFFFFF7FFFCFC,
+        0xFFFFFFFFF7FFF8F8, 0xFFFFFFFFF7FFF1F1, 0xFFFFFFFFF7FFE3E3, 0xFFFFFFFFF7FFC7C7, 0xFFFFFFFFF7FF8F8F,
+        0xFFFFFFFFF7FF1F1F, 0xFFFFFFFFF7FF3F3F, 0xFFFFFFFFF7FCFCFC, 0xFFFFFFFFF7F8F8F8, 0xFFFFFFFFF7F1F1F1,
+        0xFFFFFFFFF7E3E3E3, 0xFFFFFFFFF7C7C7C7, 0xFFFFFFFFF78F8F8F, 0xFFFFFFFFF71F1F1F, 0xFFFFFFFFF73F3F3F,
+        0x007E7E7F747C7C00, 0x00003C3E30380000, 0x0000001C10100000, 0x0000001C00000000, 0x0000001C04040000,
+        0x00001E3E060E0000, 0x003F3F7F171F1F00, 0x3F7F7FFF373F1F00, 0x007C7E7C74780000, 0x00003C3830380000,
+        0x0000001010000000, 0x0000000000000000, 0x0000000404000000, 0x00001E0E060E0000, 0x001F3F1F170F0000,
+        0x3F3F7F3F373F1F00, 0x007C7C7C74780000, 0x0000383830000000, 0x0000001000000000, 0x0000000000000000,
+        0x0000000400000000, 0x00000E0E06000000, 0x001F1F1F170F0000, 0x3F3F3F3F373F1F00, 0x007C7C7C74780000,
+        0x0038383830000000, 0x0000101000000000, 0x0000000000000000, 0x0000040400000000, 0x000E0E0E06000000,
+        0x001F1F1F170F0000, 0x3F3F3F3F373F1F00, 0x7C7C7C7D74780000, 0x0038383A30000000, 0x0010101400000000,
+        0x0000000800000000, 0x0004041400000000, 0x000E0E2E06000000, 0x1F1F1F5F170F0000, 0x3F3F3FBF373F1F00,
+        0x7C7C7F7C74780000, 0x38383E3830000000, 0x10101C1000000000, 0x00001C0000000000, 0x04041C0400000000,
+        0x0E0E3E0E06000000, 0x1F1F7F1F170F0000, 0x3F3FFF3F373F1F00, 0xFFFFFFFFFFFEFCFC, 0xFFFFFFFFFFFEF8F8,
+        0xFFFFFFFFFFFEF1F1, 0xFFFFFFFFFFFEE3E3, 0xFFFFFFFFFFFEC7C7, 0xFFFFFFFFFFFE8F8F, 0xFFFFFFFFFFFE1F1F,
+        0xFFFFFFFFFFFE3F3F, 0xFFFFFFFFFFFCFCFC, 0xFFFFFFFFFFF8F8F8, 0xFFFFFFFFFFF0F1F1, 0xFFFFFFFFFFE2E3E3,
+        0xFFFFFFFFFFC6C7C7, 0xFFFFFFFFFF8E8F8F, 0xFFFFFFFFFF1E1F1F, 0xFFFFFFFFFF3E3F3F, 0x0000000000000000,
+        0x0000000300000000, 0x0000070701000000, 0x00070F0F03020300, 0x0F0F1F1F07060700, 0x1F1F3F3F0F0E0F00,
+        0xFFFFFFFF1F1E1FFF, 0xFFFFFFFF3F3E3FFF, 0x0000000000000000, 0x0000000000000000, 0x0000020000000000,
+        0x0007070303020000, 0x0F0F0F0707060000, 0x1F1F1F0F0F0E0000, 0xFFFFFF1F1F1EFFFF, 0xFFFFFF3F3F3EFFFF,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0007030303000000, 0x0F0F070707000000,
+        0x1F1F0F0F0F000000, 0xFFFF1F1F1FFEFFFF, 0xFFFF3F3F3FFEFFFF, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0003030300000000, 0x0F07070700000000, 0x1F0F0F0F1F000000, 0xFF1F1F1FFFFEFFFF,
+        0xFF3F3F3FFFFEFFFF, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0303030000000000,
+        0x0707070F00000000, 0x0F0F0F1F1F000000, 0x1F1F1FFFFFFEFFFF, 0x3F3F3FFFFFFEFFFF, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0303070000000000, 0x07070F0F00000000, 0x0F0F1F1F1F000000,
+        0x1F1FFFFFFFFEFFFF, 0x3F3FFFFFFFFEFFFF, 0xFFFFFFFFFFFEFCFC, 0xFFFFFFFFFFFEF8F8, 0xFFFFFFFFFFFEF1F1,
+        0xFFFFFFFFFFFEE3E3, 0xFFFFFFFFFFFEC7C7, 0xFFFFFFFFFFFE8F8F, 0xFFFFFFFFFFFE1F1F, 0xFFFFFFFFFFFE3F3F,
+        0x0000000003000000, 0x0000000003000000, 0x0000000307000000, 0x000007070F020200, 0x00070F0F1F060700,
+        0x0F0F1F1F3F0E0F00, 0x1F1F3F3F7F1E1F00, 0xFFFFFFFFFF3E3F3F, 0x0000000000000000, 0x0000000000000000,
+        0x0000000200000000, 0x0000020602020000, 0x0007070F07060000, 0x0F0F0F1F0F0E0000, 0x1F1F1F3F1F1E0000,
+        0xFFFFFFFF3F3E3FFF, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000020202000000,
+        0x0007070707000000, 0x0F0F0F0F0F000000, 0x1F1F1F1F1F000000, 0xFFFFFF3F3F3EFFFF, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000020200000000, 0x0007070700000000, 0x0F0F0F0F00000000,
+        0x1F1F1F1F1F000000, 0xFFFF3F3F3FFEFFFF, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0000020000000000, 0x0007070000000000, 0x0F0F0F0F00000000, 0x1F1F1F1F1F000000, 0xFF3F3F3FFFFEFFFF,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0002000000000000, 0x0007070000000000,
+        0x0F0F0F0F00000000, 0x1F1F1F1F1F000000, 0x3F3F3FFFFFFEFFFF, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0202000000000000, 0x0707070000000000, 0x0F0F0F0F00000000, 0x1F1F1F1F1F000000,
+        0x3F3FFFFFFFFEFFFF, 0xFFFFFFFFFFFDFCFC, 0xFFFFFFFFFFFDF8F8, 0xFFFFFFFFFFFDF1F1, 0xFFFFFFFFFFFDE3E3,
+        0xFFFFFFFFFFFDC7C7, 0xFFFFFFFFFFFD8F8F, 0xFFFFFFFFFFFD1F1F, 0xFFFFFFFFFFFD3F3F, 0xFFFFFFFFFFFCFCFC,
+        0xFFFFFFFFFFF8F8F8, 0xFFFFFFFFFFF1F1F1, 0xFFFFFFFFFFE1E3E3, 0xFFFFFFFFFFC5C7C7, 0xFFFFFFFFFF8D8F8F,
+        0xFFFFFFFFFF1D1F1F, 0xFFFFFFFFFF3D3F3F, 0x0000000F0C0C0C00, 0x0000000000000000, 0x0000000701010100,
+        0x00000F0F03010307, 0x000F1F1F07050707, 0x1F1F3F3F0F0D0F1F, 0x3F3F7F7F1F1D1F3F, 0xFFFFFFFF3F3D3FFF,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000070303010300, 0x000F0F0707050F07,
+        0x1F1F1F0F0F0D1F1F, 0x3F3F3F1F1F1D3F3F, 0xFFFFFF3F3F3DFFFF, 0x00000C0C0C0C0000, 0x0000000000000000,
+        0x0000010101010000, 0x0007030303050300, 0x000F0707070D0F07, 0x1F1F0F0F0F1D1F1F, 0x3F3F1F1F1F3D3F3F,
+        0xFFFF3F3F3FFDFFFF, 0x000C0C0C0E0D0000, 0x0000000005050000, 0x000101010B0D0000, 0x00030303171D0300,
+        0x0F0707072F3D0F07, 0x1F0F0F0F5F7D1F1F, 0x3F1F1F1FBFFD3F3F, 0xFF3F3F3FFFFDFFFF, 0x0C0C0C0F0F0C0000,
+        0x0000080F0F000000, 0x0101010F0F010000, 0x0303031F1F050300, 0x0707073F3F0D0F07, 0x0F0F0F7F7F1D1F1F,
+        0x1F1F1FFFFF3D3F3F, 0x3F3F3FFFFFFDFFFF, 0x0C1C1F1F1F1D0000, 0x00181F1F1F1D0000, 0x01111F1F1F1D0000,
+        0x03031F1F1F1D0300, 0x07073F3F3F3D0F07, 0x0F0F7F7F7F7D1F1F, 0x1F1FFFFFFFFD3F3F, 0x3F3FFFFFFFFDFFFF,
+        0xFFFFFFFFFFFDFCFC, 0xFFFFFFFFFFFDF8F8, 0xFFFFFFFFFFFDF1F1, 0xFFFFFFFFFFFDE3E3, 0xFFFFFFFFFFFDC7C7,
+        0xFFFFFFFFFFFD8F8F, 0xFFFFFFFFFFFD1F1F, 0xFFFFFFFFFFFD3F3F, 0x0000000007040400, 0x0000000007000000,
+        0x0000000007010100, 0x000000070F010300, 0x00000F0F1F050707, 0x000F1F1F3F0D0F07, 0x1F1F3F3F7F1D1F1F,
+        0x3F3F7F7FFF3D3F3F, 0x0000000004040000, 0x0000000000000000, 0x0000000001010000, 0x0000000703010300,
+        0x0000070F07050300, 0x000F0F1F0F0D0F07, 0x1F1F1F3F1F1D1F1F, 0x3F3F3F7F3F3D3F3F, 0x0000000004000000,
+        0x0000000000000000, 0x0000000001000000, 0x0000000303010000, 0x0000070707050300, 0x000F0F0F0F0D0F07,
+        0x1F1F1F1F1F1D1F1F, 0x3F3F3F3F3F3D3F3F, 0x0000000404000000, 0x0000000000000000, 0x0000000101000000,
+        0x0000030303010000, 0x0000070707050300, 0x000F0F0F0F0D0F07, 0x1F1F1F1F1F1D1F1F, 0x3F3F3F3F3F3D3F3F,
+        0x0000040405000000, 0x0000000002000000, 0x0000010105000000, 0x000003030B010000, 0x0007070717050300,
+        0x000F0F0F2F0D0F07, 0x1F1F1F1F5F1D1F1F, 0x3F3F3F3FBF3D3F3F, 0x0004040704000000, 0x0000000700000000,
+        0x0001010701000000, 0x0003030F03010000, 0x0007071F07050300, 0x0F0F0F3F0F0D0F07, 0x1F1F1F7F1F1D1F1F,
+        0x3F3F3FFFBF3D3F3F, 0x04040F0F0F000000, 0x00000F0F0F000000, 0x01010F0F0F000000, 0x03030F0F0F010000,
+        0x07071F1F1F050300, 0x0F0F3F3F3F0D0F07, 0x1F1F7F7F7F1D1F1F, 0x3F3FFFFFFF3D3F3F, 0xFFFFFFFFFFFBFCFC,
+        0xFFFFFFFFFFFBF8F8, 0xFFFFFFFFFFFBF1F1, 0xFFFFFFFFFFFBE3E3, 0xFFFFFFFFFFFBC7C7, 0xFFFFFFFFFFFB8F8F,
+        0xFFFFFFFFFFFB1F1F, 0xFFFFFFFFFFFB3F3F, 0xFFFFFFFFFFF8FCFC, 0xFFFFFFFFFFF8F8F8, 0xFFFFFFFFFFF1F1F1,
+        0xFFFFFFFFFFE3E3E3, 0xFFFFFFFFFFC3C7C7, 0xFFFFFFFFFF8B8F8F, 0xFFFFFFFFFF1B1F1F, 0xFFFFFFFFFF3B3F3F,
+        0x00003F3F3C383C3E, 0x0000001E18181800, 0x0000000000000000, 0x0000000F03030300, 0x00001F1F0703070F,
+        0x001F3F3F0F0B0F0F, 0x3F3F7F7F1F1B1F3F, 0x7F7FFFFF3F3B3F7F, 0x00003E3C3C383C00, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x00000F0707030700, 0x001F1F0F0F0B1F0F, 0x3F3F3F1F1F1B3F3F,
+        0x7F7F7F3F3F3B7F7F, 0x003E3C3C3C3A3C00, 0x0000181818180000, 0x0000000000000000, 0x0000030303030000,
+        0x000F0707070B0700, 0x001F0F0F0F1B1F0F, 0x3F3F1F1F1F3B3F3F, 0x7F7F3F3F3F7B7F7F, 0x003C3C3C3E3B3C00,
+        0x001818181D1B0000, 0x000000000A0A0000, 0x00030303171B0000, 0x000707072F3B0700, 0x1F0F0F0F5F7B1F0F,
+        0x3F1F1F1FBFFB3F3F, 0x7F3F3F3F7FFB7F7F, 0x3C3C3C3F3F3A3C00, 0x1818181F1F180000, 0x0000111F1F000000,
+        0x0303031F1F030000, 0x0707073F3F0B0700, 0x0F0F0F7F7F1B1F0F, 0x1F1F1FFFFF3B3F3F, 0x3F3F3FFFFF7B7F7F,
+        0x3C3C3F3F3F3B3C00, 0x18383F3F3F3B0000, 0x00313F3F3F3B0000, 0x03233F3F3F3B0000, 0x07073F3F3F3B0700,
+        0x0F0F7F7F7F7B1F0F, 0x1F1FFFFFFFFB3F3F, 0x3F3FFFFFFFFB7F7F, 0xFFFFFFFFFFFBFCFC, 0xFFFFFFFFFFFBF8F8,
+        0xFFFFFFFFFFFBF1F1, 0xFFFFFFFFFFFBE3E3, 0xFFFFFFFFFFFBC7C7, 0xFFFFFFFFFFFB8F8F, 0xFFFFFFFFFFFB1F1F,
+        0xFFFFFFFFFFFB3F3F, 0x0000001E1F181C00, 0x000000000E080800, 0x000000000E000000, 0x000000000E020200,
+        0x0000000F1F030700, 0x00001F1F3F0B0F0F, 0x001F3F3F7F1B1F0F, 0x3F3F7F7FFF3B3F3F, 0x0000001E1C181C00,
+        0x0000000008080000, 0x0000000000000000, 0x0000000002020000, 0x0000000F07030700, 0x00000F1F0F0B0700,
+        0x001F1F3F1F1B1F0F, 0x3F3F3F7F3F3B3F3F, 0x0000001C1C180000, 0x0000000008000000, 0x0000000000000000,
+        0x0000000002000000, 0x0000000707030000, 0x00000F0F0F0B0700, 0x001F1F1F1F1B1F0F, 0x3F3F3F3F3F3B3F3F,
+        0x00001C1C1C180000, 0x0000000808000000, 0x0000000000000000, 0x0000000202000000, 0x0000070707030000,
+        0x00000F0F0F0B0700, 0x001F1F1F1F1B1F0F, 0x3F3F3F3F3F3B3F3F, 0x00001C1C1D180000, 0x000008080A000000,
+        0x0000000004000000, 0x000002020A000000, 0x0000070717030000, 0x000F0F0F2F0B0700, 0x001F1F1F5F1B1F0F,
+        0x3F3F3F3FBF3B3F3F, 0x001C1C1F1C180000, 0x0008080E08000000, 0x0000000E00000000, 0x0002020E02000000,
+        0x0007071F07030000, 0x000F0F3F0F0B0700, 0x1F1F1F7F1F1B1F0F, 0x3F3F3FFF3F3B3F3F, 0x1C1C1F1F1F180000,
+        0x08081F1F1F000000, 0x00001F1F1F000000, 0x02021F1F1F000000, 0x07071F1F1F030000, 0x0F0F3F3F3F0B0700,
+        0x1F1F7F7F7F1B1F0F, 0x3F3FFFFFFF3B3F3F, 0xFFFFFFFFFFF7FCFC, 0xFFFFFFFFFFF7F8F8, 0xFFFFFFFFFFF7F1F1,
+        0xFFFFFFFFFFF7E3E3, 0xFFFFFFFFFFF7C7C7, 0xFFFFFFFFFFF78F8F, 0xFFFFFFFFFFF71F1F, 0xFFFFFFFFFFF73F3F,
+        0xFFFFFFFFFFF4FCFC, 0xFFFFFFFFFFF0F8F8, 0xFFFFFFFFFFF1F1F1, 0xFFFFFFFFFFE3E3E3, 0xFFFFFFFFFFC7C7C7,
+        0xFFFFFFFFFF878F8F, 0xFFFFFFFFFF171F1F, 0xFFFFFFFFFF373F3F, 0x00FEFFFFFCF4FCFC, 0x00007E7E7870787C,
+        0x0000003C30303000, 0x0000000000000000, 0x0000001E06060600, 0x00003F3F0F070F1F, 0x003F7F7F1F171F1F,
+        0x7F7FFFFF3F373F7F, 0x00FEFEFCFCF4FEFC, 0x00007C7878707800, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x00001F0F0F070F00, 0x003F3F1F1F173F1F, 0x7F7F7F3F3F377F7F, 0x00FEFCFCFCF6FEFC,
+        0x007C787878747800, 0x0000303030300000, 0x0000000000000000, 0x0000060606060000, 0x001F0F0F0F170F00,
+        0x003F1F1F1F373F1F, 0x7F7F3F3F3F777F7F, 0xFEFCFCFCFEF7FEFC, 0x007878787D777800, 0x003030303A360000,
+        0x0000000014140000, 0x000606062E360000, 0x000F0F0F5F770F00, 0x3F1F1F1FBFF73F1F, 0x7F3F3F3F7FF77F7F,
+        0xFCFCFCFFFFF6FEFC, 0x7878787F7F747800, 0x3030303E3E300000, 0x0000223E3E000000, 0x0606063E3E060000,
+        0x0F0F0F7F7F170F00, 0x1F1F1FFFFF373F1F, 0x3F3F3FFFFF777F7F, 0xFCFCFFFFFFF7FEFC, 0x78787F7F7F777800,
+        0x30717F7F7F770000, 0x00637F7F7F770000, 0x06477F7F7F770000, 0x0F0F7F7F7F770F00, 0x1F1FFFFFFFF73F1F,
+        0x3F3FFFFFFFF77F7F, 0xFFFFFFFFFFF7FCFC, 0xFFFFFFFFFFF7F8F8, 0xFFFFFFFFFFF7F1F1, 0xFFFFFFFFFFF7E3E3,
+        0xFFFFFFFFFFF7C7C7, 0xFFFFFFFFFFF78F8F, 0xFFFFFFFFFFF71F1F, 0xFFFFFFFFFFF73F3F, 0x00007E7E7F747C7C,
+        0x0000003C3E303800, 0x000000001C101000, 0x000000001C000000, 0x000000001C040400, 0x0000001E3E060E00,
+        0x00003F3F7F171F1F, 0x003F7F7FFF373F1F, 0x00007C7E7C747800, 0x0000003C38303800, 0x0000000010100000,
+        0x0000000000000000, 0x0000000004040000, 0x0000001E0E060E00, 0x00001F3F1F170F00, 0x003F3F7F3F373F1F,
+        0x00007C7C7C747800, 0x0000003838300000, 0x0000000010000000, 0x0000000000000000, 0x0000000004000000,
+        0x0000000E0E060000, 0x00001F1F1F170F00, 0x003F3F3F3F373F1F, 0x00007C7C7C747800, 0x0000383838300000,
+        0x0000001010000000, 0x0000000000000000, 0x0000000404000000, 0x00000E0E0E060000, 0x00001F1F1F170F00,
+        0x003F3F3F3F373F1F, 0x007C7C7C7D747800, 0x000038383A300000, 0x0000101014000000, 0x0000000008000000,
+        0x0000040414000000, 0x00000E0E2E060000, 0x001F1F1F5F170F00, 0x003F3F3FBF373F1F, 0x007C7C7F7C747800,
+        0x0038383E38300000, 0x0010101C10000000, 0x0000001C00000000, 0x0004041C04000000, 0x000E0E3E0E060000,
+        0x001F1F7F1F170F00, 0x3F3F3FFF3F373F1F, 0x7C7C7F7F7F747800, 0x38383E3E3E300000, 0x10103E3E3E000000,
+        0x00003E3E3E000000, 0x04043E3E3E000000, 0x0E0E3E3E3E060000, 0x1F1F7F7F7F170F00, 0x3F3FFFFFFF373F1F,
+        0xFFFFFFFFFFFFFCFC, 0xFFFFFFFFFFFFF8F8, 0xFFFFFFFFFFFFF0F1, 0xFFFFFFFFFFFFE2E3, 0xFFFFFFFFFFFFC6C7,
+        0xFFFFFFFFFFFF8E8F, 0xFFFFFFFFFFFF1E1F, 0xFFFFFFFFFFFF3E3F, 0x0000000000000000, 0xFFFFFFFFFFF8F8F8,
+        0xFFFFFFFFFFF1F0F1, 0xFFFFFFFFFFE3E2E3, 0xFFFFFFFFFFC7C6C7, 0xFFFFFFFFFF8F8E8F, 0xFFFFFFFFFF1F1E1F,
+        0xFFFFFFFFFF3F3E3F, 0x0000000000000000, 0x0000000000000000, 0x00000F0F01000000, 0x00071F1F03030200,
+        0x0F0F3F3F07070600, 0x1F1F7F7F0F0F0E00, 0xFFFFFFFF1F1F1EFF, 0xFFFFFFFF3F3F3EFF, 0x0000000000000000,
+        0x0000000000000000, 0x0000020000000000, 0x0007070303030000, 0x0F0F0F0707070000, 0x1F1F1F0F0F0F0000,
+        0xFFFFFF1F1F1FFEFF, 0xFFFFFF3F3F3FFEFF, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0007030303000000, 0x0F0F070707000000, 0x1F1F0F0F0F000000, 0xFFFF1F1F1FFFFEFF, 0xFFFF3F3F3FFFFEFF,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0003030300000000, 0x0F07070700000000,
+        0x1F0F0F0F1F000000, 0xFF1F1F1FFFFFFEFF, 0xFF3F3F3FFFFFFEFF, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0303030000000000, 0x0707070F00000000, 0x0F0F0F1F1F000000, 0x1F1F1FFFFFFFFEFF,
+        0x3F3F3FFFFFFFFEFF, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0303070000000000,
+        0x07070F0F00000000, 0x0F0F1F1F1F000000, 0x1F1FFFFFFFFFFEFF, 0x3F3FFFFFFFFFFEFF, 0x0000000000030000,
+        0x0000000000030000, 0xFFFFFFFFFFFFF0F1, 0xFFFFFFFFFFFFE2E3, 0xFFFFFFFFFFFFC6C7, 0xFFFFFFFFFFFF8E8F,
+        0xFFFFFFFFFFFF1E1F, 0xFFFFFFFFFFFF3E3F, 0x0000000000000000, 0x0000000000000000, 0x00000F0F0F000000,
+        0x00000F0F0F020200, 0x00071F1F1F070600, 0x0F0F3F3F3F0F0E00, 0x1F1F7F7F7F1F1E00, 0xFFFFFFFFFF3F3E3F,
+        0x0000000000000000, 0x0000000000000000, 0x0000000600000000, 0x0000020E02020000, 0x0007071F07070000,
+        0x0F0F0F3F0F0F0000, 0x1F1F1F7F1F1F0000, 0xFFFFFFFF3F3F3EFF, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x0000020202000000, 0x0007070707000000, 0x0F0F0F0F0F000000, 0x1F1F1F1F1F000000,
+        0xFFFFFF3F3F3FFEFF, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000020200000000,
+        0x0007070700000000, 0x0F0F0F0F00000000, 0x1F1F1F1F1F000000, 0xFFFF3F3F3FFFFEFF, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x0000020000000000, 0x0007070000000000, 0x0F0F0F0F00000000,
+        0x1F1F1F1F1F000000, 0xFF3F3F3FFFFFFEFF, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x0002000000000000, 0x0007070000000000, 0x0F0F0F0F00000000, 0x1F1F1F1F1F000000, 0x3F3F3FFFFFFFFEFF,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0202000000000000, 0x0707070000000000,
+        0x0F0F0F0F00000000, 0x1F1F1F1F1F000000, 0x3F3FFFFFFFFFFEFF, 0xFFFFFFFFFFFFFCFC, 0xFFFFFFFFFFFFF8F8,
+        0xFFFFFFFFFFFFF1F1, 0xFFFFFFFFFFFFE1E3, 0xFFFFFFFFFFFFC5C7, 0xFFFFFFFFFFFF8D8F, 0xFFFFFFFFFFFF1D1F,
+        0xFFFFFFFFFFFF3D3F, 0xFFFFFFFFFFFCFCFC, 0x0000000000000000, 0xFFFFFFFFFFF1F1F1, 0xFFFFFFFFFFE3E1E3,
+        0xFFFFFFFFFFC7C5C7, 0xFFFFFFFFFF8F8D8F, 0xFFFFFFFFFF1F1D1F, 0xFFFFFFFFFF3F3D3F, 0x0000000000000000,
+        0x0000000000000000, 0x0000000000000000, 0x00001F1F03030103, 0x000F3F3F0707050F, 0x1F1F7F7F0F0F0D1F,
+        0x3F3FFFFF1F1F1D3F, 0xFFFFFFFF3F3F3DFF, 0x0000000C0C0C0C00, 0x0000000000000000, 0x0000000101010100,
+        0x0000070303030503, 0x000F0F0707070D0F, 0x1F1F1F0F0F0F1D1F, 0x3F3F3F1F1F1F3D3F, 0xFFFFFF3F3F3FFDFF,
+        0x00000C0C0C0E0D00, 0x0000000000050500, 0x00000101010B0D00, 0x0000030303171D03, 0x000F0707072F3D0F,
+        0x1F1F0F0F0F5F7D1F, 0x3F3F1F1F1FBFFD3F, 0xFFFF3F3F3FFFFDFF, 0x000C0C0C0F0F0C00, 0x000000080F0F0000,
+        0x000101010F0F0100, 0x000303031F1F0503, 0x000707073F3F0D0F, 0x1F0F0F0F7F7F1D1F, 0x3F1F1F1FFFFF3D3F,
+        0xFF3F3F3FFFFFFDFF, 0x0C0C1C1F1F1F1D00, 0x0000181F1F1F1D00, 0x0101111F1F1F1D00, 0x0303031F1F1F1D03,
+        0x0707073F3F3F3D0F, 0x0F0F0F7F7F7F7D1F, 0x1F1F1FFFFFFFFD3F, 0x3F3F3FFFFFFFFDFF, 0x0C3C3F3F3F3F3D3F,
+        0x00383F3F3F3F3D3F, 0x01313F3F3F3F3D3F, 0x03233F3F3F3F3D3F, 0x07073F3F3F3F3D3F, 0x0F0F7F7F7F7F7D7F,
+        0x1F1FFFFFFFFFFDFF, 0x3F3FFFFFFFFFFDFF, 0x0000000000070404, 0x0000000000070000, 0x0000000000070101,
+        0xFFFFFFFFFFFFE1E3, 0xFFFFFFFFFFFFC5C7, 0xFFFFFFFFFFFF8D8F, 0xFFFFFFFFFFFF1D1F, 0xFFFFFFFFFFFF3D3F,
+        0x0000000000040400, 0x0000000000000000, 0x0000000000010100, 0x00001F1F1F030103, 0x00001F1F1F070503,
+        0x000F3F3F3F0F0D0F, 0x1F1F7F7F7F1F1D1F, 0x3F3FFFFFFF3F3D3F, 0x0000000000040000, 0x0000000000000000,
+        0x0000000000010000, 0x0000000F03030100, 0x0000071F07070503, 0x000F0F3F0F0F0D0F, 0x1F1F1F7F1F1F1D1F,
+        0x3F3F3FFF3F3F3D3F, 0x0000000004040000, 0x0000000000000000, 0x0000000001010000, 0x0000000303030100,
+        0x0000070707070503, 0x000F0F0F0F0F0D0F, 0x1F1F1F1F1F1F1D1F, 0x3F3F3F3F3F3F3D3F, 0x0000000404050000,
+        0x0000000000020000, 0x0000000101050000, 0x00000003030B0100, 0x0000070707170503, 0x000F0F0F0F2F0D0F,
+        0x1F1F1F1F1F5F1D1F, 0x3F3F3F3F3FBF3D3F, 0x0000040407040000, 0x0000000007000000, 0x0000010107010000,
+        0x000003030F030100, 0x000007071F070503, 0x000F0F0F3F0F0D0F, 0x1F1F1F1F7F1F1D1F, 0x3F3F3F3FFFBF3D3F,
+        0x0004040F0F0F0000, 0x0000000F0F0F0000, 0x0001010F0F0F0000, 0x0003030F0F0F0100, 0x0007071F1F1F0503,
+        0x000F0F3F3F3F0D0F, 0x1F1F1F7F7F7F1D1F, 0x3F3F3FFFFFFF3D3F, 0x04041F1F1F1F1D00, 0x00001F1F1F1F1D00,
+        0x01011F1F1F1F1D00, 0x03031F1F1F1F1D00, 0x07071F1F1F1F1D03, 0x0F0F3F3F3F3F3D0F, 0x1F1F7F7F7F7F7D1F,
+        0x3F3FFFFFFFFFFD3F, 0xFFFFFFFFFFFFF8FC, 0xFFFFFFFFFFFFF8F8, 0xFFFFFFFFFFFFF1F1, 0xFFFFFFFFFFFFE3E3,
+        0xFFFFFFFFFFFFC3C7, 0xFFFFFFFFFFFF8B8F, 0xFFFFFFFFFFFF1B1F, 0xFFFFFFFFFFFF3B3F, 0xFFFFFFFFFFFCF8FC,
+        0xFFFFFFFFFFF8F8F8, 0x0000000000000000, 0xFFFFFFFFFFE3E3E3, 0xFFFFFFFFFFC7C3C7, 0xFFFFFFFFFF8F8B8F,
+        0xFFFFFFFFFF1F1B1F, 0xFFFFFFFFFF3F3B3F, 0x00003F3F3C3C383C, 0x0000000000000000, 0x0000000000000000,
+        0x0000000000000000, 0x00003F3F07070307, 0x001F7F7F0F0F0B1F, 0x3F3FFFFF1F1F1B3F, 0x7F7FFFFF3F3F3B7F,
+        0x00003E3C3C3C3A3C, 0x0000001818181800, 0x0000000000000000, 0x0000000303030300, 0x00000F0707070B07,
+        0x001F1F0F0F0F1B1F, 0x3F3F3F1F1F1F3B3F, 0x7F7F7F3F3F3F7B7F, 0x00003C3C3C3E3B3C, 0x00001818181D1B00,
+        0x00000000000A0A00, 0x0000030303171B00, 0x00000707072F3B07, 0x001F0F0F0F5F7B1F, 0x3F3F1F1F1FBFFB3F,
+        0x7F7F3F3F3F7FFB7F, 0x003C3C3C3F3F3A3C, 0x001818181F1F1800, 0x000000111F1F0000, 0x000303031F1F0300,
+        0x000707073F3F0B07, 0x000F0F0F7F7F1B1F, 0x3F1F1F1FFFFF3B3F, 0x7F3F3F3FFFFF7B7F, 0x3C3C3C3F3F3F3B3C,
+        0x1818383F3F3F3B00, 0x0000313F3F3F3B00, 0x0303233F3F3F3B00, 0x0707073F3F3F3B07, 0x0F0F0F7F7F7F7B1F,
+        0x1F1F1FFFFFFFFB3F, 0x3F3F3FFFFFFFFB7F, 0x3C7C7F7F7F7F7B7F, 0x18787F7F7F7F7B7F, 0x00717F7F7F7F7B7F,
+        0x03637F7F7F7F7B7F, 0x07477F7F7F7F7B7F, 0x0F0F7F7F7F7F7B7F, 0x1F1FFFFFFFFFFBFF, 0x3F3FFFFFFFFFFBFF,
+        0xFFFFFFFFFFFFF8FC, 0x00000000000E0808, 0x00000000000E0000, 0x00000000000E0202, 0xFFFFFFFFFFFFC3C7,
+        0xFFFFFFFFFFFF8B8F, 0xFFFFFFFFFFFF1B1F, 0xFFFFFFFFFFFF3B3F, 0x00003F3F3F3C383C, 0x0000000000080800,
+        0x0000000000000000, 0x0000000000020200, 0x00003F3F3F070307, 0x00003F3F3F0F0B07, 0x001F7F7F7F1F1B1F,
+        0x3F3FFFFFFF3F3B3F, 0x0000001F1C1C1800, 0x0000000000080000, 0x0000000000000000, 0x0000000000020000,
+        0x0000001F07070300, 0x00000F3F0F0F0B07, 0x001F1F7F1F1F1B1F, 0x3F3F3FFF3F3F3B3F, 0x0000001C1C1C1800,
+        0x0000000008080000, 0x0000000000000000, 0x0000000002020000, 0x0000000707070300, 0x00000F0F0F0F0B07,
+        0x001F1F1F1F1F1B1F, 0x3F3F3F3F3F3F3B3F, 0x0000001C1C1D1800, 0x00000008080A0000, 0x0000000000040000,
+        0x00000002020A0000, 0x0000000707170300, 0x00000F0F0F2F0B07, 0x001F1F1F1F5F1B1F, 0x3F3F3F3F3FBF3B3F,
+        0x00001C1C1F1C1800, 0x000008080E080000, 0x000000000E000000, 0x000002020E020000, 0x000007071F070300,
+        0x00000F0F3F0F0B07, 0x001F1F1F7F1F1B1F, 0x3F3F3F3FFF3F3B3F, 0x001C1C1F1F1F1800, 0x0008081F1F1F0000,
+        0x0000001F1F1F0000, 0x0002021F1F1F0000, 0x0007071F1F1F0300, 0x000F0F3F3F3F0B07, 0x001F1F7F7F7F1B1F,
+        0x3F3F3FFFFFFF3B3F, 0x1C1C3F3F3F3F3B00, 0x08083F3F3F3F3B00, 0x00003F3F3F3F3B00, 0x02023F3F3F3F3B00,
+        0x07073F3F3F3F3B00, 0x0F0F3F3F3F3F3B07, 0x1F1F7F7F7F7F7B1F, 0x3F3FFFFFFFFFFB3F, 0xFFFFFFFFFFFFF4FC,
+        0xFFFFFFFFFFFFF0F8, 0xFFFFFFFFFFFFF1F1, 0xFFFFFFFFFFFFE3E3, 0xFFFFFFFFFFFFC7C7, 0xFFFFFFFFFFFF878F,
+        0xFFFFFFFFFFFF171F, 0xFFFFFFFFFFFF373F, 0xFFFFFFFFFFFCF4FC, 0xFFFFFFFFFFF8F0F8, 0xFFFFFFFFFFF1F1F1,
+        0x0000000000000000, 0xFFFFFFFFFFC7C7C7, 0xFFFFFFFFFF8F878F, 0xFFFFFFFFFF1F171F, 0xFFFFFFFFFF3F373F,
+        0x00FEFFFFFCFCF4FE, 0x00007F7F78787078, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+        0x00007F7F0F0F070F, 0x003FFFFF1F1F173F, 0x7F7FFFFF3F3F377F, 0x00FEFEFCFCFCF6FE, 0x00007C7878787478,
+        0x0000003030303000, 0x0000000000000000, 0x0000000606060600, 0x00001F0F0F0F170F, 0x003F3F1F1F1F373F,
+        0x7F7F7F3F3F3F777F, 0x00FEFCFCFCFEF7FE, 0x00007878787D7778, 0x00003030303A3600, 0x0000000000141400,
+        0x00000606062E3600, 0x00000F0F0F5F770F, 0x003F1F1F1FBFF73F, 0x7F7F3F3F3F7FF77F, 0x00FCFCFCFFFFF6FE,
+        0x007878787F7F7478, 0x003030303E3E3000, 0x000000223E3E0000, 0x000606063E3E0600, 0x000F0F0F7F7F170F,
+        0x001F1F1FFFFF373F, 0x7F3F3F3FFFFF777F, 0xFCFCFCFFFFFFF7FE, 0x7878787F7F7F7778, 0x3030717F7F7F7700,
+        0x0000637F7F7F7700, 0x0606477F7F7F7700, 0x0F0F0F7F7F7F770F, 0x1F1F1FFFFFFFF73F, 0x3F3F3FFFFFFFF77F,
+        0xFCFCFFFFFFFFF7FF, 0x78F8FFFFFFFFF7FF, 0x30F1FFFFFFFFF7FF, 0x00E3FFFFFFFFF7FF, 0x06C7FFFFFFFFF7FF,
+        0x0F8FFFFFFFFFF7FF, 0x1F1FFFFFFFFFF7FF, 0x3F3FFFFFFFFFF7FF, 0xFFFFFFFFFFFFF4FC, 0xFFFFFFFFFFFFF0F8,
+        0x00000000001C1010, 0x00000000001C0000, 0x00000000001C0404, 0xFFFFFFFFFFFF878F, 0xFFFFFFFFFFFF171F,
+        0xFFFFFFFFFFFF373F, 0x00007F7F7F7C7478, 0x00007F7F7F787078, 0x0000000000101000, 0x0000000000000000,
+        0x0000000000040400, 0x00007F7F7F0F070F, 0x00007F7F7F1F170F, 0x003FFFFFFF3F373F, 0x00007C7F7C7C7478,
+        0x0000003E38383000, 0x0000000000100000, 0x0000000000000000, 0x0000000000040000, 0x0000003E0E0E0600,
+        0x00001F7F1F1F170F, 0x003F3FFF3F3F373F, 0x00007C7C7C7C7478, 0x0000003838383000, 0x0000000010100000,
+        0x0000000000000000, 0x0000000004040000, 0x0000000E0E0E0600, 0x00001F1F1F1F170F, 0x003F3F3F3F3F373F,
+        0x00007C7C7C7D7478, 0x00000038383A3000, 0x0000001010140000, 0x0000000000080000, 0x0000000404140000,
+        0x0000000E0E2E0600, 0x00001F1F1F5F170F, 0x003F3F3F3FBF373F, 0x00007C7C7F7C7478, 0x000038383E383000,
+        0x000010101C100000, 0x000000001C000000, 0x000004041C040000, 0x00000E0E3E0E0600, 0x00001F1F7F1F170F,
+        0x003F3F3FFF3F373F, 0x007C7C7F7F7F7478, 0x0038383E3E3E3000, 0x0010103E3E3E0000, 0x0000003E3E3E0000,
+        0x0004043E3E3E0000, 0x000E0E3E3E3E0600, 0x001F1F7F7F7F170F, 0x003F3FFFFFFF373F, 0x7C7C7F7F7F7F7778,
+        0x38387F7F7F7F7700, 0x10107F7F7F7F7700, 0x00007F7F7F7F7700, 0x04047F7F7F7F7700, 0x0E0E7F7F7F7F7700,
+        0x1F1F7F7F7F7F770F, 0x3F3FFFFFFFFFF73F};
+};
+
+}  // namespace chess
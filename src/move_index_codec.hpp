@@ -0,0 +1,177 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "board.hpp"
+#include "move.hpp"
+#include "movegen_fwd.hpp"
+#include "movelist.hpp"
+#include "utils.hpp"
+
+namespace chess {
+/**
+ * @brief Stores a game as the index of each move among the legal moves of its position.
+ * The legal moves are sorted by their 16 bit encoding, so the format does not depend on the
+ * order of the move generator. Each index takes as many bits as needed for the number of legal
+ * moves (a forced move takes none), which comes to about 5-6 bits per ply in normal games.
+ *
+ * An encoded game is the number of plies as a varint followed by the bit packed indices,
+ * games can be appended to each other and read back one after another.
+ */
+class MoveIndexCodec {
+   public:
+    /**
+     * @brief Appends the encoded moves to out.
+     * @param board starting position
+     * @param moves
+     * @param count
+     * @param out
+     * @return false if one of the moves is not legal, out is left unchanged then
+     */
+    static bool encode(Board board, const Move* moves, std::size_t count, std::vector<std::uint8_t>& out) {
+        const auto start = out.size();
+
+        utils::writeVarint(count, [&out](std::uint8_t byte) { out.push_back(byte); });
+
+        BitWriter writer{out};
+        Movelist legal;
+
+        for (std::size_t i = 0; i < count; ++i) {
+            legal.clear();
+            movegen::legalmoves(legal, board);
+
+            // the index in sorted order is the number of legal moves with a smaller encoding
+            std::uint32_t index = 0;
+            bool found          = false;
+
+            for (const auto& move : legal) {
+                index += move.move() < moves[i].move();
+                found |= move == moves[i];
+            }
+
+            if (!found) {
+                out.resize(start);
+                return false;
+            }
+
+            writer.write(index, bitWidth(legal.size()));
+            board.makeMove(moves[i]);
+        }
+
+        writer.flush();
+        return true;
+    }
+
+    static bool encode(const Board& board, const std::vector<Move>& moves, std::vector<std::uint8_t>& out) {
+        return encode(board, moves.data(), moves.size(), out);
+    }
+
+    /**
+     * @brief Decodes one game and appends its moves to out.
+     * @param board starting position, the same as given to encode
+     * @param data
+     * @param size
+     * @param out
+     * @return the number of bytes read, 0 if the data is corrupt, out is left unchanged then
+     */
+    static std::size_t decode(Board board, const std::uint8_t* data, std::size_t size, std::vector<Move>& out) {
+        const auto start = out.size();
+
+        std::size_t pos     = 0;
+        std::uint64_t count = 0;
+
+        const auto varint = utils::readVarint(count, [&](std::uint8_t& byte) {
+            if (pos == size) return false;
+            byte = data[pos++];
+            return true;
+        });
+
+        if (!varint) return 0;
+
+        BitReader reader{data + pos, size - pos};
+        Movelist legal;
+
+        for (std::uint64_t i = 0; i < count; ++i) {
+            legal.clear();
+            movegen::legalmoves(legal, board);
+
+            std::uint32_t index = 0;
+
+            if (!reader.read(bitWidth(legal.size()), index) || index >= static_cast<std::uint32_t>(legal.size())) {
+                out.resize(start);
+                return 0;
+            }
+
+            // selecting the index-th smallest move is cheaper than sorting all of them
+            std::nth_element(legal.begin(), legal.begin() + index, legal.end(),
+                             [](const Move& a, const Move& b) { return a.move() < b.move(); });
+
+            out.push_back(legal[index]);
+            board.makeMove(legal[index]);
+        }
+
+        return pos + reader.bytesRead();
+    }
+
+    static std::size_t decode(const Board& board, const std::vector<std::uint8_t>& data, std::vector<Move>& out) {
+        return decode(board, data.data(), data.size(), out);
+    }
+
+   private:
+    // bits needed to store an index below n
+    static int bitWidth(int n) noexcept {
+        int bits = 0;
+        while ((1 << bits) < n) bits++;
+        return bits;
+    }
+
+    // least significant bit first
+    struct BitWriter {
+        std::vector<std::uint8_t>& out;
+        std::uint64_t buffer = 0;
+        int bits             = 0;
+
+        void write(std::uint32_t value, int width) {
+            buffer |= std::uint64_t(value) << bits;
+            bits += width;
+
+            while (bits >= 8) {
+                out.push_back(static_cast<std::uint8_t>(buffer));
+                buffer >>= 8;
+                bits -= 8;
+            }
+        }
+
+        void flush() {
+            if (bits > 0) out.push_back(static_cast<std::uint8_t>(buffer));
+        }
+    };
+
+    struct BitReader {
+        const std::uint8_t* data;
+        std::size_t size;
+        std::size_t pos      = 0;
+        std::uint64_t buffer = 0;
+        int bits             = 0;
+
+        bool read(int width, std::uint32_t& value) {
+            while (bits < width) {
+                if (pos == size) return false;
+                buffer |= std::uint64_t(data[pos++]) << bits;
+                bits += 8;
+            }
+
+            value = static_cast<std::uint32_t>(buffer & ((std::uint64_t(1) << width) - 1));
+            buffer >>= width;
+            bits -= width;
+            return true;
+        }
+
+        // partially used bytes count as read
+        std::size_t bytesRead() const noexcept { return pos; }
+    };
+};
+}  // namespace chess
@@ -7,6 +7,7 @@
 #include "constants.hpp"
 #include "coords.hpp"
 #include "movegen_fwd.hpp"
+#include "stats.hpp"
 
 namespace chess {
 
@@ -105,7 +106,12 @@ template <Color::underlying c>
     auto king_sq          = board.kingSq(~c);
     Bitboard map_king_atk = attacks::king(king_sq) & enemy_empty;
 
-    if (map_king_atk == Bitboard(0ull) && !board.chess960()) return 0ull;
+    detail::countStat(detail::StatCounter::SEEN_SQUARES);
+
+    if (map_king_atk == Bitboard(0ull) && !board.chess960()) {
+        detail::countStat(detail::StatCounter::SEEN_SQUARES_SKIPPED);
+        return 0ull;
+    }
 
     auto occ     = board.occ() ^ Bitboard::fromSquare(king_sq);
     auto queens  = board.pieces(PieceType::QUEEN, c);
@@ -405,6 +411,8 @@ inline void movegen::legalmoves(Movelist& movelist, const Board& board, int piec
      be 0! This is done on purpose since it enables
      you to append new move types to any movelist.
     */
+    detail::countStat(detail::StatCounter::GENERATIONS);
+
     auto king_sq = board.kingSq(c);
 
     Bitboard occ_us  = board.us(c);
@@ -449,7 +457,10 @@ inline void movegen::legalmoves(Movelist& movelist, const Board& board, int piec
     }
 
     // Early return for double check as described earlier
-    if (checks == 2) return;
+    if (checks == 2) {
+        detail::countStat(detail::StatCounter::DOUBLE_CHECK_EXITS);
+        return;
+    }
 
     // Moves have to be on the checkmask
     movable_square &= checkmask;
@@ -511,6 +522,8 @@ inline void movegen::legalmoves(Movelist& movelist, const Board& board, int piec
         legalmoves<Color::WHITE, mt, GenMode::ALL_MOVES>(movelist, board, pieces);
     else
         legalmoves<Color::BLACK, mt, GenMode::ALL_MOVES>(movelist, board, pieces);
+
+    detail::countMovelistSize(movelist.size());
 }
 
 template <movegen::MoveGenType mt>
@@ -705,10 +718,13 @@ template <Color::underlying c>
 }
 
 [[nodiscard]] inline bool movegen::isLegal(const Board& board, const Move move) {
-    if (board.sideToMove() == Color::WHITE)
-        return movegen::isLegal<Color::WHITE>(board, move);
-    else
-        return movegen::isLegal<Color::BLACK>(board, move);
+    const auto legal = board.sideToMove() == Color::WHITE ? movegen::isLegal<Color::WHITE>(board, move)
+                                                          : movegen::isLegal<Color::BLACK>(board, move);
+
+    detail::countStat(detail::StatCounter::IS_LEGAL);
+    if (!legal) detail::countStat(detail::StatCounter::IS_LEGAL_FALSE);
+
+    return legal;
 }
 
 template <Color::underlying c>
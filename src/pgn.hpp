@@ -1,15 +1,382 @@
 #pragma once
 
+#include <algorithm>
 #include <array>
+#include <chrono>
+#include <climits>
+#include <condition_variable>
+#include <cstdint>
+#include <cstring>
 #include <iostream>
 #include <istream>
+#include <iterator>
+#include <mutex>
 #include <optional>
+#include <ostream>
+#include <streambuf>
+#include <string>
 #include <string_view>
+#include <thread>
+#include <vector>
+
+#include "utils.hpp"
+
+#ifdef CHESS_HAS_ZLIB
+#    include <zlib.h>
+#endif
+
+#ifdef CHESS_HAS_ZSTD
+#    include <zstd.h>
+#endif
 
 namespace chess::pgn {
 
+/**
+ * @brief Source of raw PGN bytes for the StreamParser, implement this to feed the parser
+ * from something other than a std::istream.
+ */
+class InputSource {
+   public:
+    virtual ~InputSource() = default;
+
+    /**
+     * @brief Reads up to size bytes into buffer. Returns the number of bytes read,
+     * 0 means the input is exhausted.
+     * @param buffer
+     * @param size
+     * @return
+     */
+    virtual std::size_t read(char* buffer, std::size_t size) = 0;
+
+    /**
+     * @brief True if the input could not be read completely, e.g. corrupt or truncated compressed
+     * data. The StreamParser then returns StreamParserError::SourceError once the input is exhausted.
+     * @return
+     */
+    virtual bool error() const { return false; }
+};
+
+/**
+ * @brief Reads from a std::istream, this is what the StreamParser uses for streams.
+ */
+class IStreamSource : public InputSource {
+   public:
+    explicit IStreamSource(std::istream& stream) : stream_(stream) {}
+
+    std::size_t read(char* buffer, std::size_t size) override {
+        stream_.read(buffer, static_cast<std::streamsize>(size));
+        return static_cast<std::size_t>(stream_.gcount());
+    }
+
+   private:
+    std::istream& stream_;
+};
+
+#ifdef CHESS_HAS_ZLIB
+/**
+ * @brief Decompresses gzip or zlib data read from a std::istream.
+ * Concatenated gzip members are read one after another.
+ * Only available if CHESS_HAS_ZLIB is defined and zlib is linked.
+ */
+class GzipSource : public InputSource {
+   public:
+    explicit GzipSource(std::istream& stream) : stream_(stream) {
+        // 15 window bits + 32 to detect gzip and zlib headers
+        ok_    = inflateInit2(&zs_, 15 + 32) == Z_OK;
+        error_ = !ok_;
+    }
+
+    ~GzipSource() override {
+        if (ok_) inflateEnd(&zs_);
+    }
+
+    GzipSource(const GzipSource&)            = delete;
+    GzipSource& operator=(const GzipSource&) = delete;
+
+    std::size_t read(char* buffer, std::size_t size) override {
+        zs_.next_out  = reinterpret_cast<Bytef*>(buffer);
+        zs_.avail_out = static_cast<uInt>(size);
+
+        while (ok_ && zs_.avail_out > 0) {
+            if (zs_.avail_in == 0) {
+                stream_.read(in_.data(), static_cast<std::streamsize>(in_.size()));
+                zs_.next_in  = reinterpret_cast<Bytef*>(in_.data());
+                zs_.avail_in = static_cast<uInt>(stream_.gcount());
+
+                if (zs_.avail_in == 0) {
+                    // the input ended inside a member, the file is truncated
+                    if (in_member_) {
+                        error_ = true;
+                        ok_    = false;
+                    }
+
+                    break;
+                }
+            }
+
+            in_member_     = true;
+            const auto ret = inflate(&zs_, Z_NO_FLUSH);
+
+            if (ret == Z_STREAM_END) {
+                // another gzip member might follow
+                in_member_ = false;
+                if (inflateReset(&zs_) != Z_OK) ok_ = false;
+            } else if (ret != Z_OK) {
+                error_ = true;
+                ok_    = false;
+            }
+        }
+
+        return size - zs_.avail_out;
+    }
+
+    /**
+     * @brief True if the compressed data was corrupt or truncated.
+     * @return
+     */
+    bool error() const noexcept override { return error_; }
+
+   private:
+    std::istream& stream_;
+    std::array<char, 1 << 16> in_ = {};
+    z_stream zs_                  = {};
+    bool ok_                      = false;
+    bool error_                   = false;
+    bool in_member_               = false;
+};
+#endif
+
+#ifdef CHESS_HAS_ZSTD
+/**
+ * @brief Decompresses zstd data read from a std::istream.
+ * Only available if CHESS_HAS_ZSTD is defined and libzstd is linked.
+ */
+class ZstdSource : public InputSource {
+   public:
+    explicit ZstdSource(std::istream& stream)
+        : stream_(stream), dctx_(ZSTD_createDCtx()), in_data_(ZSTD_DStreamInSize()) {}
+
+    ~ZstdSource() override { ZSTD_freeDCtx(dctx_); }
+
+    ZstdSource(const ZstdSource&)            = delete;
+    ZstdSource& operator=(const ZstdSource&) = delete;
+
+    std::size_t read(char* buffer, std::size_t size) override {
+        ZSTD_outBuffer out = {buffer, size, 0};
+
+        while (dctx_ && !error_ && out.pos < out.size) {
+            if (in_.pos == in_.size) {
+                stream_.read(in_data_.data(), static_cast<std::streamsize>(in_data_.size()));
+                in_ = {in_data_.data(), static_cast<std::size_t>(stream_.gcount()), 0};
+            }
+
+            const auto eof = in_.size == 0;
+            if (eof && pending_ == 0) break;
+
+            const auto before = out.pos;
+            const auto ret    = ZSTD_decompressStream(dctx_, &out, &in_);
+
+            if (ZSTD_isError(ret)) {
+                error_ = true;
+                break;
+            }
+
+            // 0 once a frame is complete and flushed
+            pending_ = ret;
+
+            // without input the decoder can only flush, a frame that makes no progress is truncated
+            if (eof && out.pos == before) {
+                error_ = pending_ != 0;
+                break;
+            }
+        }
+
+        return out.pos;
+    }
+
+    /**
+     * @brief True if the compressed data was corrupt or truncated.
+     * @return
+     */
+    bool error() const noexcept override { return error_; }
+
+   private:
+    std::istream& stream_;
+    ZSTD_DCtx* dctx_;
+    std::vector<char> in_data_;
+    ZSTD_inBuffer in_    = {nullptr, 0, 0};
+    std::size_t pending_ = 0;
+    bool error_          = false;
+};
+#endif
+
+/**
+ * @brief Reads another InputSource ahead on a second thread, so that
+ * decompression and parsing run in parallel.
+ */
+class ThreadedSource : public InputSource {
+   public:
+    explicit ThreadedSource(InputSource& source, std::size_t block_size = 1 << 20) : source_(source) {
+        for (auto& block : blocks_) block.data.resize(block_size);
+
+        worker_ = std::thread([this] { produce(); });
+    }
+
+    ~ThreadedSource() override {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stop_ = true;
+        }
+
+        cv_.notify_all();
+        worker_.join();
+    }
+
+    ThreadedSource(const ThreadedSource&)            = delete;
+    ThreadedSource& operator=(const ThreadedSource&) = delete;
+
+    /**
+     * @brief The error of the wrapped source, known once read() returned all of its data.
+     * @return
+     */
+    bool error() const override {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return error_;
+    }
+
+    std::size_t read(char* buffer, std::size_t size) override {
+        std::size_t total = 0;
+
+        while (total < size) {
+            auto& block = blocks_[read_index_ % blocks_.size()];
+
+            if (!block_ready_) {
+                std::unique_lock<std::mutex> lock(mutex_);
+                cv_.wait(lock, [this] { return filled_ > 0; });
+                block_ready_ = true;
+            }
+
+            // an empty block marks the end of the input
+            if (block.size == 0) break;
+
+            const auto n = std::min(size - total, block.size - block_pos_);
+            std::memcpy(buffer + total, block.data.data() + block_pos_, n);
+
+            total += n;
+            block_pos_ += n;
+
+            if (block_pos_ == block.size) {
+                // hand the block back to the worker
+                {
+                    std::lock_guard<std::mutex> lock(mutex_);
+                    --filled_;
+                }
+
+                cv_.notify_all();
+
+                ++read_index_;
+                block_pos_   = 0;
+                block_ready_ = false;
+            }
+        }
+
+        return total;
+    }
+
+   private:
+    struct Block {
+        std::vector<char> data;
+        std::size_t size = 0;
+    };
+
+    void produce() {
+        for (std::size_t write_index = 0;; ++write_index) {
+            {
+                std::unique_lock<std::mutex> lock(mutex_);
+                cv_.wait(lock, [this] { return stop_ || filled_ < blocks_.size(); });
+                if (stop_) return;
+            }
+
+            auto& block = blocks_[write_index % blocks_.size()];
+            block.size  = 0;
+
+            while (block.size < block.data.size()) {
+                const auto n = source_.read(block.data.data() + block.size, block.data.size() - block.size);
+                if (n == 0) break;
+                block.size += n;
+            }
+
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                ++filled_;
+
+                // only this thread reads the source
+                if (block.size == 0) error_ = source_.error();
+            }
+
+            cv_.notify_all();
+
+            if (block.size == 0) return;
+        }
+    }
+
+    InputSource& source_;
+
+    std::array<Block, 4> blocks_;
+
+    // consumer state, only touched by read()
+    std::size_t read_index_ = 0;
+    std::size_t block_pos_  = 0;
+    bool block_ready_       = false;
+
+    mutable std::mutex mutex_;
+    std::condition_variable cv_;
+    std::size_t filled_ = 0;
+    bool stop_          = false;
+    bool error_         = false;
+
+    std::thread worker_;
+};
+
+/**
+ * @brief Counters of a StreamParser, only collected if CHESS_PGN_STATS is defined.
+ * Otherwise all values stay zero. Moves, comments and headers of skipped games are counted too.
+ */
+struct StreamParserStats {
+    std::uint64_t bytes         = 0;
+    std::uint64_t games         = 0;
+    std::uint64_t moves         = 0;
+    std::uint64_t comments      = 0;
+    std::uint64_t headers       = 0;
+    std::uint64_t skipped_games = 0;
+
+    // time spent waiting for the input source
+    std::chrono::nanoseconds read_time = std::chrono::nanoseconds(0);
+    // time spent inside the visitor callbacks
+    std::chrono::nanoseconds visitor_time = std::chrono::nanoseconds(0);
+};
+
 namespace detail {
 
+/**
+ * @brief Private class, adds its lifetime to total if CHESS_PGN_STATS is defined, otherwise does nothing.
+ */
+class StatsTimer {
+   public:
+#ifdef CHESS_PGN_STATS
+    explicit StatsTimer(std::chrono::nanoseconds& total) noexcept
+        : total_(total), start_(std::chrono::steady_clock::now()) {}
+
+    ~StatsTimer() { total_ += std::chrono::steady_clock::now() - start_; }
+
+   private:
+    std::chrono::nanoseconds& total_;
+    std::chrono::steady_clock::time_point start_;
+#else
+    explicit StatsTimer(std::chrono::nanoseconds&) noexcept {}
+#endif
+};
+
 /**
  * @brief Private class
  */
@@ -53,7 +420,11 @@ class StreamBuffer {
     using BufferType               = std::array<char, N * N>;
 
    public:
-    StreamBuffer(std::istream& stream) : stream_(stream) {}
+    StreamBuffer(std::istream& stream) : stream_source_(stream), source_(*stream_source_) {}
+    StreamBuffer(InputSource& source) : source_(source) {}
+
+    StreamBuffer(const StreamBuffer&)            = delete;
+    StreamBuffer& operator=(const StreamBuffer&) = delete;
 
     // Get the current character, skip carriage returns
     std::optional<char> some() {
@@ -108,10 +479,24 @@ class StreamBuffer {
     }
 
     bool fill() {
+        // the pinned view points into the buffer, which is about to be overwritten
+        if (pinned_view_ && !pinned_view_->empty()) {
+            pinned_spill_->append(*pinned_view_);
+            *pinned_view_ = {};
+        }
+
+        buffer_offset_ += bytes_read_;
         buffer_index_ = 0;
+        bytes_read_   = 0;
 
-        stream_.read(buffer_.data(), N * N);
-        bytes_read_ = stream_.gcount();
+        // a character which was already read by peek()
+        if (has_lookahead_) {
+            buffer_[0]     = lookahead_;
+            bytes_read_    = 1;
+            has_lookahead_ = false;
+        }
+
+        bytes_read_ += readSource(buffer_.data() + bytes_read_, N * N - bytes_read_);
 
         return bytes_read_ > 0;
     }
@@ -126,7 +511,8 @@ class StreamBuffer {
 
     char peek() {
         if (buffer_index_ + 1 >= bytes_read_) {
-            return stream_.peek();
+            if (!has_lookahead_) has_lookahead_ = readSource(&lookahead_, 1) == 1;
+            return has_lookahead_ ? lookahead_ : '\0';
         }
 
         return buffer_[buffer_index_ + 1];
@@ -140,13 +526,96 @@ class StreamBuffer {
         return buffer_[buffer_index_];
     }
 
+    // Returns the characters from the current one up to delim, but at most until the end of the buffer.
+    // If delim was found, found is set and the position moves past delim.
+    // The returned view is only valid until the next fill.
+    std::string_view readUntil(char delim, bool& found) {
+        found = false;
+
+        if (buffer_index_ >= bytes_read_ && !fill()) {
+            return {};
+        }
+
+        const auto begin  = buffer_.data() + buffer_index_;
+        const auto length = bytes_read_ - buffer_index_;
+        const auto end    = static_cast<const char*>(std::memchr(begin, delim, length));
+
+        if (end == nullptr) {
+            buffer_index_ = bytes_read_;
+            return {begin, length};
+        }
+
+        found = true;
+        buffer_index_ += (end - begin) + 1;
+
+        return {begin, static_cast<std::size_t>(end - begin)};
+    }
+
+    // Bytes read from the source and the time it took, only counted with CHESS_PGN_STATS
+    std::uint64_t bytesRead() const noexcept { return source_bytes_; }
+
+    bool sourceError() const { return source_.error(); }
+    std::chrono::nanoseconds readTime() const noexcept { return read_time_; }
+
+    // Before the buffer is refilled, the content of view is appended to spill and view is cleared
+    void pin(std::string_view* view, std::string* spill) noexcept {
+        pinned_view_  = view;
+        pinned_spill_ = spill;
+    }
+
+    // Offset of the current character, counted from where the stream was when we started reading
+    std::uint64_t tell() const noexcept { return buffer_offset_ + buffer_index_; }
+
    private:
-    std::istream& stream_;
+    std::size_t readSource(char* buffer, std::size_t size) {
+        StatsTimer timer(read_time_);
+
+        const auto n = source_.read(buffer, size);
+
+#ifdef CHESS_PGN_STATS
+        source_bytes_ += n;
+#endif
+
+        return n;
+    }
+
+    std::optional<IStreamSource> stream_source_;
+    InputSource& source_;
     BufferType buffer_;
-    std::streamsize bytes_read_   = 0;
-    std::streamsize buffer_index_ = 0;
+    std::uint64_t buffer_offset_ = 0;
+    std::size_t bytes_read_      = 0;
+    std::size_t buffer_index_    = 0;
+
+    char lookahead_     = '\0';
+    bool has_lookahead_ = false;
+
+    std::string_view* pinned_view_ = nullptr;
+    std::string* pinned_spill_     = nullptr;
+
+    std::uint64_t source_bytes_         = 0;
+    std::chrono::nanoseconds read_time_ = std::chrono::nanoseconds(0);
+};
+
+/**
+ * @brief Private class, exposes a memory range as a std::istream.
+ */
+class MemoryStreamBuf : public std::streambuf {
+   public:
+    MemoryStreamBuf(char* data, std::size_t size) { setg(data, data, data + size); }
 };
 
+inline void writeVarint(std::ostream& os, std::uint64_t value) {
+    utils::writeVarint(value, [&os](std::uint8_t byte) { os.put(static_cast<char>(byte)); });
+}
+
+inline bool readVarint(std::istream& is, std::uint64_t& value) {
+    return utils::readVarint(value, [&is](std::uint8_t& byte) {
+        const auto c = is.get();
+        byte         = static_cast<std::uint8_t>(c);
+        return c != std::char_traits<char>::eof();
+    });
+}
+
 }  // namespace detail
 
 /**
@@ -205,7 +674,8 @@ class StreamParserError {
         ExceededMaxStringLength,
         InvalidHeaderMissingClosingBracket,
         InvalidHeaderMissingClosingQuote,
-        NotEnoughData
+        NotEnoughData,
+        SourceError
     };
 
     StreamParserError() : code_(None) {}
@@ -226,6 +696,8 @@ class StreamParserError {
                 return "Invalid header: missing closing quote";
             case NotEnoughData:
                 return "Not enough data";
+            case SourceError:
+                return "Source error: the input is corrupt or truncated";
             default:
                 assert(false);
                 return "Unknown error";
@@ -254,21 +726,69 @@ template <std::size_t BUFFER_SIZE =
           >
 class StreamParser {
    public:
-    StreamParser(std::istream& stream) : stream_buffer(stream) {}
+    StreamParser(std::istream& stream) : stream_buffer(stream) { stream_buffer.pin(&comment_view, &comment); }
+
+    /**
+     * @brief Reads the PGN data from a custom source, e.g. a GzipSource or a ThreadedSource.
+     * @param source
+     */
+    StreamParser(InputSource& source) : stream_buffer(source) { stream_buffer.pin(&comment_view, &comment); }
+
+    StreamParserError readGames(Visitor& vis) { return parse(vis, false); }
+
+    /**
+     * @brief Reads the next game only, repeated calls continue where the last one stopped.
+     * Returns NotEnoughData once there are no more games.
+     * @param vis
+     * @return
+     */
+    StreamParserError readGame(Visitor& vis) { return parse(vis, true); }
+
+    /**
+     * @brief Counters collected while parsing, all zero unless CHESS_PGN_STATS is defined.
+     * @return
+     */
+    StreamParserStats stats() const noexcept {
+        auto stats      = stats_;
+        stats.bytes     = stream_buffer.bytesRead();
+        stats.read_time = stream_buffer.readTime();
+        return stats;
+    }
 
-    StreamParserError readGames(Visitor& vis) {
+    /**
+     * @brief Offset of the character the parser is currently looking at, relative to the
+     * position of the stream when parsing started. Inside Visitor::startPgn this is the
+     * offset of the opening '[' of the game.
+     * @return
+     */
+    std::uint64_t offset() const noexcept { return stream_buffer.tell(); }
+
+   private:
+    StreamParserError parse(Visitor& vis, bool single_game) {
         visitor = &vis;
 
-        if (!stream_buffer.fill()) {
-            return StreamParserError::NotEnoughData;
+        if (!started) {
+            started = true;
+
+            if (!stream_buffer.fill()) {
+                return stream_buffer.sourceError() ? StreamParserError::SourceError : StreamParserError::NotEnoughData;
+            }
         }
 
+        game_ended = false;
+
         while (auto c = stream_buffer.some()) {
             if (in_header) {
                 visitor->skipPgn(false);
 
                 if (*c == '[') {
-                    visitor->startPgn();
+                    count(&StreamParserStats::games);
+
+                    {
+                        detail::StatsTimer timer(stats_.visitor_time);
+                        visitor->startPgn();
+                    }
+
                     pgn_end = false;
 
                     processHeader();
@@ -288,22 +808,34 @@ class StreamParser {
 
             if (!dont_advance_after_body) stream_buffer.advance();
             dont_advance_after_body = false;
+
+            if (single_game && game_ended) {
+                return error;
+            }
         }
 
         if (!pgn_end) {
             onEnd();
         }
 
+        // the games before it were read, but the input ended early
+        if (stream_buffer.sourceError()) {
+            return StreamParserError::SourceError;
+        }
+
+        if (single_game && !game_ended) {
+            return StreamParserError::NotEnoughData;
+        }
+
         return error;
     }
 
-   private:
     void reset_trackers() {
         header.first.clear();
         header.second.clear();
 
         move.clear();
-        comment.clear();
+        clearComment();
 
         in_header = true;
         in_body   = false;
@@ -311,10 +843,15 @@ class StreamParser {
 
     void callVisitorMoveFunction() {
         if (!move.empty()) {
-            if (!visitor->skip()) visitor->move(move.get(), comment);
+            count(&StreamParserStats::moves);
+
+            if (!visitor->skip()) {
+                detail::StatsTimer timer(stats_.visitor_time);
+                visitor->move(move.get(), commentView());
+            }
 
             move.clear();
-            comment.clear();
+            clearComment();
         }
     }
 
@@ -385,7 +922,12 @@ class StreamParser {
                         stream_buffer.advance();
                     }
 
-                    if (!visitor->skip()) visitor->header(header.first.get(), header.second.get());
+                    count(&StreamParserStats::headers);
+
+                    if (!visitor->skip()) {
+                        detail::StatsTimer timer(stats_.visitor_time);
+                        visitor->header(header.first.get(), header.second.get());
+                    }
 
                     header.first.clear();
                     header.second.clear();
@@ -396,7 +938,10 @@ class StreamParser {
                     in_header = false;
                     in_body   = true;
 
-                    if (!visitor->skip()) visitor->startMoves();
+                    if (!visitor->skip()) {
+                        detail::StatsTimer timer(stats_.visitor_time);
+                        visitor->startMoves();
+                    }
 
                     return;
                 default:
@@ -405,7 +950,10 @@ class StreamParser {
                     in_header = false;
                     in_body   = true;
 
-                    if (!visitor->skip()) visitor->startMoves();
+                    if (!visitor->skip()) {
+                        detail::StatsTimer timer(stats_.visitor_time);
+                        visitor->startMoves();
+                    }
 
                     return;
             }
@@ -435,23 +983,15 @@ class StreamParser {
 
                 // reading comment
                 stream_buffer.advance();
-
-                while (auto k = stream_buffer.some()) {
-                    stream_buffer.advance();
-
-                    if (*k == '}') {
-                        break;
-                    }
-
-                    comment += *k;
-                }
+                readComment();
 
                 // the game has no moves, but a comment followed by a game termination
                 if (!visitor->skip()) {
-                    visitor->move("", comment);
+                    detail::StatsTimer timer(stats_.visitor_time);
+                    visitor->move("", commentView());
 
                     has_comment = false;
-                    comment.clear();
+                    clearComment();
                 }
             } else {
                 break;
@@ -634,16 +1174,7 @@ class StreamParser {
                 case '{': {
                     // reading comment
                     stream_buffer.advance();
-
-                    while (auto c = stream_buffer.some()) {
-                        stream_buffer.advance();
-
-                        if (*c == '}') {
-                            break;
-                        }
-
-                        comment += *c;
-                    }
+                    readComment();
 
                     break;
                 }
@@ -680,14 +1211,80 @@ class StreamParser {
         }
     }
 
+    // Reads a comment up to and including the closing '}'. The comment stays a view into the
+    // read buffer, it is only copied into comment if it straddles a refill, contains a '\r'
+    // or a move has more than one comment.
+    void readComment() {
+        count(&StreamParserStats::comments);
+
+        bool found = false;
+
+        while (!found) {
+            const auto chunk = stream_buffer.readUntil('}', found);
+
+            if (chunk.empty()) {
+                // end of the input or an empty comment
+                if (!found) return;
+                continue;
+            }
+
+            const bool has_cr = std::memchr(chunk.data(), '\r', chunk.size()) != nullptr;
+
+            if (comment.empty() && comment_view.empty() && !has_cr) {
+                comment_view = chunk;
+                continue;
+            }
+
+            comment.append(comment_view);
+            comment_view = {};
+
+            if (!has_cr) {
+                comment.append(chunk);
+                continue;
+            }
+
+            for (const auto c : chunk) {
+                if (c != '\r') comment += c;
+            }
+        }
+    }
+
+    std::string_view commentView() {
+        if (comment.empty()) return comment_view;
+
+        comment.append(comment_view);
+        comment_view = {};
+
+        return comment;
+    }
+
+    void count([[maybe_unused]] std::uint64_t StreamParserStats::*counter) noexcept {
+#ifdef CHESS_PGN_STATS
+        ++(stats_.*counter);
+#endif
+    }
+
+    void clearComment() noexcept {
+        comment.clear();
+        comment_view = {};
+    }
+
     void onEnd() {
         callVisitorMoveFunction();
-        visitor->endPgn();
+
+        if (visitor->skip()) count(&StreamParserStats::skipped_games);
+
+        {
+            detail::StatsTimer timer(stats_.visitor_time);
+            visitor->endPgn();
+        }
+
         visitor->skipPgn(false);
 
         reset_trackers();
 
-        pgn_end = true;
+        pgn_end    = true;
+        game_ended = true;
     }
 
     bool is_space(const char c) noexcept {
@@ -728,7 +1325,10 @@ class StreamParser {
     std::pair<detail::StringBuffer, detail::StringBuffer> header = {detail::StringBuffer{}, detail::StringBuffer{}};
 
     detail::StringBuffer move = {};
-    std::string comment       = {};
+
+    // comment_view points into the read buffer, comment is only used if that is not possible
+    std::string comment           = {};
+    std::string_view comment_view = {};
 
     // State
 
@@ -739,6 +1339,576 @@ class StreamParser {
 
     bool pgn_end = true;
 
+    StreamParserStats stats_;
+
+    // state for reading one game at a time
+    bool started    = false;
+    bool game_ended = false;
+
     bool dont_advance_after_body = false;
 };
+
+/**
+ * @brief Evaluation, depth and time of an engine comment like "+0.31/18 0.52s" or "-M4/22 1.1s",
+ * as written by cutechess, fastchess and fishtest.
+ */
+struct EngineComment {
+    // centipawns from the view of the side which made the move, or moves to mate if mate is set
+    int score = 0;
+    bool mate = false;
+    int depth = 0;
+    // milliseconds, -1 if the comment has no time
+    int time_ms = -1;
+};
+
+/**
+ * @brief Parses an engine comment like "+0.31/18 0.52s", "-M4/22 1.1s" or "+1.20/15".
+ * Anything after the time is ignored, e.g. ", White wins by adjudication".
+ * Other comments, like "book", and numbers too large for an int return std::nullopt.
+ * @param comment
+ * @return
+ */
+inline std::optional<EngineComment> parseEngineComment(std::string_view comment) noexcept {
+    EngineComment info;
+
+    std::size_t i    = 0;
+    const auto n     = comment.size();
+    const auto digit = [&](std::size_t idx) { return idx < n && comment[idx] >= '0' && comment[idx] <= '9'; };
+
+    // reads a number, false if it doesn't fit into value / scale
+    const auto number = [&](int& value, int scale) {
+        value = 0;
+
+        while (digit(i)) {
+            const int d = comment[i++] - '0';
+            if (value > (INT_MAX / scale - d) / 10) return false;
+            value = value * 10 + d;
+        }
+
+        return true;
+    };
+
+    bool negative = false;
+    if (i < n && (comment[i] == '+' || comment[i] == '-')) negative = comment[i++] == '-';
+
+    if (i < n && comment[i] == 'M') {
+        info.mate = true;
+        ++i;
+    }
+
+    if (!digit(i)) return std::nullopt;
+
+    // the fraction adds up to 99 centipawns
+    int whole = 0;
+    if (!number(whole, info.mate ? 1 : 101)) return std::nullopt;
+
+    if (info.mate) {
+        info.score = whole;
+    } else {
+        // up to two decimals, "+1.5" is 150 centipawns
+        int fraction = 0;
+        int digits   = 0;
+
+        if (i < n && comment[i] == '.') {
+            ++i;
+            while (digit(i)) {
+                if (digits < 2) {
+                    fraction = fraction * 10 + (comment[i] - '0');
+                    ++digits;
+                }
+
+                ++i;
+            }
+        }
+
+        while (digits++ < 2) fraction *= 10;
+
+        info.score = whole * 100 + fraction;
+    }
+
+    if (negative) info.score = -info.score;
+
+    if (i >= n || comment[i] != '/' || !digit(++i)) return std::nullopt;
+
+    if (!number(info.depth, 1)) return std::nullopt;
+
+    if (i >= n || comment[i] != ' ' || !digit(i + 1)) return info;
+
+    ++i;
+
+    // time in seconds with up to three decimals, e.g. "0.52s"
+    int seconds = 0;
+    int millis  = 0;
+    int digits  = 0;
+
+    if (!number(seconds, 1001)) return std::nullopt;
+
+    if (i < n && comment[i] == '.') {
+        ++i;
+        while (digit(i)) {
+            if (digits < 3) {
+                millis = millis * 10 + (comment[i] - '0');
+                ++digits;
+            }
+
+            ++i;
+        }
+    }
+
+    while (digits++ < 3) millis *= 10;
+
+    if (i < n && comment[i] == 's') info.time_ms = seconds * 1000 + millis;
+
+    return info;
+}
+
+/**
+ * @brief A single game read by pgn::games(). All strings point into buffers owned by the game,
+ * which are reused for the next game, so the views are only valid until the iterator advances.
+ */
+class Game {
+   public:
+    struct Header {
+        std::string_view key;
+        std::string_view value;
+    };
+
+    struct MoveEntry {
+        std::string_view move;
+        std::string_view comment;
+    };
+
+    /**
+     * @brief Headers in the order they appear in the PGN.
+     * @return
+     */
+    const std::vector<Header>& headers() const noexcept { return headers_; }
+
+    /**
+     * @brief Moves in SAN as written in the PGN, with the comment following each move.
+     * @return
+     */
+    const std::vector<MoveEntry>& moves() const noexcept { return moves_; }
+
+    /**
+     * @brief Value of the first header with the given key.
+     * @param key
+     * @return
+     */
+    std::optional<std::string_view> header(std::string_view key) const {
+        for (const auto& h : headers_) {
+            if (h.key == key) return h.value;
+        }
+
+        return std::nullopt;
+    }
+
+   private:
+    friend class GameReader;
+
+    struct Span {
+        std::uint32_t offset;
+        std::uint32_t length;
+    };
+
+    void clear() noexcept {
+        data_.clear();
+        header_spans_.clear();
+        move_spans_.clear();
+        headers_.clear();
+        moves_.clear();
+    }
+
+    Span append(std::string_view str) {
+        const auto offset = static_cast<std::uint32_t>(data_.size());
+        data_.append(str);
+        return {offset, static_cast<std::uint32_t>(str.size())};
+    }
+
+    void addHeader(std::string_view key, std::string_view value) {
+        header_spans_.push_back({append(key), append(value)});
+    }
+
+    void addMove(std::string_view move, std::string_view comment) {
+        move_spans_.push_back({append(move), append(comment)});
+    }
+
+    // data_ might have been reallocated while the game was read,
+    // so the views are only created once the game is complete
+    void finish() {
+        const auto view = [this](Span span) { return std::string_view(data_).substr(span.offset, span.length); };
+
+        for (const auto& [key, value] : header_spans_) headers_.push_back({view(key), view(value)});
+        for (const auto& [move, comment] : move_spans_) moves_.push_back({view(move), view(comment)});
+    }
+
+    std::string data_;
+    std::vector<std::pair<Span, Span>> header_spans_;
+    std::vector<std::pair<Span, Span>> move_spans_;
+
+    std::vector<Header> headers_;
+    std::vector<MoveEntry> moves_;
+};
+
+/**
+ * @brief Reads the games of a PGN one at a time, use pgn::games() to create one.
+ */
+class GameReader {
+   public:
+    class iterator {
+       public:
+        using iterator_category = std::input_iterator_tag;
+        using value_type        = Game;
+        using difference_type   = std::ptrdiff_t;
+        using pointer           = Game*;
+        using reference         = Game&;
+
+        iterator() = default;
+        explicit iterator(GameReader* reader) : reader_(reader) {}
+
+        Game& operator*() const { return reader_->game_; }
+        Game* operator->() const { return &reader_->game_; }
+
+        iterator& operator++() {
+            if (!reader_->next()) reader_ = nullptr;
+            return *this;
+        }
+
+        bool operator==(const iterator& other) const { return reader_ == other.reader_; }
+        bool operator!=(const iterator& other) const { return reader_ != other.reader_; }
+
+       private:
+        GameReader* reader_ = nullptr;
+    };
+
+    explicit GameReader(std::istream& stream) : parser_(stream) {}
+    explicit GameReader(InputSource& source) : parser_(source) {}
+
+    /**
+     * @brief Reads the first game, may only be called once.
+     * @return
+     */
+    iterator begin() { return next() ? iterator(this) : iterator(); }
+    iterator end() { return iterator(); }
+
+    /**
+     * @brief Reads the next game into game(), returns false at the end of the input or on an error.
+     * @return
+     */
+    bool next() {
+        const auto err = parser_.readGame(visitor_);
+
+        if (err == StreamParserError::NotEnoughData) return false;
+
+        error_ = err;
+        return !err;
+    }
+
+    const Game& game() const noexcept { return game_; }
+
+    /**
+     * @brief The error which stopped the iteration, None if all games were read.
+     * @return
+     */
+    StreamParserError error() const noexcept { return error_; }
+
+   private:
+    class GameVisitor : public Visitor {
+       public:
+        explicit GameVisitor(Game& game) : game_(game) {}
+
+        void startPgn() override { game_.clear(); }
+        void header(std::string_view key, std::string_view value) override { game_.addHeader(key, value); }
+        void startMoves() override {}
+        void move(std::string_view move, std::string_view comment) override { game_.addMove(move, comment); }
+        void endPgn() override { game_.finish(); }
+
+       private:
+        Game& game_;
+    };
+
+    StreamParser<> parser_;
+    Game game_;
+    GameVisitor visitor_{game_};
+    StreamParserError error_;
+};
+
+/**
+ * @brief Pull based alternative to StreamParser::readGames.
+ *
+ * @code
+ * for (const auto& game : pgn::games(stream)) {
+ *     auto white = game.header("White");
+ *     for (const auto& [move, comment] : game.moves()) { ... }
+ * }
+ * @endcode
+ * @param stream
+ * @return
+ */
+inline GameReader games(std::istream& stream) { return GameReader(stream); }
+inline GameReader games(InputSource& source) { return GameReader(source); }
+
+/**
+ * @brief Index of the games in a PGN file, allows to read a single game or a range of games
+ * without parsing the games before them. Each entry stores the byte offset and length of a game
+ * and the values of the header keys passed to the constructor.
+ * The offsets are the ones seen by StreamParser::readGames, a game starts at its first '['
+ * and ends right before the first '[' of the next game.
+ */
+class GameIndex {
+   public:
+    struct Entry {
+        std::uint64_t offset = 0;
+        std::uint64_t length = 0;
+
+        // values of GameIndex::keys(), empty if the game does not have the header
+        std::vector<std::string> headers;
+    };
+
+    explicit GameIndex(std::vector<std::string> keys = {}) : keys_(std::move(keys)) {}
+
+    /**
+     * @brief Scans the whole stream and records every game. Offsets are relative to the
+     * beginning of the stream, not to its current position.
+     * @param stream
+     * @return
+     */
+    StreamParserError build(std::istream& stream) {
+        entries_.clear();
+
+        const auto start = stream.tellg();
+        const auto base  = start == std::istream::pos_type(-1) ? 0 : static_cast<std::uint64_t>(start);
+
+        StreamParser<> parser(stream);
+        IndexVisitor vis(*this, parser, base);
+
+        const auto error = parser.readGames(vis);
+
+        // the last game ends with the stream
+        if (!entries_.empty()) {
+            entries_.back().length = base + parser.offset() - entries_.back().offset;
+        }
+
+        return error;
+    }
+
+    /**
+     * @brief Parses a single game of the indexed stream, the stream has to be seekable.
+     * Returns StreamParserError::NotEnoughData if the game is not part of the index.
+     * @param stream
+     * @param game
+     * @param vis
+     * @return
+     */
+    StreamParserError readGame(std::istream& stream, std::size_t game, Visitor& vis) const {
+        return readGames(stream, game, 1, vis);
+    }
+
+    /**
+     * @brief Parses the games [first, first + count) of the indexed stream, the stream has to be seekable.
+     * Returns StreamParserError::NotEnoughData if the range is not part of the index.
+     * @param stream
+     * @param first
+     * @param count
+     * @param vis
+     * @return
+     */
+    StreamParserError readGames(std::istream& stream, std::size_t first, std::size_t count, Visitor& vis) const {
+        if (count == 0 || first >= entries_.size() || count > entries_.size() - first) {
+            return StreamParserError::NotEnoughData;
+        }
+
+        const auto& front = entries_[first];
+        const auto& back  = entries_[first + count - 1];
+        const auto length = back.offset + back.length - front.offset;
+
+        std::string buffer(length, '\0');
+
+        stream.clear();
+        stream.seekg(static_cast<std::streamoff>(front.offset));
+        stream.read(buffer.data(), static_cast<std::streamsize>(length));
+        buffer.resize(static_cast<std::size_t>(stream.gcount()));
+
+        detail::MemoryStreamBuf buf(buffer.data(), buffer.size());
+        std::istream game_stream(&buf);
+
+        StreamParser<> parser(game_stream);
+        return parser.readGames(vis);
+    }
+
+    /**
+     * @brief Writes the index in a compact binary format.
+     * @param os
+     * @return
+     */
+    bool save(std::ostream& os) const {
+        os.write(MAGIC, sizeof(MAGIC));
+        detail::writeVarint(os, VERSION);
+
+        detail::writeVarint(os, keys_.size());
+        for (const auto& key : keys_) writeString(os, key);
+
+        detail::writeVarint(os, entries_.size());
+
+        std::uint64_t prev_offset = 0;
+
+        for (const auto& entry : entries_) {
+            // offsets are increasing, store the difference to the previous one
+            detail::writeVarint(os, entry.offset - prev_offset);
+            detail::writeVarint(os, entry.length);
+
+            for (const auto& value : entry.headers) writeString(os, value);
+
+            prev_offset = entry.offset;
+        }
+
+        return static_cast<bool>(os);
+    }
+
+    /**
+     * @brief Reads an index written by save(), returns false if the data is not a valid index.
+     * @param is
+     * @return
+     */
+    bool load(std::istream& is) {
+        keys_.clear();
+        entries_.clear();
+
+        char magic[sizeof(MAGIC)] = {};
+        is.read(magic, sizeof(MAGIC));
+        if (!is || std::string_view(magic, sizeof(MAGIC)) != std::string_view(MAGIC, sizeof(MAGIC))) return false;
+
+        std::uint64_t version = 0, key_count = 0, game_count = 0;
+
+        if (!detail::readVarint(is, version) || version != VERSION) return false;
+        if (!detail::readVarint(is, key_count)) return false;
+
+        // counts and sizes are not trusted, storage only grows with the data actually read
+        for (std::uint64_t i = 0; i < key_count; i++) {
+            std::string key;
+            if (!readString(is, key)) return false;
+            keys_.push_back(std::move(key));
+        }
+
+        if (!detail::readVarint(is, game_count)) return false;
+
+        std::uint64_t prev_offset = 0;
+
+        for (std::uint64_t i = 0; i < game_count; i++) {
+            Entry entry;
+            std::uint64_t delta = 0;
+
+            if (!detail::readVarint(is, delta) || !detail::readVarint(is, entry.length)) return false;
+
+            entry.offset = prev_offset + delta;
+            entry.headers.resize(keys_.size());
+
+            for (auto& value : entry.headers) {
+                if (!readString(is, value)) return false;
+            }
+
+            prev_offset = entry.offset;
+            entries_.push_back(std::move(entry));
+        }
+
+        return true;
+    }
+
+    /**
+     * @brief Returns the value of an indexed header of a game, std::nullopt if the key was not indexed
+     * or the game is out of range.
+     * @param game
+     * @param key
+     * @return
+     */
+    std::optional<std::string_view> header(std::size_t game, std::string_view key) const {
+        if (game >= entries_.size()) return std::nullopt;
+
+        for (std::size_t i = 0; i < keys_.size(); i++) {
+            if (keys_[i] == key) return std::string_view(entries_[game].headers[i]);
+        }
+
+        return std::nullopt;
+    }
+
+    const std::vector<std::string>& keys() const noexcept { return keys_; }
+    const std::vector<Entry>& entries() const noexcept { return entries_; }
+
+    const Entry& operator[](std::size_t game) const noexcept { return entries_[game]; }
+
+    std::size_t size() const noexcept { return entries_.size(); }
+    bool empty() const noexcept { return entries_.empty(); }
+
+   private:
+    class IndexVisitor : public Visitor {
+       public:
+        IndexVisitor(GameIndex& index, const StreamParser<>& parser, std::uint64_t base)
+            : index_(index), parser_(parser), base_(base) {}
+
+        void startPgn() override {
+            auto& entries     = index_.entries_;
+            const auto offset = base_ + parser_.offset();
+
+            if (!entries.empty()) entries.back().length = offset - entries.back().offset;
+
+            Entry entry;
+            entry.offset = offset;
+            entry.headers.resize(index_.keys_.size());
+            entries.push_back(std::move(entry));
+        }
+
+        void header(std::string_view key, std::string_view value) override {
+            const auto& keys = index_.keys_;
+
+            for (std::size_t i = 0; i < keys.size(); i++) {
+                if (keys[i] == key) index_.entries_.back().headers[i] = std::string(value);
+            }
+        }
+
+        void startMoves() override {}
+
+        void move(std::string_view, std::string_view) override {}
+
+        void endPgn() override {}
+
+       private:
+        GameIndex& index_;
+        const StreamParser<>& parser_;
+        std::uint64_t base_;
+    };
+
+    static void writeString(std::ostream& os, const std::string& str) {
+        detail::writeVarint(os, str.size());
+        os.write(str.data(), static_cast<std::streamsize>(str.size()));
+    }
+
+    static bool readString(std::istream& is, std::string& str) {
+        std::uint64_t size = 0;
+        if (!detail::readVarint(is, size)) return false;
+
+        // read in chunks, a corrupt size fails at the end of the stream instead of allocating it
+        constexpr std::uint64_t CHUNK = 1 << 16;
+
+        str.clear();
+
+        while (size > 0) {
+            const auto chunk = std::min(size, CHUNK);
+            const auto old   = str.size();
+
+            str.resize(old + chunk);
+            if (!is.read(str.data() + old, static_cast<std::streamsize>(chunk))) return false;
+
+            size -= chunk;
+        }
+
+        return true;
+    }
+
+    static constexpr char MAGIC[4]         = {'P', 'G', 'N', 'I'};
+    static constexpr std::uint64_t VERSION = 1;
+
+    std::vector<std::string> keys_;
+    std::vector<Entry> entries_;
+};
+
 }  // namespace chess::pgn
@@ -0,0 +1,337 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "board.hpp"
+#include "constants.hpp"
+#include "move.hpp"
+#include "movegen.hpp"
+#include "movelist.hpp"
+
+namespace chess {
+
+/**
+ * @brief xorshift64*, cheap enough to draw a number every ply. Each playout thread owns one,
+ * it is reseeded for every game.
+ */
+class PlayoutRng {
+   public:
+    explicit PlayoutRng(std::uint64_t seed = 1) noexcept { this->seed(seed); }
+
+    /**
+     * @brief Restarts the sequence, any seed (also 0) is mixed with splitmix64 first.
+     * @param seed
+     */
+    void seed(std::uint64_t seed) noexcept {
+        seed += 0x9E3779B97F4A7C15ull;
+        seed = (seed ^ (seed >> 30)) * 0xBF58476D1CE4E5B9ull;
+        seed = (seed ^ (seed >> 27)) * 0x94D049BB133111EBull;
+
+        state_ = (seed ^ (seed >> 31)) | 1;
+    }
+
+    [[nodiscard]] std::uint64_t next() noexcept {
+        state_ ^= state_ >> 12;
+        state_ ^= state_ << 25;
+        state_ ^= state_ >> 27;
+        return state_ * 0x2545F4914F6CDD1Dull;
+    }
+
+    /**
+     * @brief Uniform number in [0, n) without a division.
+     * @param n
+     * @return
+     */
+    [[nodiscard]] std::uint32_t below(std::uint32_t n) noexcept {
+        return static_cast<std::uint32_t>(((next() >> 32) * n) >> 32);
+    }
+
+   private:
+    std::uint64_t state_ = 1;
+};
+
+/**
+ * @brief The default move selection of playout::run, a uniformly random legal move.
+ */
+struct RandomSelector {
+    Move operator()(const Board&, const Movelist& moves, PlayoutRng& rng) const noexcept {
+        return moves[static_cast<int>(rng.below(static_cast<std::uint32_t>(moves.size())))];
+    }
+};
+
+/**
+ * @brief A game played by playout::run.
+ */
+struct PlayoutGame {
+    // number of the game in [0, games), games finish in any order
+    std::uint64_t index = 0;
+    std::vector<Move> moves;
+    // the position before each move, only filled if PlayoutOptions::record_positions is set
+    std::vector<PackedBoard> positions;
+    // NONE if the game was stopped by max_plies or the selector
+    GameResultReason reason = GameResultReason::NONE;
+    // seen from the side to move in the final position, like Board::isGameOver
+    GameResult result = GameResult::NONE;
+};
+
+struct PlayoutOptions {
+    std::string fen     = constants::STARTPOS;
+    bool chess960       = false;
+    std::uint64_t games = 1;
+    // worker threads, 0 uses std::thread::hardware_concurrency()
+    int threads = 1;
+    // game i is played with the seed (seed + i), so the games don't depend on the number of threads
+    std::uint64_t seed = 1;
+    // 0 plays until the game is over
+    int max_plies         = 0;
+    bool record_positions = false;
+    // finished games waiting for the consumer, rounded up to a power of two
+    std::size_t queue_size = 1024;
+};
+
+namespace detail {
+
+/**
+ * @brief Private class, bounded lock-free multi producer multi consumer queue (Vyukov).
+ * Values are swapped in and out of the cells, so that their buffers are reused.
+ */
+template <typename T>
+class PlayoutQueue {
+   public:
+    explicit PlayoutQueue(std::size_t capacity) {
+        std::size_t size = 2;
+        while (size < capacity) size *= 2;
+
+        cells_ = std::make_unique<Cell[]>(size);
+        mask_  = size - 1;
+
+        for (std::size_t i = 0; i < size; ++i) cells_[i].sequence.store(i, std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Moves value into the queue and leaves an old value in its place.
+     * @param value
+     * @return false if the queue is full
+     */
+    bool tryPush(T& value) noexcept {
+        auto pos = tail_.load(std::memory_order_relaxed);
+        Cell* cell;
+
+        while (true) {
+            cell            = &cells_[pos & mask_];
+            const auto seq  = cell->sequence.load(std::memory_order_acquire);
+            const auto diff = static_cast<std::intptr_t>(seq) - static_cast<std::intptr_t>(pos);
+
+            if (diff == 0) {
+                if (tail_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) break;
+            } else if (diff < 0) {
+                return false;
+            } else {
+                pos = tail_.load(std::memory_order_relaxed);
+            }
+        }
+
+        std::swap(cell->value, value);
+        cell->sequence.store(pos + 1, std::memory_order_release);
+
+        return true;
+    }
+
+    /**
+     * @brief Takes the oldest value out of the queue.
+     * @param value
+     * @return false if the queue is empty
+     */
+    bool tryPop(T& value) noexcept {
+        auto pos = head_.load(std::memory_order_relaxed);
+        Cell* cell;
+
+        while (true) {
+            cell            = &cells_[pos & mask_];
+            const auto seq  = cell->sequence.load(std::memory_order_acquire);
+            const auto diff = static_cast<std::intptr_t>(seq) - static_cast<std::intptr_t>(pos + 1);
+
+            if (diff == 0) {
+                if (head_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) break;
+            } else if (diff < 0) {
+                return false;
+            } else {
+                pos = head_.load(std::memory_order_relaxed);
+            }
+        }
+
+        std::swap(cell->value, value);
+        cell->sequence.store(pos + mask_ + 1, std::memory_order_release);
+
+        return true;
+    }
+
+   private:
+    struct Cell {
+        std::atomic<std::size_t> sequence;
+        T value;
+    };
+
+    std::unique_ptr<Cell[]> cells_;
+    std::size_t mask_ = 0;
+
+    // producers and the consumer shouldn't share a cache line
+    alignas(64) std::atomic<std::size_t> tail_ = 0;
+    alignas(64) std::atomic<std::size_t> head_ = 0;
+};
+
+}  // namespace detail
+
+class playout {
+   public:
+    /**
+     * @brief Same result as board.isGameOver(), but reuses the legal moves of the position that a
+     * playout generates anyway, instead of calling anylegalmoves, and only looks for a repetition
+     * once 8 plies were played since the last capture or pawn move.
+     * @param board
+     * @param moves all legal moves of board
+     * @return
+     */
+    [[nodiscard]] static std::pair<GameResultReason, GameResult> gameOver(const Board& board,
+                                                                          const Movelist& moves) noexcept {
+        const auto hfm = board.halfMoveClock();
+
+        if (hfm >= 100) {
+            if (moves.empty() && board.inCheck()) return {GameResultReason::CHECKMATE, GameResult::LOSE};
+            return {GameResultReason::FIFTY_MOVE_RULE, GameResult::DRAW};
+        }
+
+        if (board.isInsufficientMaterial()) return {GameResultReason::INSUFFICIENT_MATERIAL, GameResult::DRAW};
+
+        // the same position comes back 4 plies later at the earliest, 8 plies for a threefold repetition
+        if (hfm >= 8 && board.isRepetition()) return {GameResultReason::THREEFOLD_REPETITION, GameResult::DRAW};
+
+        if (moves.empty()) {
+            if (board.inCheck()) return {GameResultReason::CHECKMATE, GameResult::LOSE};
+            return {GameResultReason::STALEMATE, GameResult::DRAW};
+        }
+
+        return {GameResultReason::NONE, GameResult::NONE};
+    }
+
+    /**
+     * @brief Plays one game into game, the previous content is cleared.
+     * select is called as select(board, legal_moves, rng) and returns the move to play,
+     * NO_MOVE stops the game.
+     * @param start
+     * @param select
+     * @param rng
+     * @param game
+     * @param options
+     */
+    template <typename Select>
+    static void play(const Board& start, Select& select, PlayoutRng& rng, PlayoutGame& game,
+                     const PlayoutOptions& options) {
+        Board board = start;
+        Movelist moves;
+
+        game.moves.clear();
+        game.positions.clear();
+        game.reason = GameResultReason::NONE;
+        game.result = GameResult::NONE;
+
+        while (true) {
+            movegen::legalmoves(moves, board);
+
+            const auto [reason, result] = gameOver(board, moves);
+
+            if (reason != GameResultReason::NONE) {
+                game.reason = reason;
+                game.result = result;
+                return;
+            }
+
+            if (options.max_plies > 0 && static_cast<int>(game.moves.size()) >= options.max_plies) return;
+
+            const Move move = select(board, moves, rng);
+            if (move == Move::NO_MOVE) return;
+
+            if (options.record_positions) game.positions.push_back(Board::Compact::encode(board));
+            game.moves.push_back(move);
+
+            board.makeMove<true>(move);
+        }
+    }
+
+    /**
+     * @brief Plays options.games games on options.threads worker threads, every thread with its
+     * own Board, rng and copy of select. Finished games go through a lock-free queue to the
+     * calling thread, which calls consume(PlayoutGame&) for each of them. consume may move
+     * out of the game. If consume throws, the workers are stopped and the exception is passed on.
+     * @param options
+     * @param consume
+     * @param select see play(), must not throw
+     */
+    template <typename Consume, typename Select = RandomSelector>
+    static void run(const PlayoutOptions& options, Consume&& consume, const Select& select = Select()) {
+        if (options.games == 0) return;
+
+        const auto start = Board(options.fen, options.chess960);
+
+        auto threads = options.threads > 0 ? options.threads : static_cast<int>(std::thread::hardware_concurrency());
+        if (threads <= 0) threads = 1;
+
+        detail::PlayoutQueue<PlayoutGame> queue(options.queue_size);
+        std::atomic<std::uint64_t> next_game = 0;
+        std::atomic<bool> stop               = false;
+
+        auto worker = [&]() {
+            auto thread_select = select;
+            PlayoutRng rng;
+            PlayoutGame game;
+
+            while (!stop.load(std::memory_order_relaxed)) {
+                const auto index = next_game.fetch_add(1, std::memory_order_relaxed);
+                if (index >= options.games) return;
+
+                rng.seed(options.seed + index);
+                play(start, thread_select, rng, game, options);
+                game.index = index;
+
+                while (!queue.tryPush(game)) {
+                    if (stop.load(std::memory_order_relaxed)) return;
+                    std::this_thread::yield();
+                }
+            }
+        };
+
+        // joins the workers also when consume throws
+        struct Workers {
+            std::vector<std::thread> threads;
+            std::atomic<bool>& stop;
+
+            ~Workers() {
+                stop = true;
+                for (auto& thread : threads) thread.join();
+            }
+        } workers{{}, stop};
+
+        for (int i = 0; i < threads; ++i) workers.threads.emplace_back(worker);
+
+        PlayoutGame game;
+
+        for (std::uint64_t received = 0; received < options.games;) {
+            if (!queue.tryPop(game)) {
+                std::this_thread::yield();
+                continue;
+            }
+
+            received++;
+            consume(game);
+        }
+    }
+};
+
+}  // namespace chess
@@ -0,0 +1,202 @@
+#pragma once
+
+#include <array>
+#include <bitset>
+#include <cstddef>
+#include <cstdint>
+
+#include "board.hpp"
+#include "color.hpp"
+#include "coords.hpp"
+#include "move.hpp"
+#include "movegen_fwd.hpp"
+#include "movelist.hpp"
+
+namespace chess {
+
+namespace detail {
+// file and rank steps of the 8 queen directions (N, NE, E, SE, S, SW, W, NW) and the 8 knight jumps
+constexpr int POLICY_QUEEN_DX[8]  = {0, 1, 1, 1, 0, -1, -1, -1};
+constexpr int POLICY_QUEEN_DY[8]  = {1, 1, 0, -1, -1, -1, 0, 1};
+constexpr int POLICY_KNIGHT_DX[8] = {1, 2, 2, 1, -1, -2, -2, -1};
+constexpr int POLICY_KNIGHT_DY[8] = {2, 1, -1, -2, -2, -1, 1, 2};
+
+// plane of a (file, rank) step, indexed by (dy + 7) * 15 + (dx + 7), -1 if no plane moves that way
+constexpr std::array<std::int8_t, 15 * 15> makePolicyPlanes() {
+    std::array<std::int8_t, 15 * 15> planes = {};
+
+    for (auto& plane : planes) plane = -1;
+
+    for (int dir = 0; dir < 8; ++dir) {
+        for (int dist = 1; dist <= 7; ++dist) {
+            const auto dx = POLICY_QUEEN_DX[dir] * dist;
+            const auto dy = POLICY_QUEEN_DY[dir] * dist;
+
+            planes[(dy + 7) * 15 + (dx + 7)] = static_cast<std::int8_t>(dir * 7 + dist - 1);
+        }
+    }
+
+    for (int i = 0; i < 8; ++i) {
+        planes[(POLICY_KNIGHT_DY[i] + 7) * 15 + (POLICY_KNIGHT_DX[i] + 7)] = static_cast<std::int8_t>(56 + i);
+    }
+
+    return planes;
+}
+
+// destination square of every index, -1 if it lies off the board
+constexpr std::array<std::int8_t, 64 * 73> makePolicyTargets() {
+    std::array<std::int8_t, 64 * 73> targets = {};
+
+    for (int from = 0; from < 64; ++from) {
+        const auto file = from & 7;
+        const auto rank = from >> 3;
+
+        for (int plane = 0; plane < 73; ++plane) {
+            int dx = 0, dy = 0;
+
+            if (plane < 56) {
+                dx = POLICY_QUEEN_DX[plane / 7] * (plane % 7 + 1);
+                dy = POLICY_QUEEN_DY[plane / 7] * (plane % 7 + 1);
+            } else if (plane < 64) {
+                dx = POLICY_KNIGHT_DX[plane - 56];
+                dy = POLICY_KNIGHT_DY[plane - 56];
+            } else {
+                // underpromotions only exist from the 7th rank
+                dx = (plane - 64) / 3 - 1;
+                dy = rank == 6 ? 1 : 8;
+            }
+
+            const auto to_file = file + dx;
+            const auto to_rank = rank + dy;
+            const auto on_board = to_file >= 0 && to_file < 8 && to_rank >= 0 && to_rank < 8;
+
+            targets[from * 73 + plane] = on_board ? static_cast<std::int8_t>(to_rank * 8 + to_file) : -1;
+        }
+    }
+
+    return targets;
+}
+}  // namespace detail
+
+/**
+ * @brief Conversion between moves and the 8x8x73 policy encoding used by AlphaZero.
+ * A move is stored as its origin square and one of 73 planes, index = from * 73 + plane.
+ * - 0-55: queen-like moves, 8 directions (N, NE, E, SE, S, SW, W, NW) times a distance of 1 to 7
+ * - 56-63: knight moves
+ * - 64-72: underpromotions, (left capture, push, right capture) times (knight, bishop, rook)
+ *
+ * Squares are seen from the side to move. For black the board is mirrored vertically, so pawns
+ * always move north. Queen promotions use the queen-like planes and castling is encoded like
+ * Move stores it, as king captures rook.
+ */
+class policy {
+   public:
+    static constexpr int PLANES = 73;
+    static constexpr int SIZE   = 64 * PLANES;
+
+    using Mask = std::bitset<SIZE>;
+
+    /**
+     * @brief Policy index of a move.
+     * @param move
+     * @param stm the side making the move, its squares are mirrored if it is black
+     * @return index in [0, SIZE), -1 if the move can't be encoded (e.g. NO_MOVE)
+     */
+    [[nodiscard]] static constexpr int moveToIndex(const Move& move, Color stm) noexcept {
+        const auto flip = stm == Color::BLACK ? 56 : 0;
+        const auto from = move.from().index() ^ flip;
+        const auto to   = move.to().index() ^ flip;
+
+        const auto dx = (to & 7) - (from & 7);
+        const auto dy = (to >> 3) - (from >> 3);
+
+        if (move.typeOf() == Move::PROMOTION && move.promotionType() != PieceType::QUEEN) {
+            const auto piece = static_cast<int>(move.promotionType()) - static_cast<int>(PieceType::KNIGHT);
+            return from * PLANES + 64 + (dx + 1) * 3 + piece;
+        }
+
+        const auto plane = PLANES_BY_STEP[(dy + 7) * 15 + (dx + 7)];
+
+        return plane < 0 ? -1 : from * PLANES + plane;
+    }
+
+    /**
+     * @brief The move for a policy index in the given position. Castling, en passant and promotions
+     * are derived from the board, the move is not checked for legality.
+     * @param board
+     * @param index
+     * @return NO_MOVE if the index points off the board
+     */
+    [[nodiscard]] static Move indexToMove(const Board& board, int index) noexcept {
+        if (index < 0 || index >= SIZE) return Move::NO_MOVE;
+
+        const auto target = TARGETS[index];
+        if (target < 0) return Move::NO_MOVE;
+
+        const auto stm   = board.sideToMove();
+        const auto flip  = stm == Color::BLACK ? 56 : 0;
+        const auto from  = Square((index / PLANES) ^ flip);
+        const auto to    = Square(target ^ flip);
+        const auto plane = index % PLANES;
+        const auto pt    = board.at<PieceType>(from);
+
+        if (plane >= 64) {
+            const auto promotion = PieceType(static_cast<PieceType::underlying>((plane - 64) % 3 + 1));
+            return Move::make<Move::PROMOTION>(from, to, promotion);
+        }
+
+        if (pt == PieceType::PAWN) {
+            if (Square::back_rank(to, ~stm)) return Move::make<Move::PROMOTION>(from, to, PieceType::QUEEN);
+            if (to == board.enpassantSq()) return Move::make<Move::ENPASSANT>(from, to);
+        }
+
+        if (pt == PieceType::KING && board.at(to) == Piece(PieceType::ROOK, stm)) {
+            return Move::make<Move::CASTLING>(from, to);
+        }
+
+        return Move::make(from, to);
+    }
+
+    /**
+     * @brief Converts a list of moves into policy indices.
+     * @param moves
+     * @param stm
+     * @param out must have room for moves.size() indices
+     */
+    static void movesToIndices(const Movelist& moves, Color stm, std::uint16_t* out) noexcept {
+        for (const auto& move : moves) *out++ = static_cast<std::uint16_t>(moveToIndex(move, stm));
+    }
+
+    /**
+     * @brief Converts policy indices back into moves for the given position, see indexToMove.
+     * @param board
+     * @param indices
+     * @param count
+     * @param out the moves are appended
+     */
+    static void indicesToMoves(const Board& board, const std::uint16_t* indices, std::size_t count,
+                               Movelist& out) noexcept {
+        for (std::size_t i = 0; i < count; ++i) out.add(indexToMove(board, indices[i]));
+    }
+
+    /**
+     * @brief Bitset over the policy space with the indices of all legal moves set.
+     * @param board
+     * @return
+     */
+    [[nodiscard]] static Mask legalMask(const Board& board) {
+        Movelist moves;
+        movegen::legalmoves(moves, board);
+
+        Mask mask;
+        for (const auto& move : moves) mask.set(moveToIndex(move, board.sideToMove()));
+
+        return mask;
+    }
+
+   private:
+    static constexpr auto PLANES_BY_STEP = detail::makePolicyPlanes();
+    static constexpr auto TARGETS        = detail::makePolicyTargets();
+};
+
+}  // namespace chess
@@ -0,0 +1,192 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#ifdef CHESS_STATS
+#    include <algorithm>
+#    include <atomic>
+#    include <mutex>
+#    include <vector>
+#endif
+
+#include "constants.hpp"
+
+namespace chess {
+
+/**
+ * @brief Counters of the move generation hot paths, only collected if CHESS_STATS is defined.
+ * Every thread counts into its own slot, collect() adds up the slots of all threads, including
+ * those that already exited. Without the define all values stay zero and counting compiles to nothing.
+ */
+struct MovegenStats {
+    // calls of the move generator (legalmoves and anylegalmoves)
+    std::uint64_t generations = 0;
+    // generations that stopped after the king moves because of a double check
+    std::uint64_t double_check_exits = 0;
+    // calls of seenSquares
+    std::uint64_t seen_squares = 0;
+    // seenSquares calls that returned early, the king has no square to move to
+    std::uint64_t seen_squares_skipped = 0;
+    // calls of movegen::isLegal and how many moves it rejected
+    std::uint64_t is_legal       = 0;
+    std::uint64_t is_legal_false = 0;
+    // number of movelists filled by legalmoves, indexed by their size
+    std::array<std::uint64_t, constants::MAX_MOVES + 1> movelist_sizes = {};
+
+    MovegenStats& operator+=(const MovegenStats& other) noexcept {
+        generations += other.generations;
+        double_check_exits += other.double_check_exits;
+        seen_squares += other.seen_squares;
+        seen_squares_skipped += other.seen_squares_skipped;
+        is_legal += other.is_legal;
+        is_legal_false += other.is_legal_false;
+
+        for (std::size_t i = 0; i < movelist_sizes.size(); ++i) movelist_sizes[i] += other.movelist_sizes[i];
+
+        return *this;
+    }
+
+    /**
+     * @brief Sums the counters of all threads.
+     * @return
+     */
+    [[nodiscard]] static MovegenStats collect();
+
+    /**
+     * @brief Sets all counters back to zero. Counts of threads running at the same time may get lost.
+     */
+    static void reset();
+};
+
+namespace detail {
+
+enum class StatCounter {
+    GENERATIONS,
+    DOUBLE_CHECK_EXITS,
+    SEEN_SQUARES,
+    SEEN_SQUARES_SKIPPED,
+    IS_LEGAL,
+    IS_LEGAL_FALSE,
+    COUNT
+};
+
+#ifdef CHESS_STATS
+/**
+ * @brief Private class, the counters of one thread. Only the owning thread writes them, other
+ * threads read them in collect(), hence relaxed atomics without read-modify-write.
+ */
+class StatsSlot {
+   public:
+    StatsSlot() {
+        std::lock_guard<std::mutex> lock(mutex());
+        slots().push_back(this);
+    }
+
+    // the counts of an exiting thread are kept in the retired totals
+    ~StatsSlot() {
+        std::lock_guard<std::mutex> lock(mutex());
+        retired() += read();
+        slots().erase(std::find(slots().begin(), slots().end(), this));
+    }
+
+    StatsSlot(const StatsSlot&)            = delete;
+    StatsSlot& operator=(const StatsSlot&) = delete;
+
+    static StatsSlot& local() {
+        thread_local StatsSlot slot;
+        return slot;
+    }
+
+    void count(StatCounter counter) noexcept { increment(counters_[static_cast<int>(counter)]); }
+
+    void countSize(int size) noexcept { increment(sizes_[size]); }
+
+    MovegenStats read() const noexcept {
+        MovegenStats stats;
+        stats.generations          = load(StatCounter::GENERATIONS);
+        stats.double_check_exits   = load(StatCounter::DOUBLE_CHECK_EXITS);
+        stats.seen_squares         = load(StatCounter::SEEN_SQUARES);
+        stats.seen_squares_skipped = load(StatCounter::SEEN_SQUARES_SKIPPED);
+        stats.is_legal             = load(StatCounter::IS_LEGAL);
+        stats.is_legal_false       = load(StatCounter::IS_LEGAL_FALSE);
+
+        for (std::size_t i = 0; i < sizes_.size(); ++i) {
+            stats.movelist_sizes[i] = sizes_[i].load(std::memory_order_relaxed);
+        }
+
+        return stats;
+    }
+
+    void clear() noexcept {
+        for (auto& counter : counters_) counter.store(0, std::memory_order_relaxed);
+        for (auto& size : sizes_) size.store(0, std::memory_order_relaxed);
+    }
+
+    static std::mutex& mutex() {
+        static std::mutex mutex;
+        return mutex;
+    }
+
+    static std::vector<StatsSlot*>& slots() {
+        static std::vector<StatsSlot*> slots;
+        return slots;
+    }
+
+    static MovegenStats& retired() {
+        static MovegenStats retired;
+        return retired;
+    }
+
+   private:
+    static void increment(std::atomic<std::uint64_t>& counter) noexcept {
+        counter.store(counter.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+    }
+
+    std::uint64_t load(StatCounter counter) const noexcept {
+        return counters_[static_cast<int>(counter)].load(std::memory_order_relaxed);
+    }
+
+    std::array<std::atomic<std::uint64_t>, static_cast<int>(StatCounter::COUNT)> counters_ = {};
+    std::array<std::atomic<std::uint64_t>, constants::MAX_MOVES + 1> sizes_              = {};
+};
+#endif
+
+inline void countStat([[maybe_unused]] StatCounter counter) noexcept {
+#ifdef CHESS_STATS
+    StatsSlot::local().count(counter);
+#endif
+}
+
+inline void countMovelistSize([[maybe_unused]] int size) noexcept {
+#ifdef CHESS_STATS
+    StatsSlot::local().countSize(size);
+#endif
+}
+
+}  // namespace detail
+
+inline MovegenStats MovegenStats::collect() {
+    MovegenStats stats;
+
+#ifdef CHESS_STATS
+    std::lock_guard<std::mutex> lock(detail::StatsSlot::mutex());
+
+    stats += detail::StatsSlot::retired();
+    for (const auto slot : detail::StatsSlot::slots()) stats += slot->read();
+#endif
+
+    return stats;
+}
+
+inline void MovegenStats::reset() {
+#ifdef CHESS_STATS
+    std::lock_guard<std::mutex> lock(detail::StatsSlot::mutex());
+
+    detail::StatsSlot::retired() = MovegenStats();
+    for (const auto slot : detail::StatsSlot::slots()) slot->clear();
+#endif
+}
+
+}  // namespace chess
@@ -0,0 +1,874 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <shared_mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include "attacks_fwd.hpp"
+#include "board.hpp"
+#include "color.hpp"
+#include "constants.hpp"
+#include "coords.hpp"
+#include "move.hpp"
+#include "movegen_fwd.hpp"
+#include "movelist.hpp"
+#include "piece.hpp"
+
+namespace chess {
+
+/**
+ * @brief Result of a tablebase probe, for the side to move.
+ */
+struct TablebaseResult {
+    GameResult result = GameResult::NONE;
+    // plies until mate, 0 for draws and if the side to move is mated
+    int dtm = 0;
+};
+
+namespace detail {
+
+// values of a table, one byte per position: 0 is a draw, otherwise mate in (value - 1) plies,
+// an odd number of plies is a win for the side to move, an even number a loss
+constexpr std::uint8_t TB_DRAW    = 0;
+constexpr std::uint8_t TB_UNKNOWN = 254;
+constexpr std::uint8_t TB_ILLEGAL = 255;
+constexpr int TB_MAX_PLY          = 252;
+
+// "no value yet" of the generation counters
+constexpr std::uint8_t TB_NONE = 255;
+
+/**
+ * @brief Private class, the table of one material signature like "KRvK", white is the stronger side.
+ * The index has a slot for each piece in signature order, both kings first of their side.
+ * The white king is mapped into a1-d1-d4 (10 squares) by the 8 board symmetries, or into files a-d
+ * (32 squares) by the left-right mirror if there are pawns. A pawn takes the 48 squares of ranks 2-7,
+ * plus 8 files for the pawn that just moved two squares if both sides have pawns and the opponent
+ * can take it en passant. Every other piece takes 64 squares.
+ */
+class TbTable {
+   public:
+    explicit TbTable(const std::string& name) : name_(name) {
+        const auto split = name.find('v');
+
+        for (std::size_t i = 0; i < name.size(); ++i) {
+            if (i == split) continue;
+
+            const auto color = i < split ? Color::WHITE : Color::BLACK;
+            pieces_.push_back(Piece(typeOf(name[i]), color));
+        }
+
+        for (const auto piece : pieces_) {
+            if (piece.type() == PieceType::PAWN) pawns_[piece.color()] = true;
+        }
+
+        size_ = pawns() ? 32 : 10;
+
+        for (std::size_t i = 1; i < pieces_.size(); ++i) {
+            radix_[i] = pieces_[i].type() == PieceType::PAWN ? (enPassant() ? 56 : 48) : 64;
+            size_ *= radix_[i];
+        }
+    }
+
+    [[nodiscard]] const std::string& name() const noexcept { return name_; }
+
+    // positions per side to move
+    [[nodiscard]] std::size_t size() const noexcept { return size_; }
+
+    [[nodiscard]] std::uint8_t at(Color stm, std::size_t index) const noexcept { return data_[stm][index]; }
+
+    /**
+     * @brief Index of a position with the material of this table.
+     * @param board
+     * @param flip the colors of the board are swapped with respect to the table
+     * @return
+     */
+    [[nodiscard]] std::size_t index(const Board& board, bool flip) const noexcept {
+        std::array<int, 5> squares = {};
+        std::size_t i              = 0;
+
+        while (i < pieces_.size()) {
+            const auto piece = pieces_[i];
+            const auto color = flip ? ~piece.color() : piece.color();
+            auto bb          = board.pieces(piece.type(), color);
+
+            while (bb) {
+                const auto sq = bb.pop();
+                squares[i++]  = flip ? sq ^ 56 : sq;
+            }
+        }
+
+        int ep = -1;
+
+        if (board.enpassantSq() != Square::NO_SQ) {
+            const auto pawn = (board.enpassantSq().index() ^ 8) ^ (flip ? 56 : 0);
+            for (std::size_t j = 0; j < pieces_.size(); ++j) {
+                if (squares[j] == pawn && pieces_[j].type() == PieceType::PAWN) ep = static_cast<int>(j);
+            }
+        }
+
+        return canonical(squares, ep);
+    }
+
+    /**
+     * @brief Retrograde analysis of all positions. lookup(board) returns the value of a position
+     * after a capture or promotion, from the tables this one depends on.
+     * @param lookup
+     * @param threads
+     * @return false if a mate is longer than TB_MAX_PLY plies
+     */
+    template <typename Lookup>
+    bool generate(const Lookup& lookup, int threads) {
+        threads = std::max(threads, 1);
+
+        for (int side = 0; side < 2; ++side) {
+            data_[side].assign(size_, TB_UNKNOWN);
+            remaining_[side] = std::make_unique<std::atomic<std::uint8_t>[]>(size_);
+            win_at_[side]    = std::make_unique<std::atomic<std::uint8_t>[]>(size_);
+            loss_at_[side].assign(size_, 0);
+        }
+
+        // the highest ply an out of table result finalizes a position at
+        std::vector<int> pending(threads, 0);
+
+        parallel(size_, threads, [&](std::size_t begin, std::size_t end, int thread) {
+            for (std::size_t index = begin; index < end; ++index) {
+                for (const auto side : {Color::WHITE, Color::BLACK}) {
+                    pending[thread] = std::max(pending[thread], initialize(index, side, lookup));
+                }
+            }
+        });
+
+        const auto max_pending = *std::max_element(pending.begin(), pending.end());
+        bool complete          = true;
+
+        for (int ply = 0;; ++ply) {
+            if (ply > TB_MAX_PLY) {
+                complete = false;
+                break;
+            }
+
+            std::vector<int> finalized(threads, 0);
+
+            parallel(size_, threads, [&](std::size_t begin, std::size_t end, int thread) {
+                for (std::size_t index = begin; index < end; ++index) {
+                    for (int side = 0; side < 2; ++side) finalized[thread] |= finalize(index, side, ply);
+                }
+            });
+
+            if (std::count(finalized.begin(), finalized.end(), 0) == threads && ply >= max_pending) break;
+
+            // the positions finalized at this ply are the ones with the value ply + 1
+            parallel(size_, threads, [&](std::size_t begin, std::size_t end, int) {
+                for (std::size_t index = begin; index < end; ++index) {
+                    for (int side = 0; side < 2; ++side) {
+                        if (data_[side][index] == ply + 1) propagate(index, Color(side), ply);
+                    }
+                }
+            });
+        }
+
+        for (int side = 0; side < 2; ++side) {
+            std::replace(data_[side].begin(), data_[side].end(), TB_UNKNOWN, TB_DRAW);
+
+            remaining_[side].reset();
+            win_at_[side].reset();
+            loss_at_[side] = {};
+        }
+
+        return complete;
+    }
+
+    void write(std::ostream& out) const {
+        out.write(MAGIC, sizeof(MAGIC));
+
+        for (int i = 0; i < 8; ++i) out.put(static_cast<char>((size_ >> (8 * i)) & 0xFF));
+        for (const auto& data : data_) out.write(reinterpret_cast<const char*>(data.data()), data.size());
+    }
+
+    bool read(std::istream& in) {
+        char magic[sizeof(MAGIC)];
+        if (!in.read(magic, sizeof(magic)) || !std::equal(magic, magic + sizeof(magic), MAGIC)) return false;
+
+        std::uint64_t size = 0;
+        for (int i = 0; i < 8; ++i) size |= static_cast<std::uint64_t>(static_cast<unsigned char>(in.get())) << (8 * i);
+        if (!in || size != size_) return false;
+
+        for (auto& data : data_) {
+            data.resize(size_);
+            if (!in.read(reinterpret_cast<char*>(data.data()), size_)) return false;
+        }
+
+        return true;
+    }
+
+    static PieceType typeOf(char c) noexcept {
+        switch (c) {
+            case 'K':
+                return PieceType::KING;
+            case 'Q':
+                return PieceType::QUEEN;
+            case 'R':
+                return PieceType::ROOK;
+            case 'B':
+                return PieceType::BISHOP;
+            case 'N':
+                return PieceType::KNIGHT;
+            case 'P':
+                return PieceType::PAWN;
+            default:
+                return PieceType::NONE;
+        }
+    }
+
+   private:
+    static constexpr char MAGIC[8] = {'C', 'H', 'E', 'S', 'S', 'T', 'B', '2'};
+
+    using Squares = std::array<int, 5>;
+
+    // f(begin, end, thread) on equal parts of [0, size)
+    template <typename F>
+    static void parallel(std::size_t size, int threads, const F& f) {
+        if (threads == 1 || size < 1024) {
+            f(0, size, 0);
+            return;
+        }
+
+        std::vector<std::thread> workers;
+        const auto chunk = size / threads;
+
+        for (int i = 0; i < threads; ++i) {
+            const auto begin = i * chunk;
+            const auto end   = i == threads - 1 ? size : begin + chunk;
+            workers.emplace_back([&f, begin, end, i]() { f(begin, end, i); });
+        }
+
+        for (auto& worker : workers) worker.join();
+    }
+
+    [[nodiscard]] bool pawns() const noexcept { return pawns_[0] || pawns_[1]; }
+
+    // only if both sides have pawns there can be en passant captures
+    [[nodiscard]] bool enPassant() const noexcept { return pawns_[0] && pawns_[1]; }
+
+    // mirror the file (1), the rank (2) and along the a1-h8 diagonal (4)
+    static int transform(int sq, int t) noexcept {
+        int file = sq & 7, rank = sq >> 3;
+        if (t & 4) std::swap(file, rank);
+        if (t & 1) file = 7 - file;
+        if (t & 2) rank = 7 - rank;
+        return rank * 8 + file;
+    }
+
+    [[nodiscard]] int kingSlot(int sq) const noexcept {
+        const int file = sq & 7, rank = sq >> 3;
+
+        if (pawns()) return file < 4 ? rank * 4 + file : -1;
+
+        // a1-d1-d4 triangle
+        if (file > 3 || rank > file) return -1;
+        return file * (file + 1) / 2 + rank;
+    }
+
+    [[nodiscard]] int kingSquare(int slot) const noexcept {
+        if (pawns()) return (slot / 4) * 8 + slot % 4;
+
+        int file = 0;
+        while ((file + 1) * (file + 2) / 2 <= slot) file++;
+        return (slot - file * (file + 1) / 2) * 8 + file;
+    }
+
+    // the value stored in the index, a pawn is stored as 0-47 for ranks 2-7 and as 48 + file if it
+    // can be taken en passant
+    [[nodiscard]] int encoded(int sq, std::size_t i, int ep) const noexcept {
+        if (pieces_[i].type() != PieceType::PAWN) return sq;
+        return static_cast<int>(i) == ep ? 48 + (sq & 7) : sq - 8;
+    }
+
+    [[nodiscard]] std::size_t canonical(const Squares& squares, int ep) const noexcept {
+        auto best = ~std::size_t(0);
+
+        for (int t = 0; t < (pawns() ? 2 : 8); ++t) {
+            const auto slot = kingSlot(transform(squares[0], t));
+            if (slot < 0) continue;
+
+            Squares stored;
+            for (std::size_t i = 0; i < pieces_.size(); ++i) stored[i] = encoded(transform(squares[i], t), i, ep);
+
+            // the same pieces are stored in increasing order
+            for (std::size_t i = 1, start = 1; i <= pieces_.size(); ++i) {
+                if (i < pieces_.size() && pieces_[i] == pieces_[start]) continue;
+                std::sort(stored.begin() + start, stored.begin() + i);
+                start = i;
+            }
+
+            std::size_t index = slot;
+            for (std::size_t i = 1; i < pieces_.size(); ++i) index = index * radix_[i] + stored[i];
+
+            best = std::min(best, index);
+        }
+
+        return best;
+    }
+
+    // squares of the pieces and the pawn that can be taken en passant, false for an unused index
+    bool decode(std::size_t index, Squares& squares, int& ep) const noexcept {
+        const auto original = index;
+        ep                  = -1;
+
+        for (auto i = pieces_.size() - 1; i > 0; --i) {
+            squares[i] = static_cast<int>(index % radix_[i]);
+            index /= radix_[i];
+        }
+
+        squares[0] = kingSquare(static_cast<int>(index));
+
+        Bitboard occupied = 0ull;
+
+        for (std::size_t i = 0; i < pieces_.size(); ++i) {
+            if (pieces_[i].type() == PieceType::PAWN) {
+                if (squares[i] >= 48) {
+                    if (ep != -1) return false;
+                    ep         = static_cast<int>(i);
+                    squares[i] = (pieces_[i].color() == Color::WHITE ? 24 : 32) + squares[i] - 48;
+                } else {
+                    squares[i] += 8;
+                }
+            }
+
+            if (occupied.check(squares[i])) return false;
+            occupied.set(squares[i]);
+        }
+
+        // the pawn came from two squares behind
+        if (ep != -1) {
+            const int dir = pieces_[ep].color() == Color::WHITE ? -8 : 8;
+            if (occupied.check(squares[ep] + dir) || occupied.check(squares[ep] + 2 * dir)) return false;
+        }
+
+        return canonical(squares, ep) == original;
+    }
+
+    [[nodiscard]] Board makeBoard(const Squares& squares, int ep, Color stm) const {
+        PackedBoard packed{};
+        std::array<std::uint8_t, 64> nibbles = {};
+        Bitboard occupied                    = 0ull;
+
+        for (std::size_t i = 0; i < pieces_.size(); ++i) {
+            const auto piece = pieces_[i];
+            auto nibble      = static_cast<std::uint8_t>(piece.internal());
+
+            if (static_cast<int>(i) == ep) nibble = 12;
+            if (piece == Piece::BLACKKING && stm == Color::BLACK) nibble = 15;
+
+            nibbles[squares[i]] = nibble;
+            occupied.set(squares[i]);
+        }
+
+        for (int i = 0; i < 8; ++i) packed[i] = (occupied.getBits() >> (56 - 8 * i)) & 0xFF;
+
+        int offset = 16;
+
+        while (occupied) {
+            packed[offset / 2] |= nibbles[occupied.pop()] << (offset % 2 == 0 ? 4 : 0);
+            offset++;
+        }
+
+        return Board::Compact::decode(packed);
+    }
+
+    // a loss for the child is a win for us one ply later and the other way around
+    static void addChild(std::uint8_t value, std::uint8_t& win_at, std::uint8_t& loss_at) noexcept {
+        if (value == TB_DRAW) {
+            loss_at = TB_NONE;
+            return;
+        }
+
+        const auto ply = value - 1;
+
+        if (ply % 2 == 0) {
+            win_at = std::min<std::uint8_t>(win_at, ply + 1);
+        } else if (loss_at != TB_NONE) {
+            loss_at = std::max<std::uint8_t>(loss_at, ply + 1);
+        }
+    }
+
+    // sets up the counters of a position, returns the highest ply they finalize it at
+    template <typename Lookup>
+    int initialize(std::size_t position, Color side, const Lookup& lookup) {
+        Squares squares;
+        int ep;
+
+        if (!decode(position, squares, ep) || (ep != -1 && pieces_[ep].color() == side)) {
+            data_[side][position] = TB_ILLEGAL;
+            return 0;
+        }
+
+        auto board = makeBoard(squares, ep, side);
+
+        if (board.isAttacked(board.kingSq(~side), side)) {
+            data_[side][position] = TB_ILLEGAL;
+            return 0;
+        }
+
+        Movelist moves;
+        movegen::legalmoves(moves, board);
+
+        if (ep != -1 && std::none_of(moves.begin(), moves.end(),
+                                     [](const Move& move) { return move.typeOf() == Move::ENPASSANT; })) {
+            data_[side][position] = TB_ILLEGAL;
+            return 0;
+        }
+
+        std::uint8_t win_at  = TB_NONE;
+        std::uint8_t loss_at = 0;
+
+        // stalemate
+        if (moves.empty() && !board.inCheck()) loss_at = TB_NONE;
+
+        std::array<std::size_t, constants::MAX_MOVES> children;
+        int count = 0;
+
+        for (const auto& move : moves) {
+            const auto leaves = move.typeOf() == Move::PROMOTION || move.typeOf() == Move::ENPASSANT ||
+                                board.at(move.to()) != Piece::NONE;
+
+            board.makeMove<true>(move);
+
+            if (leaves) {
+                addChild(lookup(board), win_at, loss_at);
+            } else {
+                children[count++] = index(board, false);
+            }
+
+            board.unmakeMove(move);
+        }
+
+        std::sort(children.begin(), children.begin() + count);
+        count = static_cast<int>(std::unique(children.begin(), children.begin() + count) - children.begin());
+
+        remaining_[side][position].store(static_cast<std::uint8_t>(count), std::memory_order_relaxed);
+        win_at_[side][position].store(win_at, std::memory_order_relaxed);
+        loss_at_[side][position] = loss_at;
+
+        return std::max(win_at == TB_NONE ? 0 : win_at, loss_at == TB_NONE ? 0 : loss_at);
+    }
+
+    bool finalize(std::size_t index, int side, int ply) noexcept {
+        auto& value = data_[side][index];
+        if (value != TB_UNKNOWN) return false;
+
+        const auto win_at = win_at_[side][index].load(std::memory_order_relaxed);
+
+        // a win as soon as a child is lost, a loss once all children are won and the out of table ones are reached
+        if (win_at == ply ||
+            (win_at == TB_NONE && remaining_[side][index].load(std::memory_order_relaxed) == 0 &&
+             loss_at_[side][index] <= ply)) {
+            value = static_cast<std::uint8_t>(ply + 1);
+            return true;
+        }
+
+        return false;
+    }
+
+    // adds the predecessor of squares with side to move and the ones where our last move allowed en passant
+    void addPredecessor(const Squares& squares, Color side, std::vector<std::size_t>& out) const {
+        const auto index = canonical(squares, -1);
+        if (data_[side][index] != TB_ILLEGAL) out.push_back(index);
+
+        if (!enPassant()) return;
+
+        for (std::size_t i = 0; i < pieces_.size(); ++i) {
+            const auto piece = pieces_[i];
+            if (piece.type() != PieceType::PAWN || piece.color() == side) continue;
+            if ((squares[i] >> 3) != (piece.color() == Color::WHITE ? 3 : 4)) continue;
+
+            const auto ep_index = canonical(squares, static_cast<int>(i));
+            if (data_[side][ep_index] != TB_ILLEGAL) out.push_back(ep_index);
+        }
+    }
+
+    // un-makes every move of the side that moved last, the predecessors are notified of the result
+    void propagate(std::size_t index, Color side, int ply) {
+        Squares squares;
+        int ep;
+        decode(index, squares, ep);
+
+        const auto mover = ~side;
+        std::vector<std::size_t> predecessors;
+
+        if (ep != -1) {
+            // the pawn came from its second rank
+            auto before = squares;
+            before[ep] += pieces_[ep].color() == Color::WHITE ? -16 : 16;
+            addPredecessor(before, mover, predecessors);
+        } else {
+            Bitboard occupied = 0ull;
+            for (std::size_t i = 0; i < pieces_.size(); ++i) occupied.set(squares[i]);
+
+            for (std::size_t i = 0; i < pieces_.size(); ++i) {
+                const auto piece = pieces_[i];
+                if (piece.color() != mover) continue;
+
+                const auto from = Square(squares[i]);
+                auto before     = squares;
+
+                if (piece.type() == PieceType::PAWN) {
+                    const int dir  = mover == Color::WHITE ? -8 : 8;
+                    const int back = squares[i] + dir;
+                    const int rank = back >> 3;
+
+                    if (rank == 0 || rank == 7 || occupied.check(back)) continue;
+
+                    before[i] = back;
+                    addPredecessor(before, mover, predecessors);
+
+                    const int start = back + dir;
+                    if ((start >> 3) != (mover == Color::WHITE ? 1 : 6) || occupied.check(start)) continue;
+
+                    // this double move leads to the en passant position instead
+                    if (enPassant() && data_[side][canonical(squares, static_cast<int>(i))] != TB_ILLEGAL) continue;
+
+                    before[i] = start;
+                    addPredecessor(before, mover, predecessors);
+                    continue;
+                }
+
+                Bitboard targets;
+
+                switch (piece.type()) {
+                    case PieceType(PieceType::KNIGHT):
+                        targets = attacks::knight(from);
+                        break;
+                    case PieceType(PieceType::BISHOP):
+                        targets = attacks::bishop(from, occupied);
+                        break;
+                    case PieceType(PieceType::ROOK):
+                        targets = attacks::rook(from, occupied);
+                        break;
+                    case PieceType(PieceType::QUEEN):
+                        targets = attacks::queen(from, occupied);
+                        break;
+                    default:
+                        targets = attacks::king(from);
+                        break;
+                }
+
+                targets &= ~occupied;
+
+                while (targets) {
+                    before[i] = targets.pop();
+                    addPredecessor(before, mover, predecessors);
+                }
+            }
+        }
+
+        std::sort(predecessors.begin(), predecessors.end());
+        predecessors.erase(std::unique(predecessors.begin(), predecessors.end()), predecessors.end());
+
+        const bool lost = ply % 2 == 0;
+
+        for (const auto predecessor : predecessors) {
+            if (data_[mover][predecessor] != TB_UNKNOWN) continue;
+
+            if (lost) {
+                win_at_[mover][predecessor].store(static_cast<std::uint8_t>(ply + 1), std::memory_order_relaxed);
+            } else {
+                remaining_[mover][predecessor].fetch_sub(1, std::memory_order_relaxed);
+            }
+        }
+    }
+
+    std::string name_;
+    std::vector<Piece> pieces_;
+    std::array<bool, 2> pawns_ = {false, false};
+    // values of the slot of each piece but the white king
+    std::array<std::size_t, 5> radix_ = {};
+    std::size_t size_                 = 0;
+
+    std::array<std::vector<std::uint8_t>, 2> data_;
+
+    // during generate(): in table children not known to be won by the opponent, the ply a win is
+    // found at and the ply the out of table children lose at the latest, TB_NONE if one draws
+    std::array<std::unique_ptr<std::atomic<std::uint8_t>[]>, 2> remaining_;
+    std::array<std::unique_ptr<std::atomic<std::uint8_t>[]>, 2> win_at_;
+    std::array<std::vector<std::uint8_t>, 2> loss_at_;
+};
+
+}  // namespace detail
+
+/**
+ * @brief Endgame tablebase with win/draw/loss and distance to mate for up to MAX_PIECES pieces,
+ * generated by retrograde analysis when a material is probed for the first time. Positions with
+ * castling rights are not covered and the 50 move rule is ignored. Thread safe, probes of loaded
+ * tables don't wait for a table that is being generated.
+ */
+class Tablebase {
+   public:
+    static constexpr int MAX_PIECES = 5;
+
+    /**
+     * @param directory generated tables are stored here and read back instead of generating them
+     * again, empty keeps them in memory only
+     * @param threads threads used to generate a table
+     */
+    explicit Tablebase(std::string directory = "", int threads = 1)
+        : directory_(std::move(directory)), threads_(threads) {}
+
+    /**
+     * @brief Result of the position, the table of its material is generated or loaded if needed.
+     * @param board
+     * @return std::nullopt for too many pieces, castling rights, an illegal position or a mate longer
+     * than 126 moves
+     */
+    [[nodiscard]] std::optional<TablebaseResult> probe(const Board& board) {
+        if (board.occ().count() > MAX_PIECES || !board.castlingRights().isEmpty()) return std::nullopt;
+
+        // the index has no room for a pawn on its first or last rank
+        const auto edges = Bitboard(Rank::RANK_1) | Bitboard(Rank::RANK_8);
+        if (board.pieces(PieceType::PAWN) & edges) return std::nullopt;
+
+        if (!ensure(material(board))) return std::nullopt;
+
+        std::shared_lock<std::shared_mutex> lock(mutex_);
+
+        const auto value = lookup(board);
+
+        if (value == detail::TB_ILLEGAL) return std::nullopt;
+        if (value == detail::TB_DRAW) return TablebaseResult{GameResult::DRAW, 0};
+
+        const int ply = value - 1;
+        return TablebaseResult{ply % 2 ? GameResult::WIN : GameResult::LOSE, ply};
+    }
+
+    /**
+     * @brief The fastest mate, the slowest loss or a move that holds the draw.
+     * @param board
+     * @return Move::NO_MOVE if the position can't be probed or there are no legal moves
+     */
+    [[nodiscard]] Move bestMove(const Board& board) {
+        if (!probe(board)) return Move::NO_MOVE;
+
+        Movelist moves;
+        movegen::legalmoves(moves, board);
+
+        std::shared_lock<std::shared_mutex> lock(mutex_);
+
+        Move best      = Move::NO_MOVE;
+        int best_score = 0;
+
+        for (const auto& move : moves) {
+            auto child = board;
+            child.makeMove<true>(move);
+
+            // the children are covered by the tables loaded for probe()
+            const auto value = lookup(child);
+            const int ply    = value - 1;
+
+            // quick wins first, then draws, then slow losses
+            const int score = value == detail::TB_DRAW ? 1000 : ply % 2 == 0 ? 2000 - ply : ply;
+
+            if (best == Move::NO_MOVE || score > best_score) {
+                best       = move;
+                best_score = score;
+            }
+        }
+
+        return best;
+    }
+
+    /**
+     * @brief Generates or loads the table of a material like "KBNvK" and the ones it depends on.
+     * @param material
+     * @return false for an invalid material, more than MAX_PIECES pieces or a mate longer than 126 moves
+     */
+    bool generate(std::string_view material) {
+        const auto split = material.find('v');
+
+        if (split == std::string_view::npos || material.size() - 1 > MAX_PIECES) return false;
+
+        std::string white(material.substr(0, split));
+        std::string black(material.substr(split + 1));
+
+        for (auto* side : {&white, &black}) {
+            if (side->empty() || (*side)[0] != 'K') return false;
+            if (std::count(side->begin(), side->end(), 'K') != 1) return false;
+
+            for (const auto c : *side) {
+                if (detail::TbTable::typeOf(c) == PieceType::NONE) return false;
+            }
+
+            std::sort(side->begin() + 1, side->end(), [](char a, char b) { return order(a) < order(b); });
+        }
+
+        return ensure(stronger(black, white) ? black + "v" + white : white + "v" + black);
+    }
+
+    /**
+     * @brief Material signature of a position, the stronger side first, e.g. "KRPvKR".
+     * @param board
+     * @return
+     */
+    [[nodiscard]] static std::string material(const Board& board) {
+        const auto white = side(board, Color::WHITE);
+        const auto black = side(board, Color::BLACK);
+
+        return stronger(black, white) ? black + "v" + white : white + "v" + black;
+    }
+
+   private:
+    static constexpr std::string_view ORDER = "KQRBNP";
+
+    static int order(char c) noexcept { return static_cast<int>(ORDER.find(c)); }
+
+    static std::string side(const Board& board, Color color) {
+        std::string pieces;
+
+        for (const auto c : ORDER) {
+            const auto count = board.pieces(detail::TbTable::typeOf(c), color).count();
+            pieces.append(count, c);
+        }
+
+        return pieces;
+    }
+
+    // more pieces, or the better piece at the first difference
+    static bool stronger(const std::string& a, const std::string& b) noexcept {
+        if (a.size() != b.size()) return a.size() > b.size();
+
+        for (std::size_t i = 0; i < a.size(); ++i) {
+            if (a[i] != b[i]) return order(a[i]) < order(b[i]);
+        }
+
+        return false;
+    }
+
+    static bool insufficient(const std::string& name) noexcept {
+        return name == "KvK" || name == "KBvK" || name == "KNvK";
+    }
+
+    // value of a position whose table is loaded, requires a shared lock of mutex_ or load_mutex_
+    std::uint8_t lookup(const Board& board) const {
+        const auto name = material(board);
+        if (insufficient(name)) return detail::TB_DRAW;
+
+        const auto& table = *tables_.at(name);
+
+        // the board has the colors of the table if white is at least as strong
+        const bool flip = name.compare(0, name.find('v'), side(board, Color::WHITE)) != 0;
+        const auto stm  = flip ? ~board.sideToMove() : board.sideToMove();
+
+        return table.at(stm, table.index(board, flip));
+    }
+
+    // loads the table unless it is there already, only one table is loaded at a time
+    bool ensure(const std::string& name) {
+        if (insufficient(name)) return true;
+
+        {
+            std::shared_lock<std::shared_mutex> lock(mutex_);
+
+            const auto it = tables_.find(name);
+            if (it != tables_.end()) return it->second != nullptr;
+        }
+
+        std::lock_guard<std::mutex> lock(load_mutex_);
+
+        return load(name);
+    }
+
+    // loads or generates a table and its dependencies, requires load_mutex_. Only load() changes
+    // tables_, so it reads it without mutex_ and takes that exclusively for an insert only
+    bool load(const std::string& name) {
+        if (insufficient(name)) return true;
+
+        const auto it = tables_.find(name);
+        if (it != tables_.end()) return it->second != nullptr;
+
+        const auto split = name.find('v');
+        const auto white = name.substr(0, split);
+        const auto black = name.substr(split + 1);
+
+        // every material a capture and/or promotion leads to
+        for (const auto& [us, them, white_moves] : {std::tuple{white, black, true}, std::tuple{black, white, false}}) {
+            for (std::size_t i = 1; i < them.size(); ++i) {
+                if (!load(join(us, erase(them, i), white_moves))) return failed(name);
+            }
+
+            const auto pawn = us.find('P');
+            if (pawn == std::string::npos) continue;
+
+            for (const char promoted : {'Q', 'R', 'B', 'N'}) {
+                auto after = erase(us, pawn) + promoted;
+                std::sort(after.begin() + 1, after.end(), [](char a, char b) { return order(a) < order(b); });
+
+                if (!load(join(after, them, white_moves))) return failed(name);
+
+                for (std::size_t i = 1; i < them.size(); ++i) {
+                    if (!load(join(after, erase(them, i), white_moves))) return failed(name);
+                }
+            }
+        }
+
+        auto table = std::make_unique<detail::TbTable>(name);
+        const auto path = directory_.empty() ? std::string() : directory_ + "/" + name + ".ctb";
+
+        std::ifstream in(path, std::ios::binary);
+
+        if (path.empty() || !in.is_open() || !table->read(in)) {
+            if (!table->generate([this](const Board& board) { return lookup(board); }, threads_)) {
+                return failed(name);
+            }
+
+            if (!path.empty()) {
+                std::ofstream out(path, std::ios::binary);
+                table->write(out);
+            }
+        }
+
+        insert(name, std::move(table));
+
+        return true;
+    }
+
+    bool failed(const std::string& name) {
+        insert(name, nullptr);
+        return false;
+    }
+
+    void insert(const std::string& name, std::unique_ptr<detail::TbTable> table) {
+        std::lock_guard<std::shared_mutex> lock(mutex_);
+        tables_[name] = std::move(table);
+    }
+
+    static std::string erase(std::string pieces, std::size_t i) { return pieces.erase(i, 1); }
+
+    static std::string join(const std::string& us, const std::string& them, bool white) {
+        const auto& w = white ? us : them;
+        const auto& b = white ? them : us;
+        return stronger(b, w) ? b + "v" + w : w + "v" + b;
+    }
+
+    std::string directory_;
+    int threads_;
+
+    // mutex_ guards tables_ against the inserts, load_mutex_ lets one thread at a time load tables
+    std::shared_mutex mutex_;
+    std::mutex load_mutex_;
+    std::map<std::string, std::unique_ptr<detail::TbTable>> tables_;
+};
+
+}  // namespace chess
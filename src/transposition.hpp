@@ -0,0 +1,339 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <climits>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+#if defined(_WIN32)
+#    include <malloc.h>
+#elif defined(__linux__)
+#    include <sys/mman.h>
+#endif
+
+#if defined(_MSC_VER)
+#    include <xmmintrin.h>
+#endif
+
+namespace chess {
+
+/**
+ * @brief Hash table shared by search threads, keyed by Board::hash(). Entry can be any trivially
+ * copyable type, e.g. move, score and bound of a search or the node count of a perft.
+ * Slots are read and written without locks. The stored key is xor'ed with the entry, so an entry
+ * torn by two threads writing at once fails the next probe. The lower 48 bits of the key are
+ * verified and the upper bits select the cluster, so the whole key is compared once the table has
+ * at least 2^16 clusters. A cluster holds as many slots as fit into a cache line.
+ */
+template <typename Entry>
+class TranspositionTable {
+    static_assert(std::is_trivially_copyable_v<Entry>, "Entry must be trivially copyable");
+
+   public:
+    // depths outside [MIN_DEPTH, MAX_DEPTH] are clamped
+    static constexpr int MIN_DEPTH = -16;
+    static constexpr int MAX_DEPTH = MIN_DEPTH + 254;
+
+    TranspositionTable() = default;
+
+    explicit TranspositionTable(std::size_t mb) { resize(mb); }
+
+    ~TranspositionTable() { deallocate(); }
+
+    TranspositionTable(const TranspositionTable&)            = delete;
+    TranspositionTable& operator=(const TranspositionTable&) = delete;
+
+    /**
+     * @brief Reallocates the table with the given size, all entries are lost. 0 frees it, a table
+     * without memory finds nothing and stores nothing. Uses huge pages on Linux if the kernel allows it.
+     * Throws std::bad_alloc if the memory can't be allocated, with CHESS_NO_EXCEPTIONS the table stays empty.
+     * @param mb
+     * @param threads threads that clear the new memory
+     */
+    void resize(std::size_t mb, int threads = 1) {
+        deallocate();
+
+        const auto count = mb * 1024 * 1024 / sizeof(Cluster);
+        if (count == 0) return;
+
+        if (!allocate(count)) {
+#ifndef CHESS_NO_EXCEPTIONS
+            throw std::bad_alloc();
+#else
+            return;
+#endif
+        }
+
+        zero(threads, true);
+    }
+
+    /**
+     * @brief Empties all slots, split over the given number of threads.
+     * @param threads
+     */
+    void clear(int threads = 1) { zero(threads, false); }
+
+    /**
+     * @brief Ages all entries, call it between two searches and not during one. Entries of older
+     * searches are replaced first.
+     */
+    void newSearch() noexcept { generation_ = static_cast<std::uint8_t>(generation_ + 1); }
+
+    /**
+     * @brief Starts loading the cluster of key into the cache, e.g. with the key of
+     * Board::zobristAfter(move) before making the move.
+     * @param key
+     */
+    void prefetch(std::uint64_t key) const noexcept {
+        if (!clusters_) return;
+
+#if defined(_MSC_VER)
+        _mm_prefetch(reinterpret_cast<const char*>(&clusters_[index(key)]), _MM_HINT_T0);
+#else
+        __builtin_prefetch(&clusters_[index(key)]);
+#endif
+    }
+
+    /**
+     * @brief Looks up the entry of key.
+     * @param key
+     * @param entry set if found
+     * @param depth set to the depth the entry was stored with, if found
+     * @return
+     */
+    [[nodiscard]] bool probe(std::uint64_t key, Entry& entry, int& depth) const noexcept {
+        if (!clusters_) return false;
+
+        for (const auto& slot : clusters_[index(key)].slots) {
+            const auto meta = slot.meta.load(std::memory_order_relaxed);
+            if (!(meta & DEPTH_MASK)) continue;
+
+            std::uint64_t words[WORDS];
+            if (!matches(slot, meta, key, words)) continue;
+
+            std::memcpy(&entry, words, sizeof(Entry));
+            depth = unpackDepth(meta);
+            return true;
+        }
+
+        return false;
+    }
+
+    [[nodiscard]] bool probe(std::uint64_t key, Entry& entry) const noexcept {
+        int depth;
+        return probe(key, entry, depth);
+    }
+
+    /**
+     * @brief Stores an entry. An entry of the same key is only overwritten by one of at least its
+     * depth or if it is from an older search. Otherwise the slot of the cluster with the lowest
+     * depth minus 8 per search of age is replaced, empty slots first.
+     * @param key
+     * @param depth
+     * @param entry
+     */
+    void store(std::uint64_t key, int depth, const Entry& entry) noexcept {
+        if (!clusters_) return;
+
+        depth = std::clamp(depth, MIN_DEPTH, MAX_DEPTH);
+
+        Slot* replace = nullptr;
+        int worst     = INT_MAX;
+
+        for (auto& slot : clusters_[index(key)].slots) {
+            const auto meta = slot.meta.load(std::memory_order_relaxed);
+
+            if (!(meta & DEPTH_MASK)) {
+                if (worst != INT_MIN) {
+                    replace = &slot;
+                    worst   = INT_MIN;
+                }
+
+                continue;
+            }
+
+            std::uint64_t words[WORDS];
+
+            if (matches(slot, meta, key, words)) {
+                if (depth < unpackDepth(meta) && age(meta) == 0) return;
+                replace = &slot;
+                break;
+            }
+
+            const auto value = unpackDepth(meta) - 8 * age(meta);
+
+            if (value < worst) {
+                replace = &slot;
+                worst   = value;
+            }
+        }
+
+        std::uint64_t words[WORDS] = {};
+        std::memcpy(words, &entry, sizeof(Entry));
+
+        for (std::size_t i = 0; i < WORDS; ++i) replace->data[i].store(words[i], std::memory_order_relaxed);
+
+        const auto depth_bits      = static_cast<std::uint64_t>(depth - MIN_DEPTH + 1) << 48;
+        const auto generation_bits = static_cast<std::uint64_t>(generation_) << 56;
+        replace->meta.store(((key ^ fold(words)) & KEY_MASK) | depth_bits | generation_bits, std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Permille of the slots used by the current search, sampled from the first 1000 clusters,
+     * as reported by UCI engines in "info hashfull".
+     * @return
+     */
+    [[nodiscard]] int hashfull() const noexcept {
+        const auto sample = std::min<std::size_t>(count_, 1000);
+        std::size_t used  = 0;
+
+        for (std::size_t i = 0; i < sample; ++i) {
+            for (const auto& slot : clusters_[i].slots) {
+                const auto meta = slot.meta.load(std::memory_order_relaxed);
+                used += (meta & DEPTH_MASK) && age(meta) == 0;
+            }
+        }
+
+        return sample ? static_cast<int>(used * 1000 / (sample * SLOTS)) : 0;
+    }
+
+    /**
+     * @brief Number of entries the table can hold.
+     * @return
+     */
+    [[nodiscard]] std::size_t size() const noexcept { return count_ * SLOTS; }
+
+   private:
+    static constexpr std::size_t WORDS = (sizeof(Entry) + 7) / 8;
+
+    // meta word: generation (8 bits) | depth - MIN_DEPTH + 1, 0 if empty (8 bits) | key ^ entry (lower 48 bits)
+    static constexpr std::uint64_t KEY_MASK   = 0xFFFFFFFFFFFFull;
+    static constexpr std::uint64_t DEPTH_MASK = 0xFFull << 48;
+
+    struct Slot {
+        std::atomic<std::uint64_t> meta;
+        std::atomic<std::uint64_t> data[WORDS];
+    };
+
+    static constexpr std::size_t SLOTS = sizeof(Slot) >= 64 ? 1 : 64 / sizeof(Slot);
+
+    struct alignas(64) Cluster {
+        Slot slots[SLOTS];
+    };
+
+    // mixed with a multiplication, a plain xor would let words of two different entries cancel out
+    static std::uint64_t fold(const std::uint64_t (&words)[WORDS]) noexcept {
+        std::uint64_t folded = 0;
+        for (const auto word : words) folded = (folded ^ word) * 0x9E3779B97F4A7C15ull;
+        return folded;
+    }
+
+    static int unpackDepth(std::uint64_t meta) noexcept {
+        return static_cast<int>((meta >> 48) & 0xFF) + MIN_DEPTH - 1;
+    }
+
+    static bool matches(const Slot& slot, std::uint64_t meta, std::uint64_t key,
+                        std::uint64_t (&words)[WORDS]) noexcept {
+        for (std::size_t i = 0; i < WORDS; ++i) words[i] = slot.data[i].load(std::memory_order_relaxed);
+        return ((meta ^ key ^ fold(words)) & KEY_MASK) == 0;
+    }
+
+    int age(std::uint64_t meta) const noexcept { return static_cast<std::uint8_t>(generation_ - (meta >> 56)); }
+
+    // the upper 32 bits pick the cluster, the lower 48 are verified
+    std::size_t index(std::uint64_t key) const noexcept {
+        return static_cast<std::size_t>(((key >> 32) * static_cast<std::uint64_t>(count_)) >> 32);
+    }
+
+    bool allocate(std::size_t count) {
+        auto bytes   = count * sizeof(Cluster);
+        void* memory = nullptr;
+
+#if defined(_WIN32)
+        memory = _aligned_malloc(bytes, alignof(Cluster));
+#else
+        std::size_t alignment = alignof(Cluster);
+
+#    if defined(__linux__) && defined(MADV_HUGEPAGE)
+        // 2 MB aligned, so that the kernel can back the whole table with transparent huge pages
+        constexpr std::size_t HUGE_PAGE = 2 * 1024 * 1024;
+
+        if (bytes >= HUGE_PAGE) {
+            alignment = HUGE_PAGE;
+            bytes     = (bytes + HUGE_PAGE - 1) / HUGE_PAGE * HUGE_PAGE;
+        }
+#    endif
+
+        if (posix_memalign(&memory, alignment, bytes) != 0) memory = nullptr;
+
+#    if defined(__linux__) && defined(MADV_HUGEPAGE)
+        if (memory) madvise(memory, bytes, MADV_HUGEPAGE);
+#    endif
+#endif
+
+        clusters_ = static_cast<Cluster*>(memory);
+        count_    = memory ? count : 0;
+
+        return memory != nullptr;
+    }
+
+    void deallocate() noexcept {
+        if (!clusters_) return;
+
+#if defined(_WIN32)
+        _aligned_free(clusters_);
+#else
+        std::free(clusters_);
+#endif
+
+        clusters_ = nullptr;
+        count_    = 0;
+    }
+
+    // zeroes all clusters on the given threads. With construct the clusters of fresh memory start
+    // their lifetime in the same loop, so every page is written once and by the thread that zeroes it
+    void zero(int threads, bool construct) {
+        const auto fill = [this, construct](std::size_t begin, std::size_t end) {
+            for (std::size_t i = begin; i < end; ++i) {
+                // default initialization, the atomics are not written here
+                if (construct) new (&clusters_[i]) Cluster;
+
+                for (auto& slot : clusters_[i].slots) {
+                    slot.meta.store(0, std::memory_order_relaxed);
+                    for (auto& word : slot.data) word.store(0, std::memory_order_relaxed);
+                }
+            }
+        };
+
+        generation_ = 0;
+
+        if (threads <= 1 || count_ < static_cast<std::size_t>(threads)) {
+            fill(0, count_);
+            return;
+        }
+
+        std::vector<std::thread> workers;
+        const auto chunk = count_ / threads;
+
+        for (int i = 0; i < threads; ++i) {
+            const auto begin = i * chunk;
+            const auto end   = i == threads - 1 ? count_ : begin + chunk;
+            workers.emplace_back(fill, begin, end);
+        }
+
+        for (auto& worker : workers) worker.join();
+    }
+
+    Cluster* clusters_       = nullptr;
+    std::size_t count_       = 0;
+    std::uint8_t generation_ = 0;
+};
+
+}  // namespace chess
@@ -2,10 +2,13 @@
 
 #include <cassert>
 #include <cctype>
+#include <charconv>
+#include <cstring>
 #include <stdexcept>
 #include <string>
 #include <string_view>
 #include <utility>
+#include <vector>
 
 #include "board.hpp"
 #include "color.hpp"
@@ -15,6 +18,11 @@
 namespace chess {
 class uci {
    public:
+    /**
+     * @brief Maximum number of characters written by the buffer version of moveToUci.
+     */
+    static constexpr std::size_t MAX_UCI_LENGTH = 5;
+
     /**
      * @brief Converts an internal move to a UCI string
      * @param move
@@ -22,26 +30,33 @@ class uci {
      * @return
      */
     [[nodiscard]] static std::string moveToUci(const Move& move, bool chess960 = false) noexcept(false) {
-        // Get the from and to squares
-        Square from_sq = move.from();
-        Square to_sq   = move.to();
+        char buffer[MAX_UCI_LENGTH];
+        return std::string(buffer, moveToUci(move, buffer, chess960));
+    }
+
+    /**
+     * @brief Writes the UCI string of a move into out, without allocating.
+     * @param move
+     * @param out must have room for MAX_UCI_LENGTH characters, no null terminator is written
+     * @param chess960
+     * @return the number of characters written
+     */
+    static std::size_t moveToUci(const Move& move, char* out, bool chess960 = false) noexcept {
+        const auto from = move.from().index();
+        auto to         = move.to().index();
 
-        // If the move is not a chess960 castling move and is a king moving more than one square,
-        // update the to square to be the correct square for a regular castling move
+        // castling is stored as king captures rook, outside of chess960 the king goes to the g or c file
         if (!chess960 && move.typeOf() == Move::CASTLING) {
-            to_sq = Square(to_sq > from_sq ? File::FILE_G : File::FILE_C, from_sq.rank());
+            to = (from & 56) | (to > from ? 6 : 2);
         }
 
-        // Add the from and to squares to the string stream
-        std::string result = static_cast<std::string>(from_sq);
-        result += static_cast<std::string>(to_sq);
+        std::memcpy(out, SQUARE_NAMES + 2 * from, 2);
+        std::memcpy(out + 2, SQUARE_NAMES + 2 * to, 2);
 
-        // If the move is a promotion, add the promoted piece to the string stream
-        if (move.typeOf() == Move::PROMOTION) {
-            result += static_cast<std::string>(move.promotionType());
-        }
+        if (move.typeOf() != Move::PROMOTION) return 4;
 
-        return result;
+        out[4] = "nbrq"[(move.move() >> 12) & 3];
+        return 5;
     }
 
     /**
@@ -96,6 +111,67 @@ class uci {
         return (uci.length() == 4) ? Move::make<Move::NORMAL>(source, target) : Move::NO_MOVE;
     }
 
+    /**
+     * @brief Converts a UCI string to a legal move. Same as uciToMove followed by movegen::isLegal,
+     * but the squares are decoded without branching and normal moves are validated against the
+     * mailbox and a single king attack test instead of the full check and pin masks.
+     * It is stricter in two cases: a fifth character on a king move is rejected, and only a king
+     * move of two files on the same rank is read as castling.
+     * Meant for protocol handlers replaying long "position ... moves" commands.
+     * @param board
+     * @param uci
+     * @return NO_MOVE if the string is malformed or the move is not legal.
+     */
+    [[nodiscard]] static Move uciToMoveChecked(const Board& board, std::string_view uci) noexcept {
+        if (uci.length() != 4 && uci.length() != 5) return Move::NO_MOVE;
+
+        // characters outside of a-h and 1-8 wrap around to values above 7
+        const auto from_file = static_cast<unsigned>(uci[0] - 'a');
+        const auto from_rank = static_cast<unsigned>(uci[1] - '1');
+        const auto to_file   = static_cast<unsigned>(uci[2] - 'a');
+        const auto to_rank   = static_cast<unsigned>(uci[3] - '1');
+
+        if ((from_file | from_rank | to_file | to_rank) > 7) return Move::NO_MOVE;
+
+        const auto source = Square(static_cast<int>(from_rank * 8 + from_file));
+        auto target       = Square(static_cast<int>(to_rank * 8 + to_file));
+        const auto pt     = board.at<PieceType>(source);
+
+        std::uint16_t type      = Move::NORMAL;
+        std::uint16_t promotion = 0;
+
+        if (uci.length() == 5) {
+            promotion = promotionIndex(uci[4]);
+            if (pt != PieceType::PAWN || promotion > 3) return Move::NO_MOVE;
+            type = Move::PROMOTION;
+        } else if (pt == PieceType::KING) {
+            if (board.chess960()) {
+                // in chess960 castling is sent as king captures rook
+                if (board.at(target) == Piece(PieceType::ROOK, board.sideToMove())) type = Move::CASTLING;
+            } else if (from_rank == to_rank && (from_file + 2 == to_file || to_file + 2 == from_file)) {
+                type   = Move::CASTLING;
+                target = Square(to_file > from_file ? File::FILE_H : File::FILE_A, source.rank());
+            }
+        } else if (pt == PieceType::PAWN && target == board.enpassantSq()) {
+            type = Move::ENPASSANT;
+        }
+
+        const auto move = Move(static_cast<std::uint16_t>(type | (promotion << 12) | (source.index() << 6) |
+                                                          target.index()));
+
+        // castling and en passant are rare enough to go through the full check
+        if (type == Move::CASTLING || type == Move::ENPASSANT) {
+            return movegen::isLegal(board, move) ? move : Move::NO_MOVE;
+        }
+
+        return isLegalNormal(board, move, pt) ? move : Move::NO_MOVE;
+    }
+
+    /**
+     * @brief Maximum number of characters written by the buffer versions of moveToSan and moveToLan.
+     */
+    static constexpr std::size_t MAX_SAN_LENGTH = 10;
+
     /**
      * @brief Converts a move to a SAN string
      * @param board
@@ -103,9 +179,66 @@ class uci {
      * @return
      */
     [[nodiscard]] static std::string moveToSan(const Board& board, const Move& move) noexcept(false) {
-        std::string san;
-        moveToRep<false>(board, move, san);
-        return san;
+        char san[MAX_SAN_LENGTH];
+        return std::string(san, moveToSan(board, move, san));
+    }
+
+    /**
+     * @brief Writes the SAN of a move into out, which needs room for MAX_SAN_LENGTH characters.
+     * No null terminator is written. The board is not copied, a scratch board is only used
+     * to decide between + and # when the move gives check.
+     * @param board
+     * @param move
+     * @param out
+     * @return number of characters written
+     */
+    static std::size_t moveToSan(const Board& board, const Move& move, char* out) {
+        return writeRep<false>(board, move, out);
+    }
+
+    /**
+     * @brief Appends the moves as PGN movetext with move numbers, e.g. "1. e4 e5 2. Nf3", to out.
+     * If black moves first the text starts with "N...". The moves have to be legal.
+     * The line is played once on the board, so the mate check after a checking move can run
+     * directly on it instead of on a scratch board.
+     * @param board starting position
+     * @param moves
+     * @param count
+     * @param out
+     */
+    static void gameToSan(Board board, const Move* moves, std::size_t count, std::string& out) {
+        for (std::size_t i = 0; i < count; ++i) {
+            const auto& move = moves[i];
+
+            if (i > 0) out += ' ';
+
+            if (board.sideToMove() == Color::WHITE || i == 0) {
+                char number[16];
+                const auto end = std::to_chars(number, number + sizeof(number), board.fullMoveNumber()).ptr;
+
+                out.append(number, end);
+                out += board.sideToMove() == Color::WHITE ? ". " : "... ";
+            }
+
+            char san[MAX_SAN_LENGTH];
+            char* p = writeMoveText<false>(board, move, san);
+
+            board.makeMove(move);
+
+            if (board.inCheck()) *p++ = movegen::anylegalmoves(board) ? '+' : '#';
+
+            out.append(san, p);
+        }
+    }
+
+    /**
+     * @brief Appends the moves as PGN movetext with move numbers to out.
+     * @param board starting position
+     * @param moves
+     * @param out
+     */
+    static void gameToSan(const Board& board, const std::vector<Move>& moves, std::string& out) {
+        gameToSan(board, moves.data(), moves.size(), out);
     }
 
     /**
@@ -115,9 +248,20 @@ class uci {
      * @return
      */
     [[nodiscard]] static std::string moveToLan(const Board& board, const Move& move) noexcept(false) {
-        std::string lan;
-        moveToRep<true>(board, move, lan);
-        return lan;
+        char lan[MAX_SAN_LENGTH];
+        return std::string(lan, moveToLan(board, move, lan));
+    }
+
+    /**
+     * @brief Writes the LAN of a move into out, which needs room for MAX_SAN_LENGTH characters.
+     * No null terminator is written.
+     * @param board
+     * @param move
+     * @param out
+     * @return number of characters written
+     */
+    static std::size_t moveToLan(const Board& board, const Move& move, char* out) {
+        return writeRep<true>(board, move, out);
     }
 
     class SanParseError : public std::exception {
@@ -148,6 +292,18 @@ class uci {
         std::string msg_;
     };
 
+    /**
+     * @brief Reasons for tryParseSan to fail.
+     */
+    enum class SanError : std::uint8_t {
+        NONE,              // parsed successfully
+        EMPTY,             // the string is empty
+        INVALID_SYNTAX,    // not SAN, e.g. an unknown piece, a missing square or a bad promotion piece
+        ILLEGAL_CASTLING,  // castling is written correctly but not possible in this position
+        ILLEGAL_MOVE,      // well formed, but no legal move matches
+        AMBIGUOUS,         // more than one legal move matches
+    };
+
     /**
      * @brief Parse a san string and return the move.
      * This function will throw a SanParseError if the san string is invalid.
@@ -164,95 +320,98 @@ class uci {
     /**
      * @brief Parse a san string and return the move.
      * This function will throw a SanParseError if the san string is invalid.
+     * The move is found by looking at the pieces which attack the destination square,
+     * afterwards moves contains the legal moves which matched the san.
      * @param board
      * @param san
      * @param moves
      * @return
      */
     [[nodiscard]] static Move parseSan(const Board& board, std::string_view san, Movelist& moves) noexcept(false) {
-        if (san.empty()) {
-            return Move::NO_MOVE;
-        }
+        Move move;
 
-        static constexpr auto pt_to_pgt = [](PieceType pt) { return 1 << (pt); };
-        const SanMoveInformation info   = parseSanInfo(san);
+        const auto error = tryParseSan(board, san, move, moves);
 
-        if (info.capture) {
-            movegen::legalmoves<movegen::MoveGenType::CAPTURE>(moves, board, pt_to_pgt(info.piece));
-        } else {
-            movegen::legalmoves<movegen::MoveGenType::QUIET>(moves, board, pt_to_pgt(info.piece));
+#ifndef CHESS_NO_EXCEPTIONS
+        switch (error) {
+            case SanError::INVALID_SYNTAX:
+                // same messages as before tryParseSan existed
+                if (san.length() < 2) throw SanParseError("Failed to parse san. At step 0: " + std::string(san));
+                throw SanParseError("Failed to parse san. At step 1: " + std::string(san));
+            case SanError::ILLEGAL_CASTLING:
+                throw SanParseError("Failed to parse san. At step 2: " + std::string(san) + " " + board.getFen());
+            case SanError::ILLEGAL_MOVE:
+                throw SanParseError("Failed to parse san, illegal move: " + std::string(san) + " " + board.getFen());
+            case SanError::AMBIGUOUS:
+                throw AmbiguousMoveError("Ambiguous san: " + std::string(san) + " in " + board.getFen());
+            default:
+                break;
         }
+#else
+        static_cast<void>(error);
+#endif
 
-        if (info.castling_short || info.castling_long) {
-            for (const auto& move : moves) {
-                if (move.typeOf() == Move::CASTLING) {
-                    if ((info.castling_short && move.to() > move.from()) ||
-                        (info.castling_long && move.to() < move.from())) {
-                        return move;
-                    }
-                }
-            }
+        return move;
+    }
 
-#ifndef CHESS_NO_EXCEPTIONS
-            throw SanParseError("Failed to parse san. At step 2: " + std::string(san) + " " + board.getFen());
-#endif
-        }
+    /**
+     * @brief Parse a san string without throwing or allocating, for skipping bad moves cheaply.
+     * @param board
+     * @param san
+     * @param move set to the parsed move, or NO_MOVE on failure
+     * @return SanError::NONE on success, otherwise why the san was rejected
+     */
+    static SanError tryParseSan(const Board& board, std::string_view san, Move& move) noexcept {
+        Movelist moves;
+        return tryParseSan(board, san, move, moves);
+    }
 
-        Move matchingMove = Move::NO_MOVE;
-        bool foundMatch   = false;
+    /**
+     * @brief Parse a san string without throwing or allocating, for skipping bad moves cheaply.
+     * Afterwards moves contains the legal moves which matched the san.
+     * @param board
+     * @param san
+     * @param move set to the parsed move, or NO_MOVE on failure
+     * @param moves
+     * @return SanError::NONE on success, otherwise why the san was rejected
+     */
+    static SanError tryParseSan(const Board& board, std::string_view san, Move& move, Movelist& moves) noexcept {
+        move = Move::NO_MOVE;
+        moves.clear();
 
-        for (const auto& move : moves) {
-            // Skip all moves that are not to the correct square
-            // or are castling moves
-            if (move.to() != info.to || move.typeOf() == Move::CASTLING) {
-                continue;
-            }
+        if (san.empty()) return SanError::EMPTY;
 
-            // Handle promotion moves
-            if (info.promotion != PieceType::NONE) {
-                if (move.typeOf() != Move::PROMOTION || info.promotion != move.promotionType() ||
-                    move.from().file() != info.from_file) {
-                    continue;
-                }
-            }
-            // Handle en passant moves
-            else if (move.typeOf() == Move::ENPASSANT) {
-                if (move.from().file() != info.from_file) {
-                    continue;
-                }
-            }
-            // Handle moves with specific from square
-            else if (info.from != Square::NO_SQ) {
-                if (move.from() != info.from) {
-                    continue;
-                }
-            }
-            // Handle moves with partial from information (rank or file)
-            else if (info.from_rank != Rank::NO_RANK || info.from_file != File::NO_FILE) {
-                if ((info.from_file != File::NO_FILE && move.from().file() != info.from_file) ||
-                    (info.from_rank != Rank::NO_RANK && move.from().rank() != info.from_rank)) {
-                    continue;
-                }
-            }
+        SanMoveInformation info;
 
-            // If we get here, the move matches our criteria
-            if (foundMatch) {
-#ifndef CHESS_NO_EXCEPTIONS
-                throw AmbiguousMoveError("Ambiguous san: " + std::string(san) + " in " + board.getFen());
-#endif
-            }
+        if (!parseSanInfo(san, info)) return SanError::INVALID_SYNTAX;
 
-            matchingMove = move;
-            foundMatch   = true;
-        }
+        return resolveSan(board, info, move, moves);
+    }
 
-        if (!foundMatch) {
-#ifndef CHESS_NO_EXCEPTIONS
-            throw SanParseError("Failed to parse san, illegal move: " + std::string(san) + " " + board.getFen());
-#endif
-        }
+    class SanCache;
 
-        return matchingMove;
+    /**
+     * @brief Same as tryParseSan, but the tokenized san is looked up in (and added to) the cache,
+     * so that strings seen before, like "Nf3" or "O-O", are only tokenized once.
+     * @param board
+     * @param san
+     * @param move set to the parsed move, or NO_MOVE on failure
+     * @param moves
+     * @param cache
+     * @return SanError::NONE on success, otherwise why the san was rejected
+     */
+    static SanError tryParseSan(const Board& board, std::string_view san, Move& move, Movelist& moves,
+                                SanCache& cache) noexcept {
+        move = Move::NO_MOVE;
+        moves.clear();
+
+        if (san.empty()) return SanError::EMPTY;
+
+        const auto* info = cache.lookup(san);
+
+        if (info == nullptr) return SanError::INVALID_SYNTAX;
+
+        return resolveSan(board, *info, move, moves);
     }
 
     /**
@@ -303,12 +462,99 @@ class uci {
         bool capture = false;
     };
 
-    [[nodiscard]] static SanMoveInformation parseSanInfo(std::string_view san) noexcept(false) {
-#ifndef CHESS_NO_EXCEPTIONS
-        if (san.length() < 2) {
-            throw SanParseError("Failed to parse san. At step 0: " + std::string(san));
+   public:
+    /**
+     * @brief Cache from san strings to their tokenized form, see tryParseSan. Games repeat the same
+     * few thousand strings over and over, so after a few games nearly every lookup is a hit.
+     * Strings longer than 8 characters are tokenized on every call.
+     */
+    class SanCache {
+       public:
+        SanCache() : entries_(SIZE) {}
+
+       private:
+        friend class uci;
+
+        static constexpr int BITS               = 12;
+        static constexpr std::size_t SIZE       = std::size_t(1) << BITS;
+        static constexpr std::size_t MAX_PROBES = 8;
+
+        struct Entry {
+            std::uint64_t key = 0;  // the san bytes, 0 for an empty slot
+            bool valid        = false;
+            SanMoveInformation info;
+        };
+
+        // nullptr if the san is not valid
+        const SanMoveInformation* lookup(std::string_view san) noexcept {
+            if (san.size() > sizeof(std::uint64_t)) return parseUncached(san);
+
+            std::uint64_t key = 0;
+            for (std::size_t i = 0; i < san.size(); ++i) key |= std::uint64_t(std::uint8_t(san[i])) << (8 * i);
+
+            auto index = static_cast<std::size_t>((key * 0x9E3779B97F4A7C15ull) >> (64 - BITS));
+
+            for (std::size_t i = 0; i < MAX_PROBES; ++i, index = (index + 1) & (SIZE - 1)) {
+                auto& entry = entries_[index];
+
+                if (entry.key == key) return entry.valid ? &entry.info : nullptr;
+
+                if (entry.key == 0) {
+                    entry.key   = key;
+                    entry.valid = parseSanInfo(san, entry.info);
+                    return entry.valid ? &entry.info : nullptr;
+                }
+            }
+
+            // too crowded around this slot, don't cache
+            return parseUncached(san);
         }
-#endif
+
+        const SanMoveInformation* parseUncached(std::string_view san) noexcept {
+            uncached_ = SanMoveInformation();
+            return parseSanInfo(san, uncached_) ? &uncached_ : nullptr;
+        }
+
+        std::vector<Entry> entries_;
+        SanMoveInformation uncached_;
+    };
+
+   private:
+    // finds the legal move matching the tokenized san
+    static SanError resolveSan(const Board& board, const SanMoveInformation& info, Move& move,
+                               Movelist& moves) noexcept {
+        if (info.castling_short || info.castling_long) {
+            const auto stm    = board.sideToMove();
+            const auto side   = info.castling_short ? Board::CastlingRights::Side::KING_SIDE
+                                                    : Board::CastlingRights::Side::QUEEN_SIDE;
+            const auto rights = board.castlingRights();
+
+            if (info.capture || !rights.has(stm, side)) return SanError::ILLEGAL_CASTLING;
+
+            const auto king     = board.kingSq(stm);
+            const auto rook     = Square(rights.getRookFile(stm, side), king.rank());
+            const auto castling = Move::make<Move::CASTLING>(king, rook);
+
+            if (!movegen::isLegal(board, castling)) return SanError::ILLEGAL_CASTLING;
+
+            moves.add(castling);
+            move = castling;
+            return SanError::NONE;
+        }
+
+        sanCandidates(board, info, moves);
+
+        if (moves.size() > 1) return SanError::AMBIGUOUS;
+        if (moves.empty()) return SanError::ILLEGAL_MOVE;
+
+        move = moves[0];
+        return SanError::NONE;
+    }
+
+    // returns false if the string is not valid san
+    static bool parseSanInfo(std::string_view san, SanMoveInformation& info) noexcept {
+        if (san.length() < 2) return false;
+
         constexpr auto parse_castle = [](std::string_view& san, SanMoveInformation& info, char castling_char) {
             info.piece = PieceType::KING;
 
@@ -325,23 +571,19 @@ class uci {
         static constexpr auto isFile = [](char c) { return c >= 'a' && c <= 'h'; };
         static constexpr auto sw     = [](const char& c) { return std::string_view(&c, 1); };
 
-        SanMoveInformation info;
-        bool throw_error = false;
-
         // set to 1 to skip piece type offset
         std::size_t index = 1;
 
         if (san[0] == 'O' || san[0] == '0') {
+            if (san.length() < 3) return false;
             parse_castle(san, info, san[0]);
-            return info;
+            return info.castling_short || info.castling_long;
         } else if (isFile(san[0])) {
             index--;
             info.piece = PieceType::PAWN;
         } else {
             info.piece = PieceType(san);
-            if (info.piece == PieceType::NONE) {
-                throw_error = true;
-            }
+            if (info.piece == PieceType::NONE) return false;
         }
 
         File file_to = File::NO_FILE;
@@ -380,10 +622,12 @@ class uci {
         // promotion
         if (index < san.size() && san[index] == '=') {
             index++;
+            if (index == san.size()) return false;
+
             info.promotion = PieceType(sw(san[index]));
             if (info.promotion == PieceType::KING || info.promotion == PieceType::PAWN ||
                 info.promotion == PieceType::NONE) {
-                throw_error = true;
+                return false;
             }
             index++;
         }
@@ -403,158 +647,468 @@ class uci {
             info.from_file = file_to;
         }
 
-        if (file_to != File::NO_FILE && rank_to != Rank::NO_RANK) {
-            info.to = Square(file_to, rank_to);
-        } else {
-            throw_error = true;
-        }
+        if (file_to == File::NO_FILE || rank_to == Rank::NO_RANK) return false;
 
-#ifndef CHESS_NO_EXCEPTIONS
-        if (throw_error) {
-            throw SanParseError("Failed to parse san. At step 1: " + std::string(san));
-        }
-#endif
+        info.to = Square(file_to, rank_to);
 
         if (info.from_file != File::NO_FILE && info.from_rank != Rank::NO_RANK) {
             info.from = Square(info.from_file, info.from_rank);
         }
 
-        return info;
+        return true;
     }
 
-    template <bool LAN = false>
-    static void moveToRep(Board board, const Move& move, std::string& str) {
-        if (handleCastling(move, str)) {
-            board.makeMove(move);
-            if (board.inCheck()) appendCheckSymbol(board, str);
+    // Adds the legal moves matching the san information to moves. Instead of generating all moves,
+    // the origin squares are found by looking backwards from the destination square.
+    static void sanCandidates(const Board& board, const SanMoveInformation& info, Movelist& moves) {
+        const auto to = info.to;
+
+        if (to == Square::NO_SQ) return;
+
+        const auto stm    = board.sideToMove();
+        const auto target = board.at(to);
+        const auto occ    = board.occ();
+
+        // the capture sign has to match the destination square
+        const bool is_ep = info.piece == PieceType::PAWN && info.capture && target == Piece::NONE &&
+                           to == board.enpassantSq();
+
+        if (info.capture ? (target == Piece::NONE && !is_ep) || target.color() == stm : target != Piece::NONE) {
             return;
         }
 
+        Bitboard from = board.pieces(info.piece, stm);
+
+        switch (info.piece.internal()) {
+            case PieceType::PAWN: {
+                if (info.capture) {
+                    // squares from which our pawns attack the destination
+                    from &= attacks::pawn(~stm, to);
+                } else {
+                    // no pawn can push to our own back rank
+                    if (Square::back_rank(to, stm)) return;
+
+                    const auto down = make_direction(Direction::SOUTH, stm);
+                    const auto one  = to + down;
+
+                    if (board.at(one) == Piece::NONE && to.rank() == Rank::rank(Rank::RANK_4, stm)) {
+                        from &= Bitboard::fromSquare(one + down);
+                    } else {
+                        from &= Bitboard::fromSquare(one);
+                    }
+                }
+
+                break;
+            }
+            case PieceType::KNIGHT:
+                from &= attacks::knight(to);
+                break;
+            case PieceType::BISHOP:
+                from &= attacks::bishop(to, occ);
+                break;
+            case PieceType::ROOK:
+                from &= attacks::rook(to, occ);
+                break;
+            case PieceType::QUEEN:
+                from &= attacks::queen(to, occ);
+                break;
+            case PieceType::KING:
+                from &= attacks::king(to);
+                break;
+            default:
+                return;
+        }
+
+        if (info.from_file != File::NO_FILE) from &= Bitboard(info.from_file);
+        if (info.from_rank != Rank::NO_RANK) from &= Bitboard(info.from_rank);
+
+        const bool promoting = info.piece == PieceType::PAWN && to.rank() == Rank::rank(Rank::RANK_8, stm);
+
+        // a promotion piece only makes sense for a pawn reaching the last rank
+        if (info.promotion != PieceType::NONE && !promoting) return;
+
+        while (from) {
+            const auto sq = Square(from.pop());
+
+            if (promoting) {
+                // without a promotion piece every promotion matches, which makes the san ambiguous
+                for (const auto pt : {PieceType::QUEEN, PieceType::ROOK, PieceType::BISHOP, PieceType::KNIGHT}) {
+                    if (info.promotion != PieceType::NONE && info.promotion != pt) continue;
+
+                    const auto move = Move::make<Move::PROMOTION>(sq, to, pt);
+                    if (movegen::isLegal(board, move)) moves.add(move);
+                }
+            } else {
+                const auto move = is_ep ? Move::make<Move::ENPASSANT>(sq, to) : Move::make(sq, to);
+                if (movegen::isLegal(board, move)) moves.add(move);
+            }
+        }
+    }
+
+    template <bool LAN = false>
+    static std::size_t writeRep(const Board& board, const Move& move, char* out) {
+        char* p = writeMoveText<LAN>(board, move, out);
+
+        if (board.givesCheck(move) != CheckType::NO_CHECK) {
+            *p++ = givesMate(board, move) ? '#' : '+';
+        }
+
+        return static_cast<std::size_t>(p - out);
+    }
+
+    // Writes everything but the check symbol
+    template <bool LAN>
+    static char* writeMoveText(const Board& board, const Move& move, char* p) {
+        if (move.typeOf() == Move::CASTLING) {
+            const bool king_side = move.to().file() > move.from().file();
+            const auto length    = king_side ? 3 : 5;
+
+            std::memcpy(p, "O-O-O", length);
+            return p + length;
+        }
+
         const PieceType pt   = board.at(move.from()).type();
         const bool isCapture = board.at(move.to()) != Piece::NONE || move.typeOf() == Move::ENPASSANT;
 
         assert(pt != PieceType::NONE);
 
         if (pt != PieceType::PAWN) {
-            appendPieceSymbol(pt, str);
+            *p++ = pieceSymbol(pt);
         }
 
         if constexpr (LAN) {
-            appendSquare(move.from(), str);
+            p = writeSquare(move.from(), p);
         } else {
             if (pt == PieceType::PAWN) {
-                str += isCapture ? static_cast<std::string>(move.from().file()) : "";
+                if (isCapture) *p++ = fileSymbol(move.from().file());
             } else {
-                resolveAmbiguity(board, move, pt, str);
+                p = writeDisambiguation(board, move, pt, p);
             }
         }
 
         if (isCapture) {
-            str += 'x';
+            *p++ = 'x';
         }
 
-        appendSquare(move.to(), str);
+        p = writeSquare(move.to(), p);
 
-        if (move.typeOf() == Move::PROMOTION) appendPromotion(move, str);
-
-        board.makeMove(move);
+        if (move.typeOf() == Move::PROMOTION) {
+            *p++ = '=';
+            *p++ = pieceSymbol(move.promotionType());
+        }
 
-        if (board.inCheck()) appendCheckSymbol(board, str);
+        return p;
     }
 
-    static bool handleCastling(const Move& move, std::string& str) {
-        if (move.typeOf() != Move::CASTLING) return false;
+    // Legality of a normal move or promotion. Instead of building the check and pin masks like
+    // movegen::isLegal, the king is tested for attackers on the occupancy after the move.
+    static bool isLegalNormal(const Board& board, const Move& move, PieceType pt) noexcept {
+        const auto us       = board.sideToMove();
+        const auto from     = move.from();
+        const auto to       = move.to();
+        const auto piece    = board.at(from);
+        const auto captured = board.at(to);
+        const auto occ      = board.occ();
+
+        if (piece == Piece::NONE || piece.color() != us) return false;
+        if (captured != Piece::NONE && (captured.color() == us || captured.type() == PieceType::KING)) return false;
+
+        switch (pt) {
+            case PieceType(PieceType::PAWN): {
+                // should reach the last rank iff promoting
+                if (Square::back_rank(to, ~us) != (move.typeOf() == Move::PROMOTION)) return false;
+
+                if (captured != Piece::NONE) {
+                    if (!attacks::pawn(us, from).check(to.index())) return false;
+                    break;
+                }
+
+                const auto up   = us == Color::WHITE ? 8 : -8;
+                const auto step = to.index() - from.index();
+
+                if (step == up) break;
+                if (step == 2 * up && from.rank() == Rank::rank(Rank::RANK_2, us) &&
+                    board.at(Square(from.index() + up)) == Piece::NONE)
+                    break;
+
+                return false;
+            }
+            case PieceType(PieceType::KNIGHT):
+                if (!attacks::knight(from).check(to.index())) return false;
+                break;
+            case PieceType(PieceType::BISHOP):
+                if (!attacks::bishop(from, occ).check(to.index())) return false;
+                break;
+            case PieceType(PieceType::ROOK):
+                if (!attacks::rook(from, occ).check(to.index())) return false;
+                break;
+            case PieceType(PieceType::QUEEN):
+                if (!attacks::queen(from, occ).check(to.index())) return false;
+                break;
+            case PieceType(PieceType::KING):
+                if (!attacks::king(from).check(to.index())) return false;
+                break;
+            default:
+                return false;
+        }
+
+        // our king should not be attacked once the move is made, a captured piece no longer attacks
+        const auto to_bb     = Bitboard::fromSquare(to);
+        const auto occ_after = (occ ^ Bitboard::fromSquare(from)) | to_bb;
+        const auto them      = board.them(us) & ~to_bb;
+        const auto king_sq   = pt == PieceType::KING ? to : board.kingSq(us);
+        const auto diagonal  = board.pieces(PieceType::BISHOP, PieceType::QUEEN) & them;
+        const auto straight  = board.pieces(PieceType::ROOK, PieceType::QUEEN) & them;
+
+        if (attacks::pawn(us, king_sq) & board.pieces(PieceType::PAWN) & them) return false;
+        if (attacks::knight(king_sq) & board.pieces(PieceType::KNIGHT) & them) return false;
+        if (attacks::king(king_sq) & board.pieces(PieceType::KING) & them) return false;
+        if (attacks::bishop(king_sq, occ_after) & diagonal) return false;
+        if (attacks::rook(king_sq, occ_after) & straight) return false;
 
-        str = (move.to().file() > move.from().file()) ? "O-O" : "O-O-O";
         return true;
     }
 
-    static void appendPieceSymbol(PieceType pieceType, std::string& str) {
-        str += std::toupper(static_cast<std::string>(pieceType)[0]);
+    // two characters per square, a1 first
+    static constexpr char SQUARE_NAMES[] =
+        "a1b1c1d1e1f1g1h1a2b2c2d2e2f2g2h2a3b3c3d3e3f3g3h3a4b4c4d4e4f4g4h4"
+        "a5b5c5d5e5f5g5h5a6b6c6d6e6f6g6h6a7b7c7d7e7f7g7h7a8b8c8d8e8f8g8h8";
+
+    // n, b, r, q -> 0..3 as stored in the move encoding, anything else -> 4
+    static std::uint16_t promotionIndex(char c) noexcept {
+        switch (c) {
+            case 'n':
+                return 0;
+            case 'b':
+                return 1;
+            case 'r':
+                return 2;
+            case 'q':
+                return 3;
+            default:
+                return 4;
+        }
     }
 
-    static void appendSquare(Square square, std::string& str) {
-        str += static_cast<std::string>(square.file());
-        str += static_cast<std::string>(square.rank());
-    }
+    static char pieceSymbol(PieceType pt) noexcept { return "PNBRQK"[static_cast<int>(pt)]; }
 
-    static void appendPromotion(const Move& move, std::string& str) {
-        str += '=';
-        str += std::toupper(static_cast<std::string>(move.promotionType())[0]);
+    static char fileSymbol(File file) noexcept { return static_cast<char>('a' + static_cast<int>(file)); }
+
+    static char* writeSquare(Square square, char* p) noexcept {
+        *p++ = fileSymbol(square.file());
+        *p++ = static_cast<char>('1' + static_cast<int>(square.rank()));
+        return p;
     }
 
-    static void appendCheckSymbol(Board& board, std::string& str) {
-        const auto gameState = board.isGameOver().second;
-        str += (gameState == GameResult::LOSE) ? '#' : '+';
+    // Only called for moves which give check. The move is played on a scratch board
+    // which copies the position but not the move history of the board.
+    static bool givesMate(const Board& board, const Move& move) {
+        thread_local Board scratch;
+
+        scratch.copyPosition(board);
+        scratch.makeMove(move);
+
+        return !movegen::anylegalmoves(scratch);
     }
 
-    static void resolveAmbiguity(const Board& board, const Move& move, PieceType pieceType, std::string& str) {
-        Movelist moves;
-        movegen::legalmoves(moves, board, 1 << pieceType);
+    // Writes the file, rank or square of the origin if another piece of the same type can legally move to the
+    // destination.
+    static char* writeDisambiguation(const Board& board, const Move& move, PieceType pt, char* p) {
+        const auto from = move.from();
+        const auto to   = move.to();
+        const auto occ  = board.occ();
+
+        Bitboard others;
+
+        switch (pt.internal()) {
+            case PieceType::KNIGHT:
+                others = attacks::knight(to);
+                break;
+            case PieceType::BISHOP:
+                others = attacks::bishop(to, occ);
+                break;
+            case PieceType::ROOK:
+                others = attacks::rook(to, occ);
+                break;
+            case PieceType::QUEEN:
+                others = attacks::queen(to, occ);
+                break;
+            default:
+                return p;
+        }
 
-        bool needFile         = false;
-        bool needRank         = false;
-        bool hasAmbiguousMove = false;
+        others &= board.pieces(pt, board.sideToMove());
+        others.clear(from.index());
 
-        for (const auto& m : moves) {
-            if (m != move && m.to() == move.to()) {
-                hasAmbiguousMove = true;
+        /*
+        First, if the moving pieces can be distinguished by their originating files, the originating
+        file letter of the moving piece is inserted immediately after the moving piece letter.
 
-                /*
-                First, if the moving pieces can be distinguished by their originating files, the originating
-                file letter of the moving piece is inserted immediately after the moving piece letter.
+        Second (when the first step fails), if the moving pieces can be distinguished by their
+        originating ranks, the originating rank digit of the moving piece is inserted immediately after
+        the moving piece letter.
 
-                Second (when the first step fails), if the moving pieces can be distinguished by their
-                originating ranks, the originating rank digit of the moving piece is inserted immediately after
-                the moving piece letter.
+        Third (when both the first and the second steps fail), the two character square coordinate of
+        the originating square of the moving piece is inserted immediately after the moving piece
+        letter.
+        */
 
-                Third (when both the first and the second steps fail), the two character square coordinate of
-                the originating square of the moving piece is inserted immediately after the moving piece
-                letter.
-                */
+        bool ambiguous = false;
+        bool same_file = false;
+        bool same_rank = false;
 
-                if (isIdentifiableByType(moves, move, move.from().file())) {
-                    needFile = true;
-                    break;
-                }
+        while (others) {
+            const auto sq = Square(others.pop());
 
-                if (isIdentifiableByType(moves, move, move.from().rank())) {
-                    needRank = true;
-                    break;
-                }
-            }
+            if (!movegen::isLegal(board, Move::make(sq, to))) continue;
+
+            ambiguous = true;
+            same_file |= sq.file() == from.file();
+            same_rank |= sq.rank() == from.rank();
         }
 
-        if (needFile) str += static_cast<std::string>(move.from().file());
-        if (needRank) str += static_cast<std::string>(move.from().rank());
+        if (!ambiguous) return p;
 
-        // we weren't able to disambiguate the move by either file or rank, so we need to use both
-        if (hasAmbiguousMove && !needFile && !needRank) {
-            appendSquare(move.from(), str);
+        if (!same_file) {
+            *p++ = fileSymbol(from.file());
+        } else if (!same_rank) {
+            *p++ = static_cast<char>('1' + static_cast<int>(from.rank()));
+        } else {
+            p = writeSquare(from, p);
         }
+
+        return p;
     }
+};
+
+/**
+ * @brief Applies UCI "position" commands to a board. GUIs resend the whole game with every
+ * command, usually with one or two moves more than last time. Only the moves after the common
+ * prefix with the previous command are made (or unmade on a takeback), so the cost of a command
+ * does not grow with the length of the game.
+ */
+class UciPosition {
+   public:
+    explicit UciPosition(bool chess960 = false) : board_(constants::STARTPOS, chess960) {}
+
+    /**
+     * @brief Applies a command like "position startpos moves e2e4 e7e5" or
+     * "position fen <fen> moves e2e4". The leading "position" is optional.
+     * @param command
+     * @return false if the position or one of the moves is invalid. The board then holds the
+     * position before the invalid move.
+     */
+    bool set(std::string_view command) {
+        command = trim(command);
+        if (command.substr(0, 8) == "position") command = trim(command.substr(8));
+
+        std::string_view base  = command;
+        std::string_view moves = {};
 
-    template <typename CoordinateType>
-    static bool isIdentifiableByType(const Movelist& moves, const Move move, CoordinateType type) {
-        static_assert(std::is_same_v<CoordinateType, File> || std::is_same_v<CoordinateType, Rank>,
-                      "CoordinateType must be either File or Rank");
+        if (const auto pos = command.find("moves"); pos != std::string_view::npos) {
+            base  = trim(command.substr(0, pos));
+            moves = command.substr(pos + 5);
+        }
+
+        if (base != base_) {
+            std::string_view fen;
 
-        for (const auto& m : moves) {
-            if (m == move || m.to() != move.to()) {
-                continue;
+            if (base == "startpos") {
+                fen = constants::STARTPOS;
+            } else if (base.substr(0, 4) == "fen ") {
+                fen = trim(base.substr(4));
+            } else {
+                return false;
             }
 
-            // file
-            if constexpr (std::is_same_v<CoordinateType, File>) {
-                if (type == m.from().file()) return false;
+            moves_.clear();
+            text_.clear();
+
+            if (!board_.setFen(fen)) {
+                base_.clear();
+                return false;
             }
-            // rank
-            else {
-                if (type == m.from().rank()) return false;
+
+            base_ = std::string(base);
+        }
+
+        std::size_t common = 0;
+        std::size_t next   = 0;
+
+        // fast path, the new moves extend the old ones
+        if (moves.size() > text_.size() && moves[0] == ' ' && moves.substr(1, text_.size()) == text_ &&
+            (moves.size() == text_.size() + 1 || moves[text_.size() + 1] == ' ')) {
+            common = moves_.size();
+            next   = text_.size() + 1;
+        } else {
+            std::size_t old_pos = 0;
+            std::size_t keep    = 0;
+
+            while (common < moves_.size()) {
+                const auto old_token = nextToken(text_, old_pos);
+                auto new_pos         = next;
+                const auto new_token = nextToken(moves, new_pos);
+
+                if (old_token != new_token) break;
+
+                common++;
+                keep = old_pos;
+                next = new_pos;
+            }
+
+            while (moves_.size() > common) {
+                board_.unmakeMove(moves_.back());
+                moves_.pop_back();
             }
+
+            text_.resize(keep);
+        }
+
+        for (auto token = nextToken(moves, next); !token.empty(); token = nextToken(moves, next)) {
+            const auto move = uci::uciToMoveChecked(board_, token);
+            if (move == Move::NO_MOVE) return false;
+
+            board_.makeMove<true>(move);
+            moves_.push_back(move);
+
+            if (!text_.empty()) text_ += ' ';
+            text_ += token;
         }
 
         return true;
     }
+
+    /**
+     * @brief The position after the last command.
+     * @return
+     */
+    [[nodiscard]] const Board& board() const noexcept { return board_; }
+
+    /**
+     * @brief The moves played from the base position of the last command.
+     * @return
+     */
+    [[nodiscard]] const std::vector<Move>& moves() const noexcept { return moves_; }
+
+   private:
+    static std::string_view trim(std::string_view str) noexcept {
+        const auto first = str.find_first_not_of(" \t\r\n");
+        if (first == std::string_view::npos) return {};
+        const auto last = str.find_last_not_of(" \t\r\n");
+        return str.substr(first, last - first + 1);
+    }
+
+    // returns the token starting at or after pos and moves pos behind it
+    static std::string_view nextToken(std::string_view str, std::size_t& pos) noexcept {
+        while (pos < str.size() && str[pos] == ' ') pos++;
+        const auto start = pos;
+        while (pos < str.size() && str[pos] != ' ') pos++;
+        return str.substr(start, pos - start);
+    }
+
+    Board board_;
+    std::string base_;
+    std::string text_;  // applied moves, separated by single spaces
+    std::vector<Move> moves_;
 };
 }  // namespace chess
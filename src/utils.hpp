@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstdint>
 #include <string_view>
 #include <vector>
 
@@ -26,6 +27,33 @@ namespace utils {
 
 constexpr char tolower(char c) { return (c >= 'A' && c <= 'Z') ? (c - 'A' + 'a') : c; }
 
+// LEB128 varint, 7 bits per byte starting with the lowest, put(std::uint8_t) is called for every byte
+template <typename Put>
+void writeVarint(std::uint64_t value, Put&& put) {
+    while (value >= 0x80) {
+        put(static_cast<std::uint8_t>((value & 0x7F) | 0x80));
+        value >>= 7;
+    }
+
+    put(static_cast<std::uint8_t>(value));
+}
+
+// get(std::uint8_t&) returns false at the end of the data, false if the varint is cut off or too long
+template <typename Get>
+[[nodiscard]] bool readVarint(std::uint64_t& value, Get&& get) {
+    value = 0;
+
+    for (int shift = 0; shift < 64; shift += 7) {
+        std::uint8_t byte;
+        if (!get(byte)) return false;
+
+        value |= static_cast<std::uint64_t>(byte & 0x7F) << shift;
+        if (!(byte & 0x80)) return true;
+    }
+
+    return false;
+}
+
 }  // namespace utils
 
 }  // namespace chess
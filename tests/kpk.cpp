@@ -0,0 +1,175 @@
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "../src/include.hpp"
+#include "doctest/doctest.hpp"
+#include "random_position.hpp"
+
+using namespace chess;
+
+namespace {
+
+// the retrograde analysis kpk::BITS was generated with, the positions are indexed like in kpk
+constexpr std::size_t SIZE = 2 * 24 * 64 * 64;
+
+enum Result : std::uint8_t { INVALID = 0, UNKNOWN = 1, DRAW = 2, WIN = 4 };
+
+std::size_t index(Color stm, int bk, int wk, int wp) noexcept {
+    return wk | (bk << 6) | (static_cast<int>(stm) << 12) | ((wp & 7) << 13) | ((6 - (wp >> 3)) << 15);
+}
+
+void decode(std::size_t idx, Color& stm, int& bk, int& wk, int& wp) noexcept {
+    wk  = idx & 63;
+    bk  = (idx >> 6) & 63;
+    stm = Color(static_cast<int>((idx >> 12) & 1));
+    wp  = (6 - static_cast<int>(idx >> 15)) * 8 + static_cast<int>((idx >> 13) & 3);
+}
+
+// results that follow from the position itself
+Result initial(std::size_t idx) {
+    Color stm;
+    int bk, wk, wp;
+    decode(idx, stm, bk, wk, wp);
+
+    const auto pawn_attacks = attacks::pawn(Color::WHITE, wp);
+
+    if (Square::distance(wk, bk) <= 1 || wk == wp || bk == wp) return INVALID;
+    if (stm == Color::WHITE && pawn_attacks.check(bk)) return INVALID;
+
+    // the pawn promotes and the queen can't be taken
+    const auto promotion = wp + 8;
+
+    if (stm == Color::WHITE && (wp >> 3) == 6 && wk != promotion && bk != promotion &&
+        (Square::distance(bk, promotion) > 1 || Square::distance(wk, promotion) == 1)) {
+        return WIN;
+    }
+
+    // stalemate or the pawn is lost
+    if (stm == Color::BLACK) {
+        const auto king  = attacks::king(bk);
+        const auto guard = attacks::king(wk);
+
+        if (!(king & ~(guard | pawn_attacks)) || (king & ~guard).check(wp)) return DRAW;
+    }
+
+    return UNKNOWN;
+}
+
+Result classify(const std::vector<std::uint8_t>& db, std::size_t idx) {
+    Color stm;
+    int bk, wk, wp;
+    decode(idx, stm, bk, wk, wp);
+
+    int reached = INVALID;
+    auto moves  = attacks::king(stm == Color::WHITE ? wk : bk);
+
+    while (moves) {
+        const int to = moves.pop();
+        reached |= stm == Color::WHITE ? db[index(Color::BLACK, bk, to, wp)] : db[index(Color::WHITE, to, wk, wp)];
+    }
+
+    if (stm == Color::WHITE) {
+        const auto push = wp + 8;
+
+        if ((wp >> 3) < 6) reached |= db[index(Color::BLACK, bk, wk, push)];
+        if ((wp >> 3) == 1 && push != wk && push != bk) reached |= db[index(Color::BLACK, bk, wk, push + 8)];
+    }
+
+    const auto good = stm == Color::WHITE ? WIN : DRAW;
+    const auto bad  = stm == Color::WHITE ? DRAW : WIN;
+
+    return reached & good ? good : reached & UNKNOWN ? UNKNOWN : bad;
+}
+
+std::vector<std::uint8_t> generate() {
+    std::vector<std::uint8_t> db(SIZE);
+
+    for (std::size_t idx = 0; idx < SIZE; ++idx) db[idx] = initial(idx);
+
+    // a position is decided once one move reaches a good result or all moves a bad one
+    bool changed = true;
+
+    while (changed) {
+        changed = false;
+
+        for (std::size_t idx = 0; idx < SIZE; ++idx) {
+            if (db[idx] != UNKNOWN) continue;
+
+            db[idx] = classify(db, idx);
+            changed |= db[idx] != UNKNOWN;
+        }
+    }
+
+    return db;
+}
+
+}  // namespace
+
+TEST_SUITE("KPK Bitbase") {
+    TEST_CASE("Other material") {
+        CHECK(!kpk::probe(Board()));
+        CHECK(!kpk::probe(Board("8/8/8/3k4/8/8/8/KR6 w - - 0 1")));
+        CHECK(!kpk::probe(Board("8/8/8/3k4/8/8/PP6/K7 w - - 0 1")));
+        CHECK(!kpk::probe(Board("8/8/8/3k4/8/8/P7/KR6 w - - 0 1")));
+        CHECK(!kpk::probe(Board("8/8/8/3k4/8/8/8/K7 w - - 0 1")));
+
+        // illegal positions
+        CHECK(!kpk::probe(Board("7P/8/8/3k4/8/8/8/K7 w - - 0 1")));
+        CHECK(!kpk::probe(Board("8/8/8/3k4/8/8/8/K6P w - - 0 1")));
+        CHECK(!kpk::probe(Board("7p/8/8/3k4/8/8/8/K7 b - - 0 1")));
+        CHECK(!kpk::probe(Board("8/8/8/3k4/8/8/8/K6p b - - 0 1")));
+        CHECK(!kpk::probe(Board("8/8/8/3k4/4P3/8/8/K7 w - - 0 1")));
+        CHECK(!kpk::probe(Board("8/8/8/8/8/8/7P/Kk6 w - - 0 1")));
+    }
+
+    TEST_CASE("Known positions") {
+        // the rook pawn with the defending king in front
+        CHECK(kpk::probe(Board("8/8/8/8/8/k7/P7/K7 w - - 0 1")) == GameResult::DRAW);
+
+        // opposition in front of the pawn
+        CHECK(kpk::probe(Board("8/4k3/8/4K3/4P3/8/8/8 w - - 0 1")) == GameResult::DRAW);
+        CHECK(kpk::probe(Board("8/4k3/8/4K3/4P3/8/8/8 b - - 0 1")) == GameResult::LOSE);
+
+        // the defending king is outside the square of the pawn
+        CHECK(kpk::probe(Board("8/8/8/8/P7/5k2/8/K7 w - - 0 1")) == GameResult::WIN);
+        CHECK(kpk::probe(Board("8/8/8/8/P7/5k2/8/K7 b - - 0 1")) == GameResult::DRAW);
+
+        // the same with colors swapped
+        CHECK(kpk::probe(Board("k7/8/5K2/p7/8/8/8/8 b - - 0 1")) == GameResult::WIN);
+        CHECK(kpk::probe(Board("k7/8/5K2/p7/8/8/8/8 w - - 0 1")) == GameResult::DRAW);
+    }
+
+    TEST_CASE("Embedded bits match the retrograde analysis") {
+        const auto db = generate();
+        int checked   = 0;
+        int wrong     = 0;
+
+        for (std::size_t idx = 0; idx < SIZE; ++idx) {
+            if (db[idx] == INVALID) continue;
+
+            Color stm;
+            int bk, wk, wp;
+            decode(idx, stm, bk, wk, wp);
+
+            wrong += kpk::isWin(Square(wk), Square(wp), Square(bk), stm) != (db[idx] == WIN);
+            checked++;
+        }
+
+        CHECK(checked > 0);
+        CHECK(wrong == 0);
+    }
+
+    TEST_CASE("Agrees with the tablebase") {
+        Tablebase tablebase;
+        PlayoutRng rng(5);
+
+        for (int i = 0; i < 20000; ++i) {
+            const auto board    = randomPosition(i % 2 ? "KPk" : "Kkp", rng);
+            const auto expected = tablebase.probe(board);
+
+            REQUIRE(expected);
+            CHECK(kpk::probe(board) == expected->result);
+        }
+    }
+}
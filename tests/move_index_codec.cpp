@@ -0,0 +1,102 @@
+#include "../src/include.hpp"
+#include "doctest/doctest.hpp"
+
+using namespace chess;
+
+namespace {
+std::vector<Move> randomGame(Board board, int plies, std::uint64_t seed) {
+    std::vector<Move> game;
+
+    for (int i = 0; i < plies; ++i) {
+        Movelist moves;
+        movegen::legalmoves(moves, board);
+        if (moves.empty()) break;
+
+        seed ^= seed << 13;
+        seed ^= seed >> 7;
+        seed ^= seed << 17;
+
+        game.push_back(moves[seed % moves.size()]);
+        board.makeMove(game.back());
+    }
+
+    return game;
+}
+}  // namespace
+
+TEST_SUITE("Move Index Codec") {
+    TEST_CASE("Round trip random games") {
+        const auto board = Board{constants::STARTPOS};
+
+        std::vector<std::uint8_t> data;
+        std::size_t plies = 0;
+
+        for (std::uint64_t seed = 1; seed <= 50; ++seed) {
+            const auto game = randomGame(board, 300, seed);
+            plies += game.size();
+
+            std::vector<std::uint8_t> encoded;
+            REQUIRE(MoveIndexCodec::encode(board, game, encoded));
+
+            std::vector<Move> decoded;
+            CHECK(MoveIndexCodec::decode(board, encoded, decoded) == encoded.size());
+            CHECK(decoded == game);
+
+            data.insert(data.end(), encoded.begin(), encoded.end());
+        }
+
+        // well below the 16 bits of a Move
+        CHECK(data.size() * 8 < plies * 7);
+    }
+
+    TEST_CASE("Games can be read one after another") {
+        const auto board = Board{"r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 1", false};
+
+        const auto first  = randomGame(board, 40, 7);
+        const auto second = randomGame(board, 25, 8);
+
+        std::vector<std::uint8_t> data;
+        REQUIRE(MoveIndexCodec::encode(board, first, data));
+        REQUIRE(MoveIndexCodec::encode(board, second, data));
+
+        std::vector<Move> decoded;
+        const auto read = MoveIndexCodec::decode(board, data, decoded);
+        REQUIRE(read > 0);
+        CHECK(decoded == first);
+
+        decoded.clear();
+        CHECK(MoveIndexCodec::decode(board, data.data() + read, data.size() - read, decoded) == data.size() - read);
+        CHECK(decoded == second);
+    }
+
+    TEST_CASE("Known encoding") {
+        const auto board = Board{constants::STARTPOS};
+        const std::vector<Move> game = {Move::make(Square::SQ_E2, Square::SQ_E4)};
+
+        std::vector<std::uint8_t> data;
+        REQUIRE(MoveIndexCodec::encode(board, game, data));
+
+        // one ply, then the index of e2e4 among 20 moves in 5 bits
+        REQUIRE(data.size() == 2);
+        CHECK(data[0] == 1);
+        CHECK(data[1] < 20);
+    }
+
+    TEST_CASE("Rejects illegal moves and corrupt data") {
+        const auto board = Board{constants::STARTPOS};
+
+        std::vector<std::uint8_t> data = {42};
+        CHECK_FALSE(MoveIndexCodec::encode(board, {Move::make(Square::SQ_E2, Square::SQ_E5)}, data));
+        CHECK(data == std::vector<std::uint8_t>{42});
+
+        std::vector<Move> decoded;
+
+        // index 31 is out of range for 20 moves
+        CHECK(MoveIndexCodec::decode(board, std::vector<std::uint8_t>{1, 31}, decoded) == 0);
+        // two plies announced but only one stored
+        CHECK(MoveIndexCodec::decode(board, std::vector<std::uint8_t>{2, 3}, decoded) == 0);
+        // unterminated varint
+        CHECK(MoveIndexCodec::decode(board, std::vector<std::uint8_t>{0x80}, decoded) == 0);
+        CHECK(decoded.empty());
+    }
+}
@@ -1,6 +1,7 @@
 #include <chrono>
 #include <iomanip>
 #include <sstream>
+#include <thread>
 #include <tuple>
 
 #include "../src/include.hpp"
@@ -117,3 +118,43 @@ TEST_SUITE("PERFT") {
         }
     }
 }
+
+TEST_SUITE("Movegen stats") {
+    TEST_CASE("Counters") {
+        MovegenStats::reset();
+
+        // double check by the rook on e8 and the knight on d3
+        const auto board = Board("4r1k1/8/8/8/8/3n4/8/4K3 w - - 0 1");
+
+        Movelist moves;
+        movegen::legalmoves(moves, board);
+
+        const auto illegal = movegen::isLegal(board, Move::make(Square::SQ_E1, Square::SQ_E2));
+
+        // a second thread counts into its own slot, which is kept after it exits
+        std::thread([]() {
+            Movelist moves;
+            movegen::legalmoves(moves, Board());
+        }).join();
+
+        const auto stats = MovegenStats::collect();
+
+        CHECK(moves.size() == 3);
+        CHECK(!illegal);
+
+#ifdef CHESS_STATS
+        CHECK(stats.generations == 2);
+        CHECK(stats.double_check_exits == 1);
+        CHECK(stats.is_legal == 1);
+        CHECK(stats.is_legal_false == 1);
+        CHECK(stats.movelist_sizes[3] == 1);
+        CHECK(stats.movelist_sizes[20] == 1);
+        CHECK(stats.seen_squares >= 2);
+#else
+        CHECK(stats.generations == 0);
+        CHECK(stats.double_check_exits == 0);
+        CHECK(stats.is_legal == 0);
+        CHECK(stats.movelist_sizes[3] == 0);
+#endif
+    }
+}
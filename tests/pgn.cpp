@@ -1,6 +1,10 @@
+#include <algorithm>
 #include <cassert>
+#include <cstring>
+#include <filesystem>
 #include <fstream>
 #include <memory>
+#include <sstream>
 #include <string_view>
 
 #include "../src/include.hpp"
@@ -656,3 +660,477 @@ TEST_SUITE("PGN StreamParser") {
         CHECK(vis->headers().size() == 0);
     }
 }
+
+TEST_SUITE("PGN GameIndex") {
+    TEST_CASE("Index matches readGames") {
+        const auto file = "./tests/pgns/multiple.pgn";
+
+        auto file_stream = std::ifstream(file, std::ios::binary);
+        pgn::GameIndex index({"White", "Result"});
+        CHECK(!index.build(file_stream));
+        CHECK(index.size() == 4);
+        CHECK(index[0].offset == 0);
+
+        for (std::size_t i = 1; i < index.size(); i++) {
+            CHECK(index[i].offset == index[i - 1].offset + index[i - 1].length);
+        }
+
+        // every game has to start with its first header
+        file_stream.clear();
+        for (const auto& entry : index.entries()) {
+            file_stream.seekg(entry.offset);
+            CHECK(file_stream.get() == '[');
+        }
+
+        auto full = std::ifstream(file, std::ios::binary);
+        MyVisitor2 all;
+        pgn::StreamParser parser(full);
+        parser.readGames(all);
+
+        // the last game of the file should be the same as the last game read from the index
+        MyVisitor2 single;
+        CHECK(!index.readGame(file_stream, 3, single));
+        CHECK(single.gameCount() == 1);
+        CHECK(single.endCount() == 1);
+        CHECK(single.moves() == all.moves());
+        CHECK(single.comments() == all.comments());
+
+        CHECK(index.header(3, "Result").value() == "1/2-1/2");
+        CHECK(index.header(0, "White").value() == "New-cfe8ce842c");
+        CHECK(!index.header(0, "Black").has_value());
+    }
+
+    TEST_CASE("Read range") {
+        const auto file = "./tests/pgns/multiple.pgn";
+
+        auto file_stream = std::ifstream(file, std::ios::binary);
+        pgn::GameIndex index;
+        index.build(file_stream);
+
+        MyVisitor2 vis;
+        CHECK(!index.readGames(file_stream, 1, 3, vis));
+        CHECK(vis.gameCount() == 3);
+        CHECK(vis.endCount() == 3);
+        CHECK(vis.headers()[4] == "White Base-c4a644922d");
+
+        CHECK(index.readGames(file_stream, 2, 3, vis) == pgn::StreamParserError::NotEnoughData);
+        CHECK(index.readGame(file_stream, 4, vis) == pgn::StreamParserError::NotEnoughData);
+    }
+
+    TEST_CASE("Save and load") {
+        auto file_stream = std::ifstream("./tests/pgns/no_moves_two_games.pgn", std::ios::binary);
+        pgn::GameIndex index({"Event", "Result"});
+        index.build(file_stream);
+
+        std::stringstream ss;
+        CHECK(index.save(ss));
+
+        pgn::GameIndex loaded;
+        CHECK(loaded.load(ss));
+        CHECK(loaded.keys() == index.keys());
+        CHECK(loaded.size() == index.size());
+
+        for (std::size_t i = 0; i < index.size(); i++) {
+            CHECK(loaded[i].offset == index[i].offset);
+            CHECK(loaded[i].length == index[i].length);
+            CHECK(loaded[i].headers == index[i].headers);
+        }
+
+        std::stringstream garbage("not an index");
+        CHECK(!loaded.load(garbage));
+
+        CHECK(!index.header(index.size(), "Event").has_value());
+    }
+
+    TEST_CASE("Load rejects corrupt data") {
+        auto file_stream = std::ifstream("./tests/pgns/no_moves_two_games.pgn", std::ios::binary);
+        pgn::GameIndex index({"Event", "Result"});
+        index.build(file_stream);
+
+        std::stringstream ss;
+        index.save(ss);
+        const auto data = ss.str();
+
+        pgn::GameIndex loaded;
+
+        for (std::size_t length = 0; length < data.size(); length++) {
+            std::stringstream truncated(data.substr(0, length));
+            CHECK(!loaded.load(truncated));
+        }
+
+        // huge counts and string sizes fail at the end of the data instead of being allocated
+        std::stringstream keys(std::string("PGNI\x01\xff\xff\xff\xff\xff\xff\xff\xff\x7f", 14));
+        CHECK(!loaded.load(keys));
+
+        std::stringstream string(std::string("PGNI\x01\x01\xff\xff\xff\xff\xff\xff\xff\x7f" "Event", 19));
+        CHECK(!loaded.load(string));
+
+        std::stringstream games(std::string("PGNI\x01\x00\xff\xff\xff\xff\xff\xff\xff\xff\x7f", 15));
+        CHECK(!loaded.load(games));
+    }
+}
+
+class ChunkedSource : public pgn::InputSource {
+   public:
+    ChunkedSource(std::string data, std::size_t chunk) : data_(std::move(data)), chunk_(chunk) {}
+
+    std::size_t read(char* buffer, std::size_t size) override {
+        const auto n = std::min({size, chunk_, data_.size() - pos_});
+        std::memcpy(buffer, data_.data() + pos_, n);
+        pos_ += n;
+        return n;
+    }
+
+   private:
+    std::string data_;
+    std::size_t chunk_;
+    std::size_t pos_ = 0;
+};
+
+static std::string readFile(const char* file) {
+    auto file_stream = std::ifstream(file, std::ios::binary);
+    std::stringstream ss;
+    ss << file_stream.rdbuf();
+    return ss.str();
+}
+
+TEST_SUITE("PGN InputSource") {
+    TEST_CASE("Custom source with short reads") {
+        auto expected = std::ifstream("./tests/pgns/multiple.pgn");
+        MyVisitor2 all;
+        pgn::StreamParser(expected).readGames(all);
+
+        ChunkedSource source(readFile("./tests/pgns/multiple.pgn"), 7);
+        MyVisitor2 vis;
+        SmallBufferStreamParser parser(source);
+        CHECK(!parser.readGames(vis));
+
+        CHECK(vis.gameCount() == 4);
+        CHECK(vis.endCount() == 4);
+        CHECK(vis.moves() == all.moves());
+        CHECK(vis.comments() == all.comments());
+        CHECK(vis.headers() == all.headers());
+    }
+
+    TEST_CASE("Threaded source") {
+        auto expected = std::ifstream("./tests/pgns/multiple.pgn");
+        MyVisitor2 all;
+        pgn::StreamParser(expected).readGames(all);
+
+        ChunkedSource source(readFile("./tests/pgns/multiple.pgn"), 100);
+        pgn::ThreadedSource threaded(source, 64);
+        MyVisitor2 vis;
+        pgn::StreamParser parser(threaded);
+        CHECK(!parser.readGames(vis));
+
+        CHECK(vis.gameCount() == 4);
+        CHECK(vis.moves() == all.moves());
+        CHECK(vis.headers() == all.headers());
+    }
+
+    TEST_CASE("Threaded source stopped early") {
+        ChunkedSource source(readFile("./tests/pgns/multiple.pgn"), 100);
+        pgn::ThreadedSource threaded(source, 16);
+
+        char buffer[10];
+        CHECK(threaded.read(buffer, sizeof(buffer)) == sizeof(buffer));
+        CHECK(buffer[0] == '[');
+    }
+
+#ifdef CHESS_HAS_ZLIB
+    TEST_CASE("Gzip source") {
+        auto file_stream = std::ifstream("./tests/pgns/basic.pgn.gz", std::ios::binary);
+        pgn::GzipSource source(file_stream);
+
+        auto vis = std::make_unique<MyVisitor>();
+        pgn::StreamParser parser(source);
+        CHECK(!parser.readGames(*vis));
+        CHECK(!source.error());
+
+        CHECK(vis->count() == 130);
+        CHECK(vis->gameCount() == 1);
+        CHECK(vis->moves()[0] == "Bg2");
+        CHECK(vis->comments()[0] == "+1.55/16 0.70s");
+    }
+
+    TEST_CASE("Gzip source with multiple members") {
+        const auto member = readFile("./tests/pgns/basic.pgn.gz");
+        std::stringstream ss(member + member);
+        pgn::GzipSource source(ss);
+
+        auto vis = std::make_unique<MyVisitor>();
+        pgn::StreamParser parser(source);
+        CHECK(!parser.readGames(*vis));
+
+        CHECK(vis->gameCount() == 2);
+        CHECK(vis->endCount() == 2);
+        CHECK(vis->count() == 130);
+        CHECK(!source.error());
+    }
+
+    TEST_CASE("Gzip source with truncated data") {
+        const auto member = readFile("./tests/pgns/basic.pgn.gz");
+
+        for (const auto& data : {member.substr(0, member.size() / 2), member + member.substr(0, 20)}) {
+            std::stringstream ss(data);
+            pgn::GzipSource source(ss);
+
+            char buffer[4096];
+            while (source.read(buffer, sizeof(buffer)) > 0) {
+            }
+
+            CHECK(source.error());
+        }
+
+        // the parser reports it after the games it could read, also through a ThreadedSource
+        std::stringstream ss(member.substr(0, member.size() / 2));
+        pgn::GzipSource gzip(ss);
+        pgn::ThreadedSource source(gzip);
+
+        auto vis = std::make_unique<MyVisitor>();
+        pgn::StreamParser parser(source);
+        CHECK(parser.readGames(*vis) == pgn::StreamParserError::SourceError);
+        CHECK(source.error());
+        CHECK(vis->count() > 0);
+    }
+#endif
+
+#ifdef CHESS_HAS_ZSTD
+    TEST_CASE("Zstd source") {
+        auto file_stream = std::ifstream("./tests/pgns/basic.pgn.zst", std::ios::binary);
+        pgn::ZstdSource source(file_stream);
+
+        auto vis = std::make_unique<MyVisitor>();
+        pgn::StreamParser parser(source);
+        CHECK(!parser.readGames(*vis));
+        CHECK(!source.error());
+
+        CHECK(vis->count() == 130);
+        CHECK(vis->moves()[0] == "Bg2");
+    }
+
+    TEST_CASE("Zstd source with truncated data") {
+        const auto frame = readFile("./tests/pgns/basic.pgn.zst");
+
+        for (const auto& data : {frame.substr(0, frame.size() / 2), frame + frame.substr(0, 20)}) {
+            std::stringstream ss(data);
+            pgn::ZstdSource source(ss);
+
+            char buffer[4096];
+            while (source.read(buffer, sizeof(buffer)) > 0) {
+            }
+
+            CHECK(source.error());
+        }
+
+        // small reads leave output in the decoder at the end of the input, that is not an error
+        std::stringstream ss(frame);
+        pgn::ZstdSource source(ss);
+
+        char buffer[7];
+        std::size_t total = 0, n;
+        while ((n = source.read(buffer, sizeof(buffer))) > 0) total += n;
+
+        CHECK(!source.error());
+        CHECK(total == readFile("./tests/pgns/basic.pgn").size());
+
+        // the iterator stops with the error, the frame is one block so nothing was decompressed
+        std::stringstream truncated(frame.substr(0, frame.size() / 2));
+        pgn::ZstdSource zstd(truncated);
+        pgn::GameReader reader(zstd);
+
+        CHECK(reader.begin() == reader.end());
+        CHECK(reader.error() == pgn::StreamParserError::SourceError);
+    }
+#endif
+}
+
+TEST_SUITE("PGN games iterator") {
+    TEST_CASE("Iterate games") {
+        auto expected = std::ifstream("./tests/pgns/multiple.pgn");
+        MyVisitor2 all;
+        pgn::StreamParser(expected).readGames(all);
+
+        auto file_stream = std::ifstream("./tests/pgns/multiple.pgn");
+
+        std::vector<std::string> whites;
+        std::vector<std::string> last_moves;
+        std::vector<std::string> last_comments;
+
+        auto reader = pgn::games(file_stream);
+
+        for (const auto& game : reader) {
+            whites.emplace_back(game.header("White").value());
+
+            last_moves.clear();
+            last_comments.clear();
+
+            for (const auto& [move, comment] : game.moves()) {
+                last_moves.emplace_back(move);
+                if (!comment.empty()) last_comments.emplace_back(comment);
+            }
+        }
+
+        CHECK(!reader.error());
+        CHECK(whites == std::vector<std::string>{"New-cfe8ce842c", "Base-c4a644922d", "New-cfe8ce842c",
+                                                 "Base-c4a644922d"});
+        CHECK(last_moves == all.moves());
+        CHECK(last_comments == all.comments());
+        CHECK(reader.game().header("Result").value() == "1/2-1/2");
+        CHECK(!reader.game().header("Foo").has_value());
+    }
+
+    TEST_CASE("Games without moves") {
+        auto file_stream = std::ifstream("./tests/pgns/no_moves_two_games.pgn");
+
+        int count = 0;
+        for (const auto& game : pgn::games(file_stream)) {
+            CHECK(game.headers().size() == 11);
+            CHECK(game.headers()[0].key == "Event");
+            CHECK(game.moves().empty());
+            count++;
+        }
+
+        CHECK(count == 2);
+    }
+
+    TEST_CASE("Pause and resume") {
+        auto file_stream = std::ifstream("./tests/pgns/multiple.pgn");
+        pgn::StreamParser parser(file_stream);
+
+        MyVisitor2 vis;
+        CHECK(!parser.readGame(vis));
+        CHECK(vis.gameCount() == 1);
+        CHECK(vis.endCount() == 1);
+
+        CHECK(!parser.readGame(vis));
+        CHECK(vis.gameCount() == 2);
+        CHECK(vis.endCount() == 2);
+
+        // the rest of the file
+        CHECK(!parser.readGames(vis));
+        CHECK(vis.gameCount() == 4);
+        CHECK(vis.endCount() == 4);
+
+        CHECK(parser.readGame(vis) == pgn::StreamParserError::NotEnoughData);
+        CHECK(vis.gameCount() == 4);
+    }
+
+    TEST_CASE("Empty input") {
+        std::stringstream ss;
+        auto reader = pgn::games(ss);
+        CHECK(reader.begin() == reader.end());
+        CHECK(!reader.error());
+    }
+}
+
+TEST_SUITE("PGN comments") {
+    TEST_CASE("Comments with every buffer size") {
+        const std::string pgn =
+            "[Event \"a\"]\r\n\r\n1. e4 {first} {second} e5 {multi\r\nline} 2. Nf3 {+0.31/18 0.52s} *\r\n";
+
+        const auto check = [](const MyVisitor2& vis) {
+            CHECK(vis.moves() == std::vector<std::string>{"e4", "e5", "Nf3"});
+            CHECK(vis.comments() == std::vector<std::string>{"firstsecond", "multi\nline", "+0.31/18 0.52s"});
+        };
+
+        {
+            std::stringstream ss(pgn);
+            MyVisitor2 vis;
+            pgn::StreamParser(ss).readGames(vis);
+            check(vis);
+        }
+
+        {
+            std::stringstream ss(pgn);
+            MyVisitor2 vis;
+            SmallBufferStreamParser(ss).readGames(vis);
+            check(vis);
+        }
+
+        {
+            std::stringstream ss(pgn);
+            MyVisitor2 vis;
+            pgn::StreamParser<3>(ss).readGames(vis);
+            check(vis);
+        }
+    }
+
+    TEST_CASE("Unterminated comment") {
+        std::stringstream ss("[Event \"a\"]\n\n1. e4 {never closed");
+        MyVisitor2 vis;
+        pgn::StreamParser<2>(ss).readGames(vis);
+
+        CHECK(vis.moves() == std::vector<std::string>{"e4"});
+        CHECK(vis.comments() == std::vector<std::string>{"never closed"});
+        CHECK(vis.endCount() == 1);
+    }
+
+    TEST_CASE("Parse engine comments") {
+        auto info = pgn::parseEngineComment("+0.31/18 0.52s");
+        REQUIRE(info.has_value());
+        CHECK(info->score == 31);
+        CHECK(!info->mate);
+        CHECK(info->depth == 18);
+        CHECK(info->time_ms == 520);
+
+        info = pgn::parseEngineComment("-1.5/7 1.0s, White wins by adjudication");
+        REQUIRE(info.has_value());
+        CHECK(info->score == -150);
+        CHECK(info->depth == 7);
+        CHECK(info->time_ms == 1000);
+
+        info = pgn::parseEngineComment("-M4/22 0.033s");
+        REQUIRE(info.has_value());
+        CHECK(info->mate);
+        CHECK(info->score == -4);
+        CHECK(info->time_ms == 33);
+
+        info = pgn::parseEngineComment("0.00/0");
+        REQUIRE(info.has_value());
+        CHECK(info->score == 0);
+        CHECK(info->depth == 0);
+        CHECK(info->time_ms == -1);
+
+        CHECK(!pgn::parseEngineComment("book").has_value());
+        CHECK(!pgn::parseEngineComment("").has_value());
+        CHECK(!pgn::parseEngineComment("+0.31").has_value());
+
+        // numbers that don't fit
+        CHECK(!pgn::parseEngineComment("+99999999999/20").has_value());
+        CHECK(!pgn::parseEngineComment("+21474837/20").has_value());
+        CHECK(!pgn::parseEngineComment("+0.31/99999999999").has_value());
+        CHECK(!pgn::parseEngineComment("+0.31/18 99999999s").has_value());
+        CHECK(!pgn::parseEngineComment("-M99999999999/20").has_value());
+
+        info = pgn::parseEngineComment("+21262214.99/20 2145336.999s");
+        REQUIRE(info.has_value());
+        CHECK(info->score == 2126221499);
+        CHECK(info->time_ms == 2145336999);
+    }
+}
+
+TEST_SUITE("PGN stats") {
+    TEST_CASE("Counters") {
+        auto file_stream = std::ifstream("./tests/pgns/skip.pgn", std::ios::binary);
+
+        auto vis = std::make_unique<MyVisitor>();
+        pgn::StreamParser parser(file_stream);
+        parser.readGames(*vis);
+
+        const auto stats = parser.stats();
+
+#ifdef CHESS_PGN_STATS
+        CHECK(stats.bytes == std::filesystem::file_size("./tests/pgns/skip.pgn"));
+        CHECK(stats.games == 2);
+        CHECK(stats.skipped_games == 1);
+        // moves of skipped games are parsed as well
+        CHECK(stats.moves == 260);
+#else
+        CHECK(stats.bytes == 0);
+        CHECK(stats.games == 0);
+        CHECK(stats.moves == 0);
+        CHECK(stats.visitor_time.count() == 0);
+#endif
+    }
+}
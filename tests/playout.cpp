@@ -0,0 +1,153 @@
+#include <algorithm>
+#include <stdexcept>
+#include <vector>
+
+#include "../src/include.hpp"
+#include "doctest/doctest.hpp"
+
+using namespace chess;
+
+TEST_SUITE("Playout") {
+    TEST_CASE("gameOver agrees with isGameOver") {
+        PlayoutRng rng(42);
+        RandomSelector select;
+        int finished = 0;
+
+        for (int game = 0; game < 200; ++game) {
+            Board board;
+            Movelist moves;
+
+            for (int ply = 0; ply < 600; ++ply) {
+                movegen::legalmoves(moves, board);
+
+                const auto result = playout::gameOver(board, moves);
+                REQUIRE(result == board.isGameOver());
+
+                if (result.first != GameResultReason::NONE) {
+                    finished++;
+                    break;
+                }
+
+                board.makeMove<true>(select(board, moves, rng));
+            }
+        }
+
+        CHECK(finished > 0);
+    }
+
+    TEST_CASE("gameOver finds a threefold repetition") {
+        auto board = Board();
+        Movelist moves;
+
+        const char* shuffle[] = {"g1f3", "g8f6", "f3g1", "f6g8"};
+
+        for (int i = 0; i < 8; ++i) {
+            movegen::legalmoves(moves, board);
+            CHECK(playout::gameOver(board, moves).first == GameResultReason::NONE);
+
+            board.makeMove(uci::uciToMove(board, shuffle[i % 4]));
+        }
+
+        movegen::legalmoves(moves, board);
+        CHECK(playout::gameOver(board, moves).first == GameResultReason::THREEFOLD_REPETITION);
+        CHECK(board.isGameOver().first == GameResultReason::THREEFOLD_REPETITION);
+    }
+
+    TEST_CASE("gameOver mate and stalemate") {
+        Movelist moves;
+
+        auto mate = Board("rnb1kbnr/pppp1ppp/8/4p3/6Pq/5P2/PPPPP2P/RNBQKBNR w KQkq - 1 3");
+        movegen::legalmoves(moves, mate);
+        CHECK(playout::gameOver(mate, moves) == std::pair{GameResultReason::CHECKMATE, GameResult::LOSE});
+
+        auto stalemate = Board("7k/5Q2/6K1/8/8/8/8/8 b - - 0 1");
+        movegen::legalmoves(moves, stalemate);
+        CHECK(playout::gameOver(stalemate, moves) == std::pair{GameResultReason::STALEMATE, GameResult::DRAW});
+    }
+
+    TEST_CASE("Games don't depend on the number of threads") {
+        PlayoutOptions options;
+        options.games            = 64;
+        options.max_plies        = 120;
+        options.record_positions = true;
+        options.queue_size       = 4;
+
+        const auto collect = [&options](int threads) {
+            options.threads = threads;
+
+            std::vector<PlayoutGame> games(options.games);
+            std::vector<int> seen(options.games, 0);
+
+            playout::run(options, [&](PlayoutGame& game) {
+                seen[game.index]++;
+                games[game.index] = std::move(game);
+            });
+
+            CHECK(std::all_of(seen.begin(), seen.end(), [](int count) { return count == 1; }));
+
+            return games;
+        };
+
+        const auto single = collect(1);
+        const auto multi  = collect(4);
+
+        for (std::size_t i = 0; i < single.size(); ++i) {
+            CHECK(single[i].moves == multi[i].moves);
+            CHECK(single[i].reason == multi[i].reason);
+            CHECK(single[i].positions.size() == single[i].moves.size());
+
+            // the recorded positions are the ones before each move
+            Board board;
+            for (std::size_t ply = 0; ply < single[i].moves.size(); ++ply) {
+                CHECK(Board::Compact::encode(board) == single[i].positions[ply]);
+                board.makeMove<true>(single[i].moves[ply]);
+            }
+
+            CHECK(single[i].moves.size() <= 120);
+            if (single[i].reason == GameResultReason::NONE) CHECK(single[i].moves.size() == 120);
+        }
+    }
+
+    TEST_CASE("Custom selector and start position") {
+        // always the first legal move, so every game is the same
+        const auto first = [](const Board&, const Movelist& moves, PlayoutRng&) { return moves[0]; };
+
+        PlayoutOptions options;
+        options.fen     = "4k3/8/8/8/8/8/4P3/4K3 w - - 0 1";
+        options.games   = 3;
+        options.threads = 2;
+
+        std::vector<std::vector<Move>> games;
+
+        playout::run(options, [&games](PlayoutGame& game) { games.push_back(game.moves); }, first);
+
+        REQUIRE(games.size() == 3);
+        CHECK(games[0] == games[1]);
+        CHECK(games[1] == games[2]);
+
+        // a selector returning NO_MOVE stops the game
+        const auto none = [](const Board&, const Movelist&, PlayoutRng&) { return Move(Move::NO_MOVE); };
+
+        playout::run(options,
+                     [](PlayoutGame& game) {
+                         CHECK(game.moves.empty());
+                         CHECK(game.reason == GameResultReason::NONE);
+                     },
+                     none);
+    }
+
+    TEST_CASE("Exceptions of the consumer stop the workers") {
+        PlayoutOptions options;
+        options.games      = 1000;
+        options.threads    = 2;
+        options.queue_size = 2;
+
+        int consumed = 0;
+
+        CHECK_THROWS(playout::run(options, [&consumed](PlayoutGame&) {
+            if (++consumed == 5) throw std::runtime_error("stop");
+        }));
+
+        CHECK(consumed == 5);
+    }
+}
@@ -0,0 +1,67 @@
+#include "../src/include.hpp"
+#include "doctest/doctest.hpp"
+
+using namespace chess;
+
+TEST_SUITE("Policy Index") {
+    TEST_CASE("Known indices") {
+        // e2 * 73 + north, distance 2
+        CHECK(policy::moveToIndex(Move::make(Square::SQ_E2, Square::SQ_E4), Color::WHITE) == 12 * 73 + 1);
+        // mirrored for black, so e7e5 looks like e2e4
+        CHECK(policy::moveToIndex(Move::make(Square::SQ_E7, Square::SQ_E5), Color::BLACK) == 12 * 73 + 1);
+        // g1 * 73 + knight jump one file left, two ranks up
+        CHECK(policy::moveToIndex(Move::make(Square::SQ_G1, Square::SQ_F3), Color::WHITE) == 6 * 73 + 63);
+        // a7 * 73 + underpromotion to a knight, capturing right
+        CHECK(policy::moveToIndex(Move::make<Move::PROMOTION>(Square::SQ_A7, Square::SQ_B8, PieceType::KNIGHT),
+                                  Color::WHITE) == 48 * 73 + 70);
+        // queen promotions use the normal north plane
+        CHECK(policy::moveToIndex(Move::make<Move::PROMOTION>(Square::SQ_A7, Square::SQ_A8, PieceType::QUEEN),
+                                  Color::WHITE) == 48 * 73 + 0);
+
+        CHECK(policy::moveToIndex(Move::NO_MOVE, Color::WHITE) == -1);
+    }
+
+    TEST_CASE("1858 indices point onto the board") {
+        const auto board = Board{"k7/8/8/8/8/8/8/K7 w - - 0 1"};
+
+        int count = 0;
+        for (int i = 0; i < policy::SIZE; ++i) count += policy::indexToMove(board, i) != Move::NO_MOVE;
+
+        CHECK(count == 1858);
+    }
+
+    TEST_CASE("Legal moves round trip") {
+        const std::pair<std::string, bool> positions[] = {
+            {std::string(constants::STARTPOS), false},
+            {"r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 1", false},
+            {"r3k2r/Pppp1ppp/1b3nbN/nP6/BBP1P3/q4N2/Pp1P2PP/R2Q1RK1 b kq - 0 1", false},
+            {"rnbqkbnr/pppppp1p/8/5PpP/8/8/PPPPP2P/RNBQKBNR w KQkq g6 0 2", false},
+            {"rnbqkbnr/ppp1pppp/8/8/3pP3/8/PPPP1PPP/RNBQKBNR b KQkq e3 0 3", false},
+            {"1rqbkrbn/1ppppp1p/1n6/p1N3p1/8/2P4P/PP1PPPP1/1RQBKRBN w FBfb - 0 9", true},
+            {"qbbnrkr1/p1pppppp/1p4n1/8/2P5/6N1/PPNPPPPP/1BRKBRQ1 b FCge - 1 3", true},
+        };
+
+        for (const auto& [fen, chess960] : positions) {
+            const auto board = Board(fen, chess960);
+
+            Movelist moves;
+            movegen::legalmoves(moves, board);
+
+            const auto mask = policy::legalMask(board);
+            CHECK(mask.count() == moves.size());
+
+            std::uint16_t indices[constants::MAX_MOVES];
+            policy::movesToIndices(moves, board.sideToMove(), indices);
+
+            Movelist decoded;
+            policy::indicesToMoves(board, indices, moves.size(), decoded);
+
+            REQUIRE(decoded.size() == moves.size());
+
+            for (int i = 0; i < moves.size(); ++i) {
+                CHECK(mask.test(indices[i]));
+                CHECK(decoded[i] == moves[i]);
+            }
+        }
+    }
+}
@@ -0,0 +1,49 @@
+#pragma once
+
+#include <string>
+
+#include "../src/include.hpp"
+
+// random legal position with the given pieces, e.g. "KRk", for the tablebase and kpk tests
+inline chess::Board randomPosition(const std::string& pieces, chess::PlayoutRng& rng) {
+    while (true) {
+        std::string squares(64, '.');
+
+        for (const auto piece : pieces) {
+            int sq;
+
+            do {
+                sq = rng.below(64);
+            } while (squares[sq] != '.' || ((piece == 'P' || piece == 'p') && (sq < 8 || sq >= 56)));
+
+            squares[sq] = piece;
+        }
+
+        std::string fen;
+
+        for (int rank = 7; rank >= 0; --rank) {
+            int empty = 0;
+
+            for (int file = 0; file < 8; ++file) {
+                const auto c = squares[rank * 8 + file];
+
+                if (c == '.') {
+                    empty++;
+                    continue;
+                }
+
+                if (empty) fen += std::to_string(empty);
+                fen += c;
+                empty = 0;
+            }
+
+            if (empty) fen += std::to_string(empty);
+            if (rank) fen += '/';
+        }
+
+        fen += rng.below(2) ? " w - - 0 1" : " b - - 0 1";
+
+        chess::Board board(fen);
+        if (!board.isAttacked(board.kingSq(~board.sideToMove()), board.sideToMove())) return board;
+    }
+}
@@ -588,6 +588,14 @@ TEST_SUITE("SAN Parser") {
         CHECK(san == Move::NO_MOVE);
     }
 
+    TEST_CASE("Should throw for a too short san") {
+        auto b = Board();
+
+        CHECK_THROWS_WITH_AS(static_cast<void>(uci::parseSan(b, "e")), "Failed to parse san. At step 0: e",
+                             uci::SanParseError);
+        CHECK(uci::parseSan(b, "") == Move::NO_MOVE);
+    }
+
     TEST_CASE("Checkmate castle should have #") {
         auto b = Board{"RRR5/8/8/8/8/8/PPPPPP2/k3K2R w K - 0 1"};
 
@@ -605,4 +613,177 @@ TEST_SUITE("SAN Parser") {
         CHECK(uci::moveToSan(b, m) == "O-O+");
         CHECK(uci::parseSan(b, "O-O+") == m);
     }
+
+    TEST_CASE("Test Pawn Double Push") {
+        auto b = Board{constants::STARTPOS};
+
+        CHECK(uci::parseSan(b, "e4") == Move::make(Square::SQ_E2, Square::SQ_E4));
+        CHECK(uci::parseSan(b, "e3") == Move::make(Square::SQ_E2, Square::SQ_E3));
+
+        // blocked middle square
+        b = Board{"rnbqkbnr/pppppppp/8/8/8/4N3/PPPPPPPP/R1BQKBNR w KQkq - 0 1"};
+        CHECK_THROWS_AS(static_cast<void>(uci::parseSan(b, "e4")), uci::SanParseError);
+    }
+
+    TEST_CASE("Test Black Pawn Moves") {
+        auto b = Board{"rnbqkbnr/pppppppp/8/8/4P3/8/PPPP1PPP/RNBQKBNR b KQkq - 0 1"};
+
+        CHECK(uci::parseSan(b, "d5") == Move::make(Square::SQ_D7, Square::SQ_D5));
+        CHECK(uci::parseSan(b, "h6") == Move::make(Square::SQ_H7, Square::SQ_H6));
+        CHECK_THROWS_AS(static_cast<void>(uci::parseSan(b, "e8")), uci::SanParseError);
+    }
+
+    TEST_CASE("Test En Passant") {
+        auto b = Board{"rnbqkbnr/ppp1p1pp/8/3pPp2/8/8/PPPP1PPP/RNBQKBNR w KQkq f6 0 3"};
+
+        CHECK(uci::parseSan(b, "exf6") == Move::make<Move::ENPASSANT>(Square::SQ_E5, Square::SQ_F6));
+        CHECK(uci::parseSan(b, "exf6e.p.") == Move::make<Move::ENPASSANT>(Square::SQ_E5, Square::SQ_F6));
+
+        // d6 is not the en passant square
+        CHECK_THROWS_AS(static_cast<void>(uci::parseSan(b, "exd6")), uci::SanParseError);
+    }
+
+    TEST_CASE("Capture sign has to match the destination") {
+        auto b = Board{"4k3/8/8/8/8/5p2/8/4K1N1 w - - 0 1"};
+
+        CHECK(uci::parseSan(b, "Nxf3") == Move::make(Square::SQ_G1, Square::SQ_F3));
+        CHECK_THROWS_AS(static_cast<void>(uci::parseSan(b, "Nf3")), uci::SanParseError);
+        CHECK_THROWS_AS(static_cast<void>(uci::parseSan(b, "Nxe2")), uci::SanParseError);
+    }
+
+    TEST_CASE("Pinned candidate is not ambiguous") {
+        // the knight on c3 is pinned by the bishop on b4
+        auto b = Board{"4k3/8/8/8/1b6/2N5/8/4K1N1 w - - 0 1"};
+
+        Movelist moves;
+        CHECK(uci::parseSan(b, "Ne2", moves) == Move::make(Square::SQ_G1, Square::SQ_E2));
+        CHECK(moves.size() == 1);
+    }
+
+    TEST_CASE("Promotion without piece is ambiguous") {
+        auto b = Board{"8/4P3/8/8/8/8/k7/4K3 w - - 0 1"};
+
+        CHECK(uci::parseSan(b, "e8=N") == Move::make<Move::PROMOTION>(Square::SQ_E7, Square::SQ_E8, PieceType::KNIGHT));
+        CHECK_THROWS_AS(static_cast<void>(uci::parseSan(b, "e8")), uci::AmbiguousMoveError);
+        CHECK_THROWS_AS(static_cast<void>(uci::parseSan(b, "Ne8=Q")), uci::SanParseError);
+    }
+
+    TEST_CASE("Castling without rights") {
+        auto b = Board{"4k3/8/8/8/8/8/8/4K2R w - - 0 1"};
+
+        CHECK_THROWS_AS(static_cast<void>(uci::parseSan(b, "O-O")), uci::SanParseError);
+    }
+
+    TEST_CASE("Chess960 castling") {
+        auto b = Board{"4k3/8/8/8/8/8/8/1R2K1R1 w GB - 0 1", true};
+
+        CHECK(uci::parseSan(b, "O-O") == Move::make<Move::CASTLING>(Square::SQ_E1, Square::SQ_G1));
+        CHECK(uci::parseSan(b, "O-O-O") == Move::make<Move::CASTLING>(Square::SQ_E1, Square::SQ_B1));
+    }
+
+    TEST_CASE("Write SAN into a buffer") {
+        auto b = Board{"RRR5/8/8/8/8/8/PPPPPP2/k3K2R w K - 0 1"};
+
+        char buffer[uci::MAX_SAN_LENGTH];
+        const auto castle = Move::make<Move::CASTLING>(Square::SQ_E1, Square::SQ_H1);
+
+        CHECK(std::string_view(buffer, uci::moveToSan(b, castle, buffer)) == "O-O#");
+        CHECK(std::string_view(buffer, uci::moveToLan(b, castle, buffer)) == "O-O#");
+
+        // the board is left untouched
+        CHECK(b.getFen() == "RRR5/8/8/8/8/8/PPPPPP2/k3K2R w K - 0 1");
+
+        b = Board{"k7/8/8/8/8/8/1p6/1R2K3 w - - 0 1"};
+
+        const auto rook = Move::make(Square::SQ_B1, Square::SQ_B2);
+        CHECK(std::string_view(buffer, uci::moveToSan(b, rook, buffer)) == "Rxb2");
+        CHECK(std::string_view(buffer, uci::moveToLan(b, rook, buffer)) == "Rb1xb2");
+    }
+
+    TEST_CASE("Longest SAN fits into the buffer") {
+        auto b = Board{"1k6/8/8/8/8/8/1p6/B1B4K b - - 0 1"};
+
+        const auto move = Move::make<Move::PROMOTION>(Square::SQ_B2, Square::SQ_C1, PieceType::QUEEN);
+
+        CHECK(uci::moveToSan(b, move) == "bxc1=Q+");
+        CHECK(uci::moveToLan(b, move) == "b2xc1=Q+");
+        CHECK(uci::moveToLan(b, move).size() <= uci::MAX_SAN_LENGTH);
+    }
+
+    TEST_CASE("Game to SAN") {
+        const auto board = Board{constants::STARTPOS};
+
+        const std::vector<Move> moves = {
+            Move::make(Square::SQ_E2, Square::SQ_E4), Move::make(Square::SQ_E7, Square::SQ_E5),
+            Move::make(Square::SQ_F1, Square::SQ_C4), Move::make(Square::SQ_B8, Square::SQ_C6),
+            Move::make(Square::SQ_D1, Square::SQ_H5), Move::make(Square::SQ_G8, Square::SQ_F6),
+            Move::make(Square::SQ_H5, Square::SQ_F7),
+        };
+
+        std::string out;
+        uci::gameToSan(board, moves, out);
+
+        CHECK(out == "1. e4 e5 2. Bc4 Nc6 3. Qh5 Nf6 4. Qxf7#");
+    }
+
+    TEST_CASE("Game to SAN with black to move") {
+        const auto board = Board{"r3k2r/8/8/8/8/8/8/R3K2R b KQkq - 0 20"};
+
+        const std::vector<Move> moves = {
+            Move::make<Move::CASTLING>(Square::SQ_E8, Square::SQ_A8),
+            Move::make(Square::SQ_A1, Square::SQ_A8),
+            Move::make(Square::SQ_C8, Square::SQ_B7),
+            Move::make(Square::SQ_A8, Square::SQ_D8),
+            Move::make(Square::SQ_H8, Square::SQ_H1),
+        };
+
+        std::string out = "[...] ";
+        uci::gameToSan(board, moves.data(), moves.size(), out);
+
+        CHECK(out == "[...] 20... O-O-O 21. Ra8+ Kb7 22. Rxd8 Rxh1+");
+    }
+
+    TEST_CASE("tryParseSan reports the error category") {
+        const auto board = Board{"r3k2r/8/8/8/8/8/2N1N3/R3K2R w Kkq - 0 1"};
+
+        Move move;
+
+        CHECK(uci::tryParseSan(board, "Rb1", move) == uci::SanError::NONE);
+        CHECK(move == Move::make(Square::SQ_A1, Square::SQ_B1));
+
+        CHECK(uci::tryParseSan(board, "", move) == uci::SanError::EMPTY);
+        CHECK(move == Move::NO_MOVE);
+
+        CHECK(uci::tryParseSan(board, "Xe4", move) == uci::SanError::INVALID_SYNTAX);
+        CHECK(uci::tryParseSan(board, "Ne", move) == uci::SanError::INVALID_SYNTAX);
+        CHECK(uci::tryParseSan(board, "e8=", move) == uci::SanError::INVALID_SYNTAX);
+        CHECK(uci::tryParseSan(board, "O-", move) == uci::SanError::INVALID_SYNTAX);
+
+        CHECK(uci::tryParseSan(board, "O-O-O", move) == uci::SanError::ILLEGAL_CASTLING);
+        CHECK(uci::tryParseSan(board, "Nf5", move) == uci::SanError::ILLEGAL_MOVE);
+        CHECK(uci::tryParseSan(board, "Nd4", move) == uci::SanError::AMBIGUOUS);
+        CHECK(move == Move::NO_MOVE);
+
+        CHECK(uci::tryParseSan(board, "O-O", move) == uci::SanError::NONE);
+        CHECK(move == Move::make<Move::CASTLING>(Square::SQ_E1, Square::SQ_H1));
+    }
+
+    TEST_CASE("tryParseSan with a SanCache matches the uncached version") {
+        const auto board = Board{"r3k2r/1P6/8/8/8/8/2N1N3/R3K2R w Kkq - 0 1"};
+
+        uci::SanCache cache;
+        Movelist moves;
+
+        // twice, so that the second round is answered from the cache
+        for (int round = 0; round < 2; ++round) {
+            for (const auto san : {"Rb1", "Xe4", "O-O", "O-O-O", "Nd4", "Nf5", "bxa8=Q+", "bxa8=Q+!?", "bxa8=K", ""}) {
+                Move expected, move;
+
+                const auto error = uci::tryParseSan(board, san, expected);
+
+                CHECK(uci::tryParseSan(board, san, move, moves, cache) == error);
+                CHECK(move == expected);
+            }
+        }
+    }
 }
@@ -0,0 +1,243 @@
+#include <algorithm>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../src/include.hpp"
+#include "doctest/doctest.hpp"
+#include "random_position.hpp"
+
+using namespace chess;
+
+namespace {
+
+// the result of a position follows from the results of its children
+void checkConsistent(Tablebase& tablebase, const Board& board) {
+    const auto result = tablebase.probe(board);
+    REQUIRE(result);
+
+    Movelist moves;
+    movegen::legalmoves(moves, board);
+
+    TablebaseResult expected{board.inCheck() || !moves.empty() ? GameResult::LOSE : GameResult::DRAW, 0};
+
+    for (const auto& move : moves) {
+        auto child = board;
+        child.makeMove<true>(move);
+
+        const auto reply = tablebase.probe(child);
+        REQUIRE(reply);
+
+        if (reply->result == GameResult::LOSE) {
+            if (expected.result != GameResult::WIN || reply->dtm + 1 < expected.dtm) {
+                expected = {GameResult::WIN, reply->dtm + 1};
+            }
+        } else if (reply->result == GameResult::DRAW) {
+            if (expected.result == GameResult::LOSE) expected = {GameResult::DRAW, 0};
+        } else if (expected.result == GameResult::LOSE) {
+            expected.dtm = std::max(expected.dtm, reply->dtm + 1);
+        }
+    }
+
+    CHECK(result->result == expected.result);
+    CHECK(result->dtm == expected.dtm);
+}
+
+}  // namespace
+
+TEST_SUITE("Tablebase") {
+    TEST_CASE("Material signature") {
+        CHECK(Tablebase::material(Board("8/8/8/3k4/8/8/8/KR6 w - - 0 1")) == "KRvK");
+        CHECK(Tablebase::material(Board("kr6/8/8/3K4/8/8/8/8 w - - 0 1")) == "KRvK");
+        CHECK(Tablebase::material(Board("8/8/8/3k4/3p4/8/1N6/KB6 w - - 0 1")) == "KBNvKP");
+        CHECK(Tablebase::material(Board("8/8/8/3k4/3r4/8/1P6/KQ6 w - - 0 1")) == "KQPvKR");
+        CHECK(Tablebase::material(Board("8/8/8/3k4/3n4/8/8/KB6 w - - 0 1")) == "KBvKN");
+        CHECK(Tablebase::material(Board("8/8/8/3k4/3b4/8/8/KN6 w - - 0 1")) == "KBvKN");
+
+        Tablebase tablebase;
+
+        CHECK(!tablebase.generate("KQK"));
+        CHECK(!tablebase.generate("KQvKK"));
+        CHECK(!tablebase.generate("QKvK"));
+        CHECK(!tablebase.generate("KXvK"));
+        CHECK(!tablebase.generate("KQQQvKQ"));
+        CHECK(tablebase.generate("KvK"));
+    }
+
+    TEST_CASE("Positions without a table") {
+        Tablebase tablebase;
+
+        CHECK(!tablebase.probe(Board()));
+        CHECK(!tablebase.probe(Board("4k3/8/8/8/8/8/8/R3K3 w Q - 0 1")));
+        CHECK(tablebase.bestMove(Board()) == Move::NO_MOVE);
+
+        // pawns on the first or last rank
+        CHECK(!tablebase.probe(Board("4K2P/8/8/8/8/8/8/k7 w - - 0 1")));
+        CHECK(!tablebase.probe(Board("4K3/8/8/8/8/8/8/k6p w - - 0 1")));
+        CHECK(!tablebase.probe(Board("4K3/8/8/8/8/8/8/k6P b - - 0 1")));
+
+        const auto draw = tablebase.probe(Board("8/8/8/3k4/8/8/8/KB6 b - - 0 1"));
+        REQUIRE(draw);
+        CHECK(draw->result == GameResult::DRAW);
+    }
+
+    TEST_CASE("Mate, stalemate and the longest mates") {
+        Tablebase tablebase("", 2);
+
+        const auto mated = tablebase.probe(Board("k7/1Q6/1K6/8/8/8/8/8 b - - 0 1"));
+        REQUIRE(mated);
+        CHECK(mated->result == GameResult::LOSE);
+        CHECK(mated->dtm == 0);
+
+        const auto stalemate = tablebase.probe(Board("k7/2Q5/1K6/8/8/8/8/8 b - - 0 1"));
+        REQUIRE(stalemate);
+        CHECK(stalemate->result == GameResult::DRAW);
+
+        auto board       = Board("k7/8/1K6/8/8/8/8/2Q5 w - - 0 1");
+        const auto mate  = tablebase.probe(board);
+        REQUIRE(mate);
+        CHECK(mate->result == GameResult::WIN);
+        CHECK(mate->dtm == 1);
+        CHECK(tablebase.bestMove(board) == uci::uciToMove(board, "c1c8"));
+
+        // the longest mates are 10 moves with a queen and 16 moves with a rook
+        for (const auto& [pieces, longest] : {std::pair{"KQk", 19}, std::pair{"KRk", 31}}) {
+            PlayoutRng rng(7);
+            int max_dtm = 0;
+
+            for (int i = 0; i < 20000; ++i) {
+                const auto result = tablebase.probe(randomPosition(pieces, rng));
+                REQUIRE(result);
+                if (result->result == GameResult::WIN) max_dtm = std::max(max_dtm, result->dtm);
+            }
+
+            CHECK(max_dtm <= longest);
+            CHECK(max_dtm >= longest - 4);
+        }
+    }
+
+    TEST_CASE("Results agree with the children") {
+        Tablebase tablebase("", 2);
+        PlayoutRng rng(3);
+
+        for (const auto pieces : {"KRk", "KPk", "Kkp"}) {
+            for (int i = 0; i < 500; ++i) checkConsistent(tablebase, randomPosition(pieces, rng));
+        }
+
+        // the rook pawn with the defending king in front is a draw
+        const auto draw = tablebase.probe(Board("8/8/8/8/8/k7/P7/K7 w - - 0 1"));
+        REQUIRE(draw);
+        CHECK(draw->result == GameResult::DRAW);
+    }
+
+    TEST_CASE("Colors are swapped for the weaker side") {
+        Tablebase tablebase;
+
+        const auto white = tablebase.probe(Board("8/8/8/3k4/8/8/2R5/K7 b - - 0 1"));
+        const auto black = tablebase.probe(Board("k7/2r5/8/8/3K4/8/8/8 w - - 0 1"));
+
+        REQUIRE(white);
+        REQUIRE(black);
+        CHECK(white->result == GameResult::LOSE);
+        CHECK(black->result == white->result);
+        CHECK(black->dtm == white->dtm);
+    }
+
+    TEST_CASE("Best moves mate in the distance") {
+        Tablebase tablebase;
+        auto board = Board("8/8/8/3k4/8/8/8/KR6 w - - 0 1");
+
+        const auto start = tablebase.probe(board);
+        REQUIRE(start);
+        REQUIRE(start->result == GameResult::WIN);
+
+        for (int ply = 0; ply < start->dtm; ++ply) {
+            const auto move = tablebase.bestMove(board);
+            REQUIRE(move != Move::NO_MOVE);
+            board.makeMove<true>(move);
+        }
+
+        CHECK(board.isGameOver().first == GameResultReason::CHECKMATE);
+    }
+
+    TEST_CASE("Probes from several threads") {
+        const std::vector<Board> boards = {
+            Board("8/8/8/3k4/8/8/8/KR6 w - - 0 1"),
+            Board("k7/8/1K6/8/8/8/8/2Q5 w - - 0 1"),
+            Board("8/8/8/4k3/8/8/4P3/4K3 w - - 0 1"),
+            Board("8/8/8/3k4/8/8/8/KB6 b - - 0 1"),
+        };
+
+        Tablebase single;
+        std::vector<TablebaseResult> expected;
+
+        for (const auto& board : boards) {
+            const auto result = single.probe(board);
+            REQUIRE(result);
+            expected.push_back(*result);
+        }
+
+        // every thread starts with another table, so the generations overlap with probes
+        Tablebase shared;
+        std::vector<std::vector<std::optional<TablebaseResult>>> results(boards.size());
+        std::vector<std::thread> threads;
+
+        for (std::size_t t = 0; t < boards.size(); ++t) {
+            threads.emplace_back([&, t]() {
+                for (std::size_t i = 0; i < boards.size(); ++i) {
+                    results[t].push_back(shared.probe(boards[(t + i) % boards.size()]));
+                }
+            });
+        }
+
+        for (auto& thread : threads) thread.join();
+
+        for (std::size_t t = 0; t < boards.size(); ++t) {
+            for (std::size_t i = 0; i < boards.size(); ++i) {
+                const auto& result = results[t][i];
+                const auto& want   = expected[(t + i) % boards.size()];
+
+                REQUIRE(result);
+                CHECK(result->result == want.result);
+                CHECK(result->dtm == want.dtm);
+            }
+        }
+    }
+
+    TEST_CASE("Tables are cached on disk") {
+        const auto directory = std::filesystem::temp_directory_path() / "chess_tablebase_test";
+        std::filesystem::remove_all(directory);
+        std::filesystem::create_directories(directory);
+
+        const auto board = Board("8/8/8/4k3/8/8/4P3/4K3 w - - 0 1");
+
+        Tablebase generated(directory.string());
+        REQUIRE(generated.generate("KPvK"));
+        CHECK(std::filesystem::exists(directory / "KPvK.ctb"));
+        CHECK(std::filesystem::exists(directory / "KQvK.ctb"));
+
+        const auto expected = generated.probe(board);
+        REQUIRE(expected);
+
+        Tablebase loaded(directory.string());
+        const auto result = loaded.probe(board);
+        REQUIRE(result);
+        CHECK(result->result == expected->result);
+        CHECK(result->dtm == expected->dtm);
+
+        // a broken file is generated again
+        std::ofstream(directory / "KPvK.ctb", std::ios::binary) << "broken";
+
+        Tablebase regenerated(directory.string());
+        const auto again = regenerated.probe(board);
+        REQUIRE(again);
+        CHECK(again->result == expected->result);
+        CHECK(again->dtm == expected->dtm);
+        CHECK(std::filesystem::file_size(directory / "KPvK.ctb") > 100);
+
+        std::filesystem::remove_all(directory);
+    }
+}
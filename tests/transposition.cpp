@@ -0,0 +1,202 @@
+#include <cstdint>
+#include <functional>
+#include <thread>
+#include <vector>
+
+#include "../src/include.hpp"
+#include "doctest/doctest.hpp"
+
+using namespace chess;
+
+namespace {
+
+struct SearchEntry {
+    Move move;
+    std::int16_t score;
+    std::uint8_t bound;
+};
+
+struct WideEntry {
+    std::uint64_t a, b, c;
+};
+
+// keys with the same upper 32 bits share a cluster
+std::uint64_t clusterKey(std::uint64_t i) { return (0x12345678ull << 32) | i; }
+
+// checks the table through the node counts, the benchmark is the place for prefetching
+std::uint64_t perft(Board& board, int depth, TranspositionTable<std::uint64_t>& table) {
+    Movelist moves;
+    movegen::legalmoves(moves, board);
+
+    if (depth == 1) return moves.size();
+
+    // entries of different depths must not share a key
+    const auto key      = board.hash() ^ static_cast<std::uint64_t>(depth);
+    std::uint64_t nodes = 0;
+
+    if (table.probe(key, nodes)) return nodes;
+
+    for (const auto& move : moves) {
+        board.makeMove(move);
+        nodes += perft(board, depth - 1, table);
+        board.unmakeMove(move);
+    }
+
+    table.store(key, depth, nodes);
+
+    return nodes;
+}
+
+}  // namespace
+
+TEST_SUITE("Transposition Table") {
+    TEST_CASE("Empty table") {
+        TranspositionTable<std::uint64_t> table;
+        std::uint64_t nodes;
+
+        table.store(1, 1, 42);
+        table.prefetch(1);
+
+        CHECK(table.size() == 0);
+        CHECK(!table.probe(1, nodes));
+        CHECK(table.hashfull() == 0);
+    }
+
+    TEST_CASE("Store and probe") {
+        TranspositionTable<SearchEntry> table(1);
+
+        const auto move = Move::make(Square::SQ_E2, Square::SQ_E4);
+        table.store(0xDEADBEEF12345678ull, 7, {move, -120, 2});
+
+        SearchEntry entry;
+        int depth;
+
+        REQUIRE(table.probe(0xDEADBEEF12345678ull, entry, depth));
+        CHECK(entry.move == move);
+        CHECK(entry.score == -120);
+        CHECK(entry.bound == 2);
+        CHECK(depth == 7);
+
+        CHECK(!table.probe(0xDEADBEEF12345679ull, entry));
+        CHECK(!table.probe(0xCEADBEEF12345678ull, entry));
+
+        // negative depths and clamping
+        table.store(1, -3, {move, 0, 0});
+        REQUIRE(table.probe(1, entry, depth));
+        CHECK(depth == -3);
+
+        table.store(2, 1000, {move, 0, 0});
+        REQUIRE(table.probe(2, entry, depth));
+        CHECK(depth == TranspositionTable<SearchEntry>::MAX_DEPTH);
+
+        table.clear(2);
+        CHECK(!table.probe(1, entry));
+        CHECK(!table.probe(2, entry));
+        CHECK(!table.probe(0xDEADBEEF12345678ull, entry));
+    }
+
+    TEST_CASE("Entries larger than a word") {
+        TranspositionTable<WideEntry> table(1);
+
+        table.store(99, 5, {1, 2, 3});
+
+        WideEntry entry;
+        REQUIRE(table.probe(99, entry));
+        CHECK(entry.a == 1);
+        CHECK(entry.b == 2);
+        CHECK(entry.c == 3);
+    }
+
+    TEST_CASE("Replacement by depth and age") {
+        TranspositionTable<std::uint64_t> table(1);
+        std::uint64_t value;
+
+        // a shallower entry of the same key is dropped, a deeper one replaces it
+        table.store(clusterKey(1), 10, 1);
+        table.store(clusterKey(1), 4, 2);
+        REQUIRE(table.probe(clusterKey(1), value));
+        CHECK(value == 1);
+
+        table.store(clusterKey(1), 12, 3);
+        REQUIRE(table.probe(clusterKey(1), value));
+        CHECK(value == 3);
+
+        // 16 byte slots, 4 to a cluster, the shallowest goes first
+        table.store(clusterKey(2), 3, 0);
+        table.store(clusterKey(3), 7, 0);
+        table.store(clusterKey(4), 9, 0);
+        table.store(clusterKey(5), 5, 0);
+
+        CHECK(!table.probe(clusterKey(2), value));
+        CHECK(table.probe(clusterKey(1), value));
+        CHECK(table.probe(clusterKey(3), value));
+        CHECK(table.probe(clusterKey(4), value));
+        CHECK(table.probe(clusterKey(5), value));
+
+        // after a new search the old entries go before deeper ones of the current search
+        table.newSearch();
+        CHECK(table.hashfull() == 0);
+
+        table.store(clusterKey(1), 4, 4);
+        REQUIRE(table.probe(clusterKey(1), value));
+        CHECK(value == 4);
+
+        table.store(clusterKey(6), 1, 0);
+        CHECK(table.probe(clusterKey(1), value));
+        CHECK(table.probe(clusterKey(6), value));
+        CHECK(!table.probe(clusterKey(5), value));
+    }
+
+    TEST_CASE("Hashfull") {
+        TranspositionTable<std::uint64_t> table(1);
+
+        for (std::uint64_t i = 0; i < table.size(); ++i) table.store(i * 0x9E3779B97F4A7C15ull, 1, i);
+
+        CHECK(table.hashfull() > 500);
+
+        table.clear();
+        CHECK(table.hashfull() == 0);
+    }
+
+    TEST_CASE("Torn entries are not returned") {
+        // a small table, so that the threads keep overwriting each other
+        TranspositionTable<WideEntry> table(1);
+
+        const auto worker = [&table](std::uint64_t seed, int& bad) {
+            for (int i = 0; i < 200000; ++i) {
+                seed ^= seed << 13;
+                seed ^= seed >> 7;
+                seed ^= seed << 17;
+
+                // few keys, many collisions
+                const auto key = (seed % 50000) * 0x9E3779B97F4A7C15ull;
+
+                WideEntry entry;
+                if (table.probe(key, entry)) bad += entry.a != key || entry.b != ~key || entry.c != key * 3;
+
+                table.store(key, static_cast<int>(seed % 20), {key, ~key, key * 3});
+            }
+        };
+
+        std::vector<int> bad(4, 0);
+        std::vector<std::thread> threads;
+
+        for (int i = 0; i < 4; ++i) threads.emplace_back(worker, i + 1, std::ref(bad[i]));
+        for (auto& thread : threads) thread.join();
+
+        for (const auto count : bad) CHECK(count == 0);
+    }
+
+    TEST_CASE("Perft with a table") {
+        TranspositionTable<std::uint64_t> table(4);
+
+        auto board = Board();
+        CHECK(perft(board, 5, table) == 4865609);
+        CHECK(perft(board, 5, table) == 4865609);
+
+        table.clear();
+
+        board = Board("r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 1");
+        CHECK(perft(board, 4, table) == 4085603);
+    }
+}
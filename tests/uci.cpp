@@ -231,4 +231,136 @@ TEST_SUITE("UCI moveToUci Conversion") {
         Move m = Move::make<Move::CASTLING>(Square::SQ_E1, Square::SQ_G1);
         CHECK(uci::moveToUci(m, true) == "e1g1");
     }
-}
\ No newline at end of file
+
+    TEST_CASE("Write UCI into a buffer") {
+        char buffer[uci::MAX_UCI_LENGTH];
+
+        Move m = Move::make<Move::PROMOTION>(Square::SQ_B2, Square::SQ_A1, PieceType::KNIGHT);
+        CHECK(std::string(buffer, uci::moveToUci(m, buffer)) == "b2a1n");
+
+        m = Move::make<Move::CASTLING>(Square::SQ_E8, Square::SQ_A8);
+        CHECK(std::string(buffer, uci::moveToUci(m, buffer)) == "e8c8");
+        CHECK(std::string(buffer, uci::moveToUci(m, buffer, true)) == "e8a8");
+
+        m = Move::make(Square::SQ_H8, Square::SQ_A1);
+        CHECK(std::string(buffer, uci::moveToUci(m, buffer)) == "h8a1");
+    }
+}
+
+TEST_SUITE("UCI uciToMoveChecked") {
+    TEST_CASE("Round trips every legal move") {
+        const std::pair<std::string, bool> positions[] = {
+            {"r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 1", false},
+            {"rnbq1k1r/pp1Pbppp/2p5/8/2B5/8/PPP1NnPP/RNBQK2R w KQ - 1 8", false},
+            {"rnbqkbnr/pppppp1p/8/5PpP/8/8/PPPPP2P/RNBQKBNR w KQkq g6 0 2", false},
+            {"1rqbkrbn/1ppppp1p/1n6/p1N3p1/8/2P4P/PP1PPPP1/1RQBKRBN w FBfb - 0 9", true},
+        };
+
+        for (const auto& [fen, chess960] : positions) {
+            const auto board = Board(fen, chess960);
+
+            Movelist moves;
+            movegen::legalmoves(moves, board);
+
+            for (const auto& move : moves) {
+                const auto str = uci::moveToUci(move, chess960);
+                CHECK(uci::uciToMoveChecked(board, str) == move);
+                CHECK(uci::uciToMoveChecked(board, str) == uci::uciToMove(board, str));
+            }
+        }
+    }
+
+    TEST_CASE("Rejects illegal moves") {
+        const auto board = Board("r3k2r/8/8/8/8/8/8/R3K1NR w KQkq - 0 1");
+
+        CHECK(uci::uciToMoveChecked(board, "e1g1") == Move::NO_MOVE);  // path blocked
+        CHECK(uci::uciToMoveChecked(board, "a1a9") == Move::NO_MOVE);  // off the board
+        CHECK(uci::uciToMoveChecked(board, "a1b2") == Move::NO_MOVE);  // not a rook move
+        CHECK(uci::uciToMoveChecked(board, "a8a7") == Move::NO_MOVE);  // not our piece
+        CHECK(uci::uciToMoveChecked(board, "e1e2q") == Move::NO_MOVE);  // not a pawn
+        CHECK(uci::uciToMoveChecked(board, "e1") == Move::NO_MOVE);
+        CHECK(uci::uciToMoveChecked(board, "E1C1") == Move::NO_MOVE);
+        CHECK(uci::uciToMoveChecked(board, "e1c1") == Move::make<Move::CASTLING>(Square::SQ_E1, Square::SQ_A1));
+    }
+
+    TEST_CASE("Rejects a promotion without piece") {
+        const auto board = Board("8/4P3/8/8/8/8/8/k3K3 w - - 0 1");
+
+        CHECK(uci::uciToMoveChecked(board, "e7e8") == Move::NO_MOVE);
+        CHECK(uci::uciToMoveChecked(board, "e7e8k") == Move::NO_MOVE);
+        CHECK(uci::uciToMoveChecked(board, "e7e8r") ==
+              Move::make<Move::PROMOTION>(Square::SQ_E7, Square::SQ_E8, PieceType::ROOK));
+    }
+}
+
+TEST_SUITE("UciPosition") {
+    // replays the command on a fresh board to compare against
+    Board replay(std::string_view fen, std::initializer_list<std::string_view> moves) {
+        Board board{fen};
+        for (const auto& move : moves) board.makeMove<true>(uci::uciToMove(board, move));
+        return board;
+    }
+
+    TEST_CASE("Extends the previous moves") {
+        UciPosition position;
+
+        CHECK(position.set("position startpos"));
+        CHECK(position.board().getFen() == constants::STARTPOS);
+
+        CHECK(position.set("position startpos moves e2e4 e7e5"));
+        CHECK(position.set("position startpos moves e2e4 e7e5 g1f3 b8c6"));
+        CHECK(position.moves().size() == 4);
+
+        const auto expected = replay(constants::STARTPOS, {"e2e4", "e7e5", "g1f3", "b8c6"});
+        CHECK(position.board().getFen() == expected.getFen());
+        CHECK(position.board().hash() == expected.hash());
+    }
+
+    TEST_CASE("Takes back moves") {
+        UciPosition position;
+
+        CHECK(position.set("position startpos moves e2e4 e7e5 g1f3 b8c6"));
+        CHECK(position.set("position startpos moves e2e4 e7e5 f1c4"));
+        CHECK(position.moves().size() == 3);
+        CHECK(position.board().getFen() == replay(constants::STARTPOS, {"e2e4", "e7e5", "f1c4"}).getFen());
+
+        CHECK(position.set("position startpos"));
+        CHECK(position.moves().empty());
+        CHECK(position.board().getFen() == constants::STARTPOS);
+    }
+
+    TEST_CASE("Keeps the repetition history") {
+        UciPosition position;
+
+        CHECK(position.set("position startpos moves g1f3 g8f6 f3g1"));
+        CHECK_FALSE(position.board().isRepetition(1));
+
+        CHECK(position.set("position startpos moves g1f3 g8f6 f3g1 f6g8"));
+        CHECK(position.board().isRepetition(1));
+    }
+
+    TEST_CASE("Resets on a new position") {
+        const auto fen = "4k3/8/8/8/8/8/4P3/4K3 w - - 0 1";
+
+        UciPosition position;
+
+        CHECK(position.set("position startpos moves e2e4"));
+        CHECK(position.set(std::string("position fen ") + fen + " moves e2e4"));
+        CHECK(position.moves().size() == 1);
+        CHECK(position.board().getFen() == replay(fen, {"e2e4"}).getFen());
+    }
+
+    TEST_CASE("Stops at an illegal move") {
+        UciPosition position;
+
+        CHECK_FALSE(position.set("position startpos moves e2e4 e2e4 e7e5"));
+        CHECK(position.moves().size() == 1);
+        CHECK(position.board().getFen() == replay(constants::STARTPOS, {"e2e4"}).getFen());
+
+        CHECK(position.set("position startpos moves e2e4 e7e5"));
+        CHECK(position.moves().size() == 2);
+
+        CHECK_FALSE(position.set("position fen invalid"));
+        CHECK_FALSE(position.set("position nothing"));
+    }
+}
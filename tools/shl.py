@@ -224,6 +224,8 @@ stl_headers = [
     "immintrin.h",
     "intrin.h",
     "nmmintrin.h",
+    "zlib.h",
+    "zstd.h",
 ]
 
 